@@ -0,0 +1,122 @@
+/**
+ * @file bench.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_utils 性能测试框架.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static int _cmp_double(const void *a, const void *b);
+
+/* ==================== [Static Variables] ================================== */
+
+static FILE *s_out = NULL;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_init(void)
+{
+    int fd = dup(STDOUT_FILENO);
+    if (fd >= 0) {
+        s_out = fdopen(fd, "w");
+    }
+    if (NULL == s_out) {
+        s_out = stderr;
+        return;
+    }
+    if (NULL == freopen("/dev/null", "w", stdout)) {
+        s_out = stdout;
+    }
+}
+
+uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void bench_printf(const char *format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+    vfprintf(s_out ? s_out : stdout, format, ap);
+    va_end(ap);
+    fflush(s_out ? s_out : stdout);
+}
+
+void bench_section(const char *title)
+{
+    bench_printf("\n== %s ==\n", title);
+    bench_printf("%-40s %12s %12s %12s\n", "benchmark", "median", "p99", "min");
+}
+
+bench_result_t bench_run(const char *name, bench_fn_t fn, void *arg, uint64_t iters)
+{
+    static double samples[BENCH_REPS];
+    bench_result_t res = {0};
+
+    /* 标定: 倍增 iters 直到单次重复达到目标耗时 */
+    if (0 == iters) {
+        iters = 1;
+        while (1) {
+            uint64_t t0 = bench_now_ns();
+            fn(arg, iters);
+            uint64_t dt = bench_now_ns() - t0;
+            if ((dt >= BENCH_REP_TARGET_NS) || (iters >= (1ULL << 40))) {
+                break;
+            }
+            iters *= 2;
+        }
+    }
+
+    for (int i = 0; i < BENCH_WARMUP_REPS; i++) {
+        fn(arg, iters);
+    }
+
+    for (int i = 0; i < BENCH_REPS; i++) {
+        uint64_t t0 = bench_now_ns();
+        fn(arg, iters);
+        uint64_t t1 = bench_now_ns();
+        samples[i] = (double)(t1 - t0) / (double)iters;
+    }
+    qsort(samples, BENCH_REPS, sizeof(samples[0]), _cmp_double);
+
+    res.min     = samples[0];
+    res.median  = samples[BENCH_REPS / 2];
+    res.p99     = samples[(BENCH_REPS * 99) / 100];
+
+    bench_printf("%-40s %9.1f ns %9.1f ns %9.1f ns\n",
+                 name, res.median, res.p99, res.min);
+    return res;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static int _cmp_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
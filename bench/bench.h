@@ -0,0 +1,127 @@
+/**
+ * @file bench.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_utils 性能测试框架.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 每个测试项是一个 `bench_fn_t`, 被调用时执行 iters 次被测操作.
+ * bench_run() 先自动标定 iters 使单次重复约耗时 BENCH_REP_TARGET_NS,
+ * 然后预热 BENCH_WARMUP_REPS 次, 再测量 BENCH_REPS 次,
+ * 最后输出每次操作耗时（ns/op）的中位数、p99 与最小值.
+ *
+ * 运行期间标准输出被重定向到 /dev/null, 以便测试日志等会输出内容的接口;
+ * 测试结果通过 bench_printf() 输出到原标准输出.
+ */
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#define BENCH_WARMUP_REPS               (5)
+#define BENCH_REPS                      (101)
+#define BENCH_REP_TARGET_NS             (2000000ULL)
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 被测函数.
+ *
+ * @param arg 用户参数.
+ * @param iters 需要执行被测操作的次数.
+ */
+typedef void (*bench_fn_t)(void *arg, uint64_t iters);
+
+/**
+ * @brief 测试结果, 单位 ns/op.
+ */
+typedef struct {
+    double median;
+    double p99;
+    double min;
+} bench_result_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化测试框架（重定向标准输出）.
+ */
+void bench_init(void);
+
+/**
+ * @brief 获取单调时钟, 单位 ns.
+ */
+uint64_t bench_now_ns(void);
+
+/**
+ * @brief 输出测试结果. 用法同 printf.
+ */
+void bench_printf(const char *format, ...);
+
+/**
+ * @brief 输出测试分组标题.
+ */
+void bench_section(const char *title);
+
+/**
+ * @brief 运行一个测试项并输出结果.
+ *
+ * @param name 测试项名称.
+ * @param fn 被测函数.
+ * @param arg 用户参数.
+ * @param iters 每次重复执行的次数, 为 0 时自动标定.
+ * @return bench_result_t 测试结果.
+ */
+bench_result_t bench_run(const char *name, bench_fn_t fn, void *arg, uint64_t iters);
+
+void bench_timer_wheel(void);
+void bench_log(void);
+void bench_lock(void);
+void bench_list(void);
+void bench_err(void);
+void bench_time(void);
+void bench_histogram(void);
+void bench_trace(void);
+void bench_log_file(void);
+void bench_stdio(void);
+void bench_string(void);
+void bench_strbuf(void);
+void bench_vec(void);
+void bench_heap(void);
+void bench_hashmap(void);
+void bench_crc(void);
+void bench_skiplist(void);
+void bench_rcu(void);
+void bench_clist(void);
+void bench_threadpool(void);
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 防止编译器优化掉结果.
+ */
+#if defined(__GNUC__)
+#   define bench_keep(p)                __asm__ __volatile__("" : : "g"(p) : "memory")
+#else
+#   define bench_keep(p)                ((void)(p))
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __BENCH_H__
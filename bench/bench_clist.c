@@ -0,0 +1,207 @@
+/**
+ * @file bench_clist.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_clist 生产者/消费者队列: 手写 xf_list + xf_lock 与 xf_clist、分段 xf_clist 对比.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define THREADS_MAX                     (4)
+#define MSG_NUM                         (50000)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef enum {
+    MODE_HANDMADE = 0,                  /*!< xf_list + xf_lock, 消费者轮询 */
+    MODE_CLIST,                         /*!< xf_clist, 消费者阻塞等待 */
+    MODE_STRIPED,                       /*!< xf_clist_striped, 每个线程一段 */
+} bench_mode_t;
+
+typedef struct {
+    bench_mode_t    mode;
+    int             pairs;              /*!< 生产者数 = 消费者数 */
+    uint64_t        per_thread;         /*!< 每个线程生产/消费的消息数 */
+} queue_arg_t;
+
+typedef struct {
+    queue_arg_t    *arg;
+    uint32_t        id;
+} worker_t;
+
+typedef struct {
+    xf_list_t   node;
+    uint32_t    value;
+} bench_msg_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _run(void *arg, uint64_t iters);
+static void *_producer(void *arg);
+static void *_consumer(void *arg);
+
+/* ==================== [Static Variables] ================================== */
+
+static bench_msg_t *s_msgs;
+
+static XF_LIST_HEAD(s_list);
+static xf_lock_t s_lock = NULL;
+static xf_clist_t s_clist;
+static xf_clist_striped_t s_striped;
+
+static const char *const s_mode_names[] = {
+    "xf_list + xf_lock (poll)",
+    "xf_clist (pop_wait)",
+    "xf_clist_striped (pop_wait)",
+};
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_clist(void)
+{
+    s_msgs = (bench_msg_t *)malloc(sizeof(bench_msg_t) * MSG_NUM);
+    if (NULL == s_msgs) {
+        return;
+    }
+    if (XF_OK != xf_lock_init(&s_lock)) {
+        bench_printf("xf_lock not registered, skip\n");
+        free(s_msgs);
+        return;
+    }
+    if ((XF_OK != xf_clist_init(&s_clist, true))
+            || (XF_OK != xf_clist_striped_init(&s_striped, THREADS_MAX, true))) {
+        bench_printf("xf_cond not supported, skip\n");
+        xf_clist_deinit(&s_clist);
+        xf_lock_destroy(s_lock);
+        s_lock = NULL;
+        free(s_msgs);
+        return;
+    }
+
+    /* 结果为每条消息的平均墙钟时间 */
+    static const int s_pairs[] = {1, 2, 4};
+    for (size_t i = 0; i < ARRAY_SIZE(s_pairs); i++) {
+        char title[64];
+        snprintf(title, sizeof(title),
+                 "xf_clist: %d producers + %d consumers", s_pairs[i], s_pairs[i]);
+        bench_section(title);
+        for (int m = MODE_HANDMADE; m <= MODE_STRIPED; m++) {
+            queue_arg_t arg = {.mode = (bench_mode_t)m, .pairs = s_pairs[i]};
+            bench_run(s_mode_names[m], _run, &arg, MSG_NUM);
+        }
+    }
+
+    free(s_msgs);
+    s_msgs = NULL;
+    xf_clist_striped_deinit(&s_striped);
+    xf_clist_deinit(&s_clist);
+    xf_lock_destroy(s_lock);
+    s_lock = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _run(void *arg, uint64_t iters)
+{
+    queue_arg_t *p_arg = (queue_arg_t *)arg;
+    pthread_t prod[THREADS_MAX];
+    pthread_t cons[THREADS_MAX];
+    worker_t workers[THREADS_MAX];
+    int n = p_arg->pairs;
+
+    if (iters > MSG_NUM) {
+        iters = MSG_NUM;
+    }
+    p_arg->per_thread = iters / (uint64_t)n;
+    for (int i = 0; i < n; i++) {
+        workers[i].arg = p_arg;
+        workers[i].id = (uint32_t)i;
+        pthread_create(&cons[i], NULL, _consumer, &workers[i]);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_create(&prod[i], NULL, _producer, &workers[i]);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_join(prod[i], NULL);
+        pthread_join(cons[i], NULL);
+    }
+}
+
+static void *_producer(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+    queue_arg_t *p_arg = w->arg;
+    bench_msg_t *msgs = &s_msgs[w->id * p_arg->per_thread];
+
+    for (uint64_t i = 0; i < p_arg->per_thread; i++) {
+        bench_msg_t *msg = &msgs[i];
+        msg->value = (uint32_t)i;
+        switch (p_arg->mode) {
+        case MODE_HANDMADE:
+            xf_lock_lock(s_lock);
+            xf_list_add_tail(&msg->node, &s_list);
+            xf_lock_unlock(s_lock);
+            break;
+        case MODE_CLIST:
+            xf_clist_push_back(&s_clist, &msg->node);
+            break;
+        case MODE_STRIPED:
+        default:
+            xf_clist_striped_push(&s_striped, &msg->node, w->id);
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void *_consumer(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+    queue_arg_t *p_arg = w->arg;
+    uint32_t sum = 0;
+
+    for (uint64_t i = 0; i < p_arg->per_thread; i++) {
+        xf_list_t *node = NULL;
+        switch (p_arg->mode) {
+        case MODE_HANDMADE:
+            for (;;) {
+                xf_lock_lock(s_lock);
+                if (!xf_list_empty(&s_list)) {
+                    node = s_list.next;
+                    xf_list_del(node);
+                }
+                xf_lock_unlock(s_lock);
+                if (NULL != node) {
+                    break;
+                }
+                xf_cpu_relax();
+            }
+            break;
+        case MODE_CLIST:
+            xf_clist_pop_wait(&s_clist, &node, XF_CLIST_WAIT_FOREVER);
+            break;
+        case MODE_STRIPED:
+        default:
+            xf_clist_striped_pop_wait(&s_striped, &node, w->id, XF_CLIST_WAIT_FOREVER);
+            break;
+        }
+        sum += xf_list_entry(node, bench_msg_t, node)->value;
+    }
+    bench_keep(sum);
+    return NULL;
+}
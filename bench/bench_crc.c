@@ -0,0 +1,163 @@
+/**
+ * @file bench_crc.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_crc / xf_hash 吞吐量（GB/s）, 与逐位计算的 CRC32 对比.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define MAX_SIZE                        (64u * 1024u)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct {
+    const char *name;
+    uint32_t (*fn)(const void *data, size_t len);
+} impl_t;
+
+typedef struct {
+    const impl_t   *impl;
+    size_t          size;
+} case_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _run(void *arg, uint64_t iters);
+static uint32_t _bitwise_crc32(const void *data, size_t len);
+static uint32_t _crc32(const void *data, size_t len);
+static uint32_t _crc32c(const void *data, size_t len);
+static uint32_t _crc16(const void *data, size_t len);
+static uint32_t _crc8(const void *data, size_t len);
+static uint32_t _hash32(const void *data, size_t len);
+static uint32_t _hash64(const void *data, size_t len);
+
+/* ==================== [Static Variables] ================================== */
+
+/* 逐位计算相当于各模块原先自带的 CRC 实现 */
+static const impl_t s_impls[] = {
+    {"bitwise32",   _bitwise_crc32},
+    {"crc32",       _crc32},
+    {"crc32c",      _crc32c},
+    {"crc16",       _crc16},
+    {"crc8",        _crc8},
+    {"hash32",      _hash32},
+    {"hash64",      _hash64},
+};
+
+static const size_t s_sizes[] = {8, 64, 1024, MAX_SIZE};
+
+static uint8_t *s_buf;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_crc(void)
+{
+    double gbps[ARRAY_SIZE(s_sizes)][ARRAY_SIZE(s_impls)];
+    uint32_t seed = 1;
+
+    s_buf = (uint8_t *)malloc(MAX_SIZE);
+    if (NULL == s_buf) {
+        return;
+    }
+    for (size_t i = 0; i < MAX_SIZE; i++) {
+        seed = seed * 1103515245u + 12345u;
+        s_buf[i] = (uint8_t)(seed >> 16);
+    }
+
+    bench_section("xf_crc / xf_hash: throughput");
+    for (size_t i = 0; i < ARRAY_SIZE(s_sizes); i++) {
+        for (size_t j = 0; j < ARRAY_SIZE(s_impls); j++) {
+            case_t c = {&s_impls[j], s_sizes[i]};
+            char name[64];
+            snprintf(name, sizeof(name), "%s %zu B", c.impl->name, c.size);
+            bench_result_t res = bench_run(name, _run, &c, 0);
+            gbps[i][j] = (double)c.size / res.median;
+        }
+    }
+    bench_printf("crc32c hardware: %s\n", xf_crc32c_is_hw() ? "yes" : "no");
+    bench_printf("%-12s", "size (GB/s)");
+    for (size_t j = 0; j < ARRAY_SIZE(s_impls); j++) {
+        bench_printf(" %10s", s_impls[j].name);
+    }
+    bench_printf("\n");
+    for (size_t i = 0; i < ARRAY_SIZE(s_sizes); i++) {
+        bench_printf("%-12zu", s_sizes[i]);
+        for (size_t j = 0; j < ARRAY_SIZE(s_impls); j++) {
+            bench_printf(" %10.2f", gbps[i][j]);
+        }
+        bench_printf("\n");
+    }
+
+    free(s_buf);
+    s_buf = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _run(void *arg, uint64_t iters)
+{
+    const case_t *c = (const case_t *)arg;
+    uint32_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        sum += c->impl->fn(s_buf, c->size);
+    }
+    bench_keep(sum);
+}
+
+static uint32_t _bitwise_crc32(const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t crc = 0xffffffffu;
+    while (len-- > 0) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+static uint32_t _crc32(const void *data, size_t len)
+{
+    return xf_crc32(XF_CRC32_INIT, data, len);
+}
+
+static uint32_t _crc32c(const void *data, size_t len)
+{
+    return xf_crc32c(XF_CRC32C_INIT, data, len);
+}
+
+static uint32_t _crc16(const void *data, size_t len)
+{
+    return xf_crc16(XF_CRC16_INIT, data, len);
+}
+
+static uint32_t _crc8(const void *data, size_t len)
+{
+    return xf_crc8(XF_CRC8_INIT, data, len);
+}
+
+static uint32_t _hash32(const void *data, size_t len)
+{
+    return xf_hash32(data, len, 0);
+}
+
+static uint32_t _hash64(const void *data, size_t len)
+{
+    return (uint32_t)xf_hash64(data, len, 0);
+}
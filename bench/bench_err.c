@@ -0,0 +1,55 @@
+/**
+ * @file bench_err.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_err 性能测试.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _err_to_name(void *arg, uint64_t iters);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_err(void)
+{
+    bench_section(XF_COMMON_ERR_TO_NAME_LOOKUP_IS_ENABLE
+                  ? "xf_err (lookup table enabled)"
+                  : "xf_err (lookup table disabled)");
+
+    xf_err_t code = XF_OK;
+    bench_run("xf_err_to_name(XF_OK)", _err_to_name, &code, 0);
+    code = XF_ERR_ISR;
+    bench_run("xf_err_to_name(XF_ERR_ISR)", _err_to_name, &code, 0);
+    code = 0x7fff;
+    bench_run("xf_err_to_name(unknown)", _err_to_name, &code, 0);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _err_to_name(void *arg, uint64_t iters)
+{
+    /* 通过 volatile 读取, 防止编译器将查找提到循环外 */
+    volatile xf_err_t *p_code = (volatile xf_err_t *)arg;
+    for (uint64_t i = 0; i < iters; i++) {
+        const char *name = xf_err_to_name(*p_code);
+        bench_keep(name);
+    }
+}
@@ -0,0 +1,322 @@
+/**
+ * @file bench_hashmap.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_hashmap 与以 xf_list 为桶的链式哈希表对比.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define KEY_NUM_MAX                     (1 << 20)
+#define STR_KEY_NUM                     (10000)
+#define STR_KEY_LEN                     (24)
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 链式哈希表节点, 桶数与元素数相同（负载因子 1）.
+ */
+typedef struct {
+    xf_list_t   node;
+    uint64_t    key;
+    uint64_t    value;
+} chain_item_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _run_u64(size_t num);
+static void _run_str(void);
+static void _get_hit(void *arg, uint64_t iters);
+static void _get_miss(void *arg, uint64_t iters);
+static void _chain_get_hit(void *arg, uint64_t iters);
+static void _chain_get_miss(void *arg, uint64_t iters);
+static void _insert(void *arg, uint64_t iters);
+static void _insert_reserved(void *arg, uint64_t iters);
+static void _chain_insert(void *arg, uint64_t iters);
+static void _str_get_hit(void *arg, uint64_t iters);
+static void _str_chain_get_hit(void *arg, uint64_t iters);
+static chain_item_t *_chain_find(uint64_t key);
+static uint64_t _next_key(void);
+
+/* ==================== [Static Variables] ================================== */
+
+static uint64_t *s_keys = NULL;
+static uint64_t *s_miss_keys = NULL;
+static size_t s_num = 0;
+static xf_hashmap_t s_map;
+
+static chain_item_t *s_items = NULL;
+static xf_list_t *s_buckets = NULL;
+static size_t s_bucket_mask = 0;
+
+static char (*s_strs)[STR_KEY_LEN] = NULL;
+static const char **s_str_ptrs = NULL;
+static xf_hashmap_t s_str_map;
+
+static uint64_t s_seed = 1;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_hashmap(void)
+{
+    s_keys = (uint64_t *)malloc(sizeof(uint64_t) * KEY_NUM_MAX);
+    s_miss_keys = (uint64_t *)malloc(sizeof(uint64_t) * KEY_NUM_MAX);
+    s_items = (chain_item_t *)malloc(sizeof(chain_item_t) * KEY_NUM_MAX);
+    s_buckets = (xf_list_t *)malloc(sizeof(xf_list_t) * KEY_NUM_MAX);
+    if ((NULL == s_keys) || (NULL == s_miss_keys) || (NULL == s_items) || (NULL == s_buckets)) {
+        goto l_free;
+    }
+    for (size_t i = 0; i < KEY_NUM_MAX; i++) {
+        /* 最低位区分命中与未命中的键 */
+        s_keys[i] = _next_key() & ~1ULL;
+        s_miss_keys[i] = _next_key() | 1ULL;
+    }
+
+    _run_u64(1000);
+    _run_u64(KEY_NUM_MAX);
+    _run_str();
+
+l_free:
+    free(s_keys);
+    free(s_miss_keys);
+    free(s_items);
+    free(s_buckets);
+    s_keys = NULL;
+    s_miss_keys = NULL;
+    s_items = NULL;
+    s_buckets = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _run_u64(size_t num)
+{
+    char title[64];
+    uint64_t iters = (num > 100000) ? 4 * num : 0;
+
+    s_num = num;
+    xf_hashmap_init(&s_map, sizeof(uint64_t), sizeof(uint64_t), NULL, NULL);
+    for (size_t i = 0; i < num; i++) {
+        xf_hashmap_put(&s_map, &s_keys[i], &i);
+    }
+    for (s_bucket_mask = 1; s_bucket_mask < num; s_bucket_mask <<= 1) {}
+    s_bucket_mask -= 1;
+    for (size_t i = 0; i <= s_bucket_mask; i++) {
+        xf_list_init(&s_buckets[i]);
+    }
+    for (size_t i = 0; i < num; i++) {
+        s_items[i].key = s_keys[i];
+        s_items[i].value = i;
+        xf_list_add_tail(&s_items[i].node,
+                         &s_buckets[xf_hash_u64(s_keys[i]) & s_bucket_mask]);
+    }
+
+    snprintf(title, sizeof(title), "xf_hashmap: u64 -> u64, %zu keys", num);
+    bench_section(title);
+    bench_run("chained xf_list get (hit)", _chain_get_hit, NULL, iters);
+    bench_run("xf_hashmap get (hit)", _get_hit, NULL, iters);
+    bench_run("chained xf_list get (miss)", _chain_get_miss, NULL, iters);
+    bench_run("xf_hashmap get (miss)", _get_miss, NULL, iters);
+    bench_printf("load: %zu / %zu slots\n", xf_hashmap_len(&s_map), s_map.cap);
+
+    xf_hashmap_deinit(&s_map);
+
+    /* 插入: 每次迭代插入全部键, 结果按单个键折算 */
+    snprintf(title, sizeof(title), "xf_hashmap: insert %zu u64 keys (ns/key)", num);
+    bench_section(title);
+    bench_run("chained xf_list", _chain_insert, NULL, 0);
+    bench_run("xf_hashmap (grow from 0)", _insert, NULL, 0);
+    bench_run("xf_hashmap (reserved)", _insert_reserved, NULL, 0);
+    bench_printf("divide by %zu for ns/key\n", num);
+}
+
+static void _run_str(void)
+{
+    s_strs = (char (*)[STR_KEY_LEN])malloc(sizeof(*s_strs) * STR_KEY_NUM);
+    s_str_ptrs = (const char **)malloc(sizeof(const char *) * STR_KEY_NUM);
+    if ((NULL == s_strs) || (NULL == s_str_ptrs)) {
+        goto l_free;
+    }
+    xf_hashmap_init(&s_str_map, sizeof(const char *), sizeof(uint32_t),
+                    xf_hashmap_hash_str, xf_hashmap_eq_str);
+    for (s_bucket_mask = 1; s_bucket_mask < STR_KEY_NUM; s_bucket_mask <<= 1) {}
+    s_bucket_mask -= 1;
+    for (size_t i = 0; i <= s_bucket_mask; i++) {
+        xf_list_init(&s_buckets[i]);
+    }
+    for (uint32_t i = 0; i < STR_KEY_NUM; i++) {
+        snprintf(s_strs[i], STR_KEY_LEN, "sensor/%u/value", (unsigned)(_next_key() % 1000000u));
+        s_str_ptrs[i] = s_strs[i];
+        xf_hashmap_put(&s_str_map, &s_str_ptrs[i], &i);
+        s_items[i].key = (uint64_t)(uintptr_t)s_strs[i];
+        s_items[i].value = i;
+        xf_list_add_tail(&s_items[i].node,
+                         &s_buckets[xf_hashmap_hash_str(&s_str_ptrs[i], 0) & s_bucket_mask]);
+    }
+
+    bench_section("xf_hashmap: string keys (const char *), 10000 keys");
+    bench_run("chained xf_list get (hit)", _str_chain_get_hit, NULL, 0);
+    bench_run("xf_hashmap get (hit)", _str_get_hit, NULL, 0);
+
+    xf_hashmap_deinit(&s_str_map);
+l_free:
+    free(s_strs);
+    free(s_str_ptrs);
+    s_strs = NULL;
+    s_str_ptrs = NULL;
+}
+
+static void _get_hit(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        uint64_t *v = (uint64_t *)xf_hashmap_get(&s_map, &s_keys[i % s_num]);
+        sum += *v;
+    }
+    bench_keep(sum);
+}
+
+static void _get_miss(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        sum += (NULL == xf_hashmap_get(&s_map, &s_miss_keys[i % s_num]));
+    }
+    bench_keep(sum);
+}
+
+static void _chain_get_hit(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        sum += _chain_find(s_keys[i % s_num])->value;
+    }
+    bench_keep(sum);
+}
+
+static void _chain_get_miss(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        sum += (NULL == _chain_find(s_miss_keys[i % s_num]));
+    }
+    bench_keep(sum);
+}
+
+static void _insert(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t n = 0; n < iters; n++) {
+        xf_hashmap_init(&s_map, sizeof(uint64_t), sizeof(uint64_t), NULL, NULL);
+        for (size_t i = 0; i < s_num; i++) {
+            xf_hashmap_put(&s_map, &s_keys[i], &i);
+        }
+        xf_hashmap_deinit(&s_map);
+    }
+}
+
+static void _insert_reserved(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t n = 0; n < iters; n++) {
+        xf_hashmap_init(&s_map, sizeof(uint64_t), sizeof(uint64_t), NULL, NULL);
+        xf_hashmap_reserve(&s_map, s_num);
+        for (size_t i = 0; i < s_num; i++) {
+            xf_hashmap_put(&s_map, &s_keys[i], &i);
+        }
+        xf_hashmap_deinit(&s_map);
+    }
+}
+
+/**
+ * @brief 节点和桶都已预先分配, 只计入链表插入本身.
+ */
+static void _chain_insert(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t n = 0; n < iters; n++) {
+        for (size_t i = 0; i <= s_bucket_mask; i++) {
+            xf_list_init(&s_buckets[i]);
+        }
+        for (size_t i = 0; i < s_num; i++) {
+            xf_list_t *bucket = &s_buckets[xf_hash_u64(s_keys[i]) & s_bucket_mask];
+            if (NULL == _chain_find(s_keys[i])) {
+                s_items[i].key = s_keys[i];
+                s_items[i].value = i;
+                xf_list_add_tail(&s_items[i].node, bucket);
+            }
+        }
+    }
+}
+
+static void _str_get_hit(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        char key[STR_KEY_LEN];
+        const char *p = key;
+        /* 用副本查找, 确保按内容而不是按指针比较 */
+        memcpy(key, s_strs[i % STR_KEY_NUM], STR_KEY_LEN);
+        uint32_t *v = (uint32_t *)xf_hashmap_get(&s_str_map, &p);
+        sum += *v;
+    }
+    bench_keep(sum);
+}
+
+static void _str_chain_get_hit(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        char key[STR_KEY_LEN];
+        const char *p = key;
+        chain_item_t *item;
+        memcpy(key, s_strs[i % STR_KEY_NUM], STR_KEY_LEN);
+        xf_list_t *bucket = &s_buckets[xf_hashmap_hash_str(&p, 0) & s_bucket_mask];
+        xf_list_for_each_entry(item, bucket, chain_item_t, node) {
+            if (0 == strcmp((const char *)(uintptr_t)item->key, key)) {
+                sum += item->value;
+                break;
+            }
+        }
+    }
+    bench_keep(sum);
+}
+
+static chain_item_t *_chain_find(uint64_t key)
+{
+    chain_item_t *item;
+    xf_list_t *bucket = &s_buckets[xf_hash_u64(key) & s_bucket_mask];
+    xf_list_for_each_entry(item, bucket, chain_item_t, node) {
+        if (item->key == key) {
+            return item;
+        }
+    }
+    return NULL;
+}
+
+static uint64_t _next_key(void)
+{
+    s_seed = s_seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return s_seed ^ (s_seed >> 29);
+}
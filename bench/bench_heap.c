@@ -0,0 +1,169 @@
+/**
+ * @file bench_heap.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_heap / xf_pheap 与按插入排序的 xf_list 对比（保持模型: 弹出最小值再插入新值）.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define NODE_NUM_MAX                    (10000)
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 同一个节点同时可以挂在有序链表或配对堆上.
+ */
+typedef struct {
+    xf_list_t       list_node;
+    xf_pheap_node_t heap_node;
+    uint32_t        key;
+} bench_item_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _run_size(size_t num);
+static void _hold_list(void *arg, uint64_t iters);
+static void _hold_heap(void *arg, uint64_t iters);
+static void _hold_pheap(void *arg, uint64_t iters);
+static void _list_insert(bench_item_t *item);
+static int _heap_cmp(const void *a, const void *b);
+static int _pheap_cmp(const xf_pheap_node_t *a, const xf_pheap_node_t *b);
+static uint32_t _next_delay(void);
+
+/* ==================== [Static Variables] ================================== */
+
+static bench_item_t *s_items = NULL;
+static XF_LIST_HEAD(s_list);
+static xf_heap_t s_heap;
+static xf_pheap_t s_pheap;
+static uint32_t s_seed = 1;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_heap(void)
+{
+    s_items = (bench_item_t *)malloc(sizeof(bench_item_t) * NODE_NUM_MAX);
+    if (NULL == s_items) {
+        return;
+    }
+    xf_heap_init(&s_heap, sizeof(uint32_t), _heap_cmp);
+    xf_pheap_init(&s_pheap, _pheap_cmp);
+
+    _run_size(16);
+    _run_size(1000);
+    _run_size(NODE_NUM_MAX);
+
+    xf_heap_deinit(&s_heap);
+    free(s_items);
+    s_items = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _run_size(size_t num)
+{
+    char title[64];
+
+    xf_list_init(&s_list);
+    xf_heap_deinit(&s_heap);
+    xf_pheap_init(&s_pheap, _pheap_cmp);
+    s_seed = 1;
+    for (size_t i = 0; i < num; i++) {
+        bench_item_t *item = &s_items[i];
+        item->key = _next_delay();
+        _list_insert(item);
+        xf_heap_push(&s_heap, &item->key);
+        xf_pheap_insert(&s_pheap, &item->heap_node);
+    }
+
+    snprintf(title, sizeof(title), "xf_heap: pop min + push, %zu pending", num);
+    bench_section(title);
+    bench_run("sorted xf_list", _hold_list, NULL, 0);
+    bench_run("xf_heap (array)", _hold_heap, NULL, 0);
+    bench_run("xf_pheap (pairing)", _hold_pheap, NULL, 0);
+}
+
+/**
+ * @brief 定时器的典型用法: 取出最早到期的项, 以新的到期时间重新插入.
+ */
+static void _hold_list(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        bench_item_t *item = xf_list_first_entry(&s_list, bench_item_t, list_node);
+        xf_list_del(&item->list_node);
+        item->key += _next_delay();
+        _list_insert(item);
+    }
+}
+
+static void _hold_heap(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint32_t key;
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_heap_pop(&s_heap, &key);
+        key += _next_delay();
+        xf_heap_push(&s_heap, &key);
+    }
+}
+
+static void _hold_pheap(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_pheap_node_t *node = xf_pheap_pop(&s_pheap);
+        bench_item_t *item = xf_container_of(node, bench_item_t, heap_node);
+        item->key += _next_delay();
+        xf_pheap_insert(&s_pheap, node);
+    }
+}
+
+/**
+ * @brief 从头开始查找第一个更大的节点, 插入到它前面. O(n).
+ */
+static void _list_insert(bench_item_t *item)
+{
+    xf_list_t *pos;
+    xf_list_for_each(pos, &s_list) {
+        if (xf_list_entry(pos, bench_item_t, list_node)->key > item->key) {
+            break;
+        }
+    }
+    xf_list_add_tail(&item->list_node, pos);
+}
+
+static int _heap_cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int _pheap_cmp(const xf_pheap_node_t *a, const xf_pheap_node_t *b)
+{
+    uint32_t x = xf_container_of(a, bench_item_t, heap_node)->key;
+    uint32_t y = xf_container_of(b, bench_item_t, heap_node)->key;
+    return (x > y) - (x < y);
+}
+
+static uint32_t _next_delay(void)
+{
+    s_seed = s_seed * 1103515245u + 12345u;
+    return (s_seed >> 8) % 100000u;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file bench_histogram.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_histogram 性能测试.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _record(void *arg, uint64_t iters);
+static void _record_atomic(void *arg, uint64_t iters);
+static void _scope(void *arg, uint64_t iters);
+static void _percentile(void *arg, uint64_t iters);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_histogram_t s_hist;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_histogram(void)
+{
+    bench_section("xf_histogram");
+
+    xf_histogram_init(&s_hist);
+    bench_run("xf_histogram_record", _record, &s_hist, 0);
+    bench_run("xf_histogram_record_atomic", _record_atomic, &s_hist, 0);
+    xf_histogram_reset(&s_hist);
+    bench_run("XF_HISTOGRAM_SCOPE (empty block)", _scope, &s_hist, 0);
+    bench_run("xf_histogram_percentile(99.9)", _percentile, &s_hist, 0);
+    bench_printf("scope overhead: p50=%llu ns p99=%llu ns\n",
+                 (unsigned long long)xf_histogram_percentile(&s_hist, 50.0),
+                 (unsigned long long)xf_histogram_percentile(&s_hist, 99.0));
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _record(void *arg, uint64_t iters)
+{
+    xf_histogram_t *hist = (xf_histogram_t *)arg;
+    for (uint64_t i = 0; i < iters; i++) {
+        /* 值分布在多个数量级 */
+        xf_histogram_record(hist, (i * 2654435761u) >> (i & 15));
+    }
+}
+
+static void _record_atomic(void *arg, uint64_t iters)
+{
+    xf_histogram_t *hist = (xf_histogram_t *)arg;
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_histogram_record_atomic(hist, (i * 2654435761u) >> (i & 15));
+    }
+}
+
+static void _scope(void *arg, uint64_t iters)
+{
+    xf_histogram_t *hist = (xf_histogram_t *)arg;
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_HISTOGRAM_SCOPE(hist);
+        bench_keep(hist);
+    }
+}
+
+static void _percentile(void *arg, uint64_t iters)
+{
+    xf_histogram_t *hist = (xf_histogram_t *)arg;
+    for (uint64_t i = 0; i < iters; i++) {
+        uint64_t v = xf_histogram_percentile(hist, 99.9);
+        bench_keep(&v);
+    }
+}
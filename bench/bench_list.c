@@ -0,0 +1,184 @@
+/**
+ * @file bench_list.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_list 性能测试.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define NODE_NUM_MAX                    (100000)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct {
+    xf_list_t   node;
+    uint32_t    value;
+} bench_node_t;
+
+typedef struct {
+    uint32_t    distance;               /*!< 预取距离, 0 表示不预取 */
+    uint32_t    work;                   /*!< 每个节点额外的计算轮数 */
+} chase_arg_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _add_del(void *arg, uint64_t iters);
+static void _move_tail(void *arg, uint64_t iters);
+static void _iterate(void *arg, uint64_t iters);
+static void _chase(void *arg, uint64_t iters);
+static void _build(size_t num, bool shuffle);
+
+/* ==================== [Static Variables] ================================== */
+
+static XF_LIST_HEAD(s_head);
+static bench_node_t *s_nodes = NULL;
+static size_t s_node_num = 0;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_list(void)
+{
+    s_nodes = (bench_node_t *)malloc(sizeof(bench_node_t) * NODE_NUM_MAX);
+    if (NULL == s_nodes) {
+        return;
+    }
+    bench_section("xf_list");
+
+    _build(16, false);
+    bench_run("add_tail + del", _add_del, NULL, 0);
+    bench_run("move_tail (rotate)", _move_tail, NULL, 0);
+
+    /* 遍历结果按节点数归一化为 ns/node */
+    _build(1000, false);
+    bench_run("for_each_entry 1k nodes (per node)", _iterate, NULL, 1000 * 1000);
+    _build(NODE_NUM_MAX, false);
+    bench_run("for_each_entry 100k nodes (per node)", _iterate, NULL, NODE_NUM_MAX * 10);
+    _build(NODE_NUM_MAX, true);
+    bench_run("for_each_entry 100k shuffled (per node)", _iterate, NULL, NODE_NUM_MAX * 10);
+
+    /* 打乱顺序的长链表, 每一步 ->next 都可能缓存未命中; work 模拟每个节点上的处理 */
+    bench_section("xf_list: prefetch, 100k shuffled nodes (per node)");
+    static const uint32_t s_distances[] = {0, 1, 2, 4, 8, 16};
+    static const uint32_t s_works[] = {0, 16};
+    for (size_t w = 0; w < ARRAY_SIZE(s_works); w++) {
+        for (size_t d = 0; d < ARRAY_SIZE(s_distances); d++) {
+            chase_arg_t arg = {s_distances[d], s_works[w]};
+            char name[64];
+            if (0 == arg.distance) {
+                snprintf(name, sizeof(name), "for_each_entry, work %u", (unsigned)arg.work);
+            } else {
+                snprintf(name, sizeof(name), "for_each_entry_prefetch_n %u, work %u",
+                         (unsigned)arg.distance, (unsigned)arg.work);
+            }
+            bench_run(name, _chase, &arg, NODE_NUM_MAX * 2);
+        }
+    }
+
+    free(s_nodes);
+    s_nodes = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _build(size_t num, bool shuffle)
+{
+    static uint32_t s_order[NODE_NUM_MAX];
+    uint32_t seed = 1;
+
+    for (size_t i = 0; i < num; i++) {
+        s_order[i] = (uint32_t)i;
+    }
+    if (shuffle) {
+        for (size_t i = num - 1; i > 0; i--) {
+            seed = seed * 1103515245u + 12345u;
+            size_t j = (seed >> 8) % (i + 1);
+            uint32_t tmp = s_order[i];
+            s_order[i] = s_order[j];
+            s_order[j] = tmp;
+        }
+    }
+    xf_list_init(&s_head);
+    for (size_t i = 0; i < num; i++) {
+        s_nodes[s_order[i]].value = (uint32_t)i;
+        xf_list_add_tail(&s_nodes[s_order[i]].node, &s_head);
+    }
+    s_node_num = num;
+}
+
+static void _add_del(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    bench_node_t *p = &s_nodes[NODE_NUM_MAX - 1];
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_list_add_tail(&p->node, &s_head);
+        xf_list_del(&p->node);
+    }
+}
+
+static void _move_tail(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_list_rotate_left(&s_head);
+    }
+}
+
+static void _iterate(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    bench_node_t *pos;
+    uint64_t sum = 0;
+    /* iters 为遍历的节点总数, 应为节点数的整数倍 */
+    uint64_t loops = iters / s_node_num;
+    for (uint64_t i = 0; i < loops; i++) {
+        xf_list_for_each_entry(pos, &s_head, bench_node_t, node) {
+            sum += pos->value;
+        }
+    }
+    bench_keep(sum);
+}
+
+static void _chase(void *arg, uint64_t iters)
+{
+    const chase_arg_t *p_arg = (const chase_arg_t *)arg;
+    bench_node_t *pos;
+    uint64_t sum = 0;
+    uint64_t loops = iters / s_node_num;
+
+    for (uint64_t i = 0; i < loops; i++) {
+        if (0 == p_arg->distance) {
+            xf_list_for_each_entry(pos, &s_head, bench_node_t, node) {
+                uint64_t v = pos->value;
+                for (uint32_t k = 0; k < p_arg->work; k++) {
+                    v = xf_hash_u64(v);
+                }
+                sum += v;
+            }
+        } else {
+            xf_list_for_each_entry_prefetch_n(
+                pos, &s_head, bench_node_t, node, p_arg->distance) {
+                uint64_t v = pos->value;
+                for (uint32_t k = 0; k < p_arg->work; k++) {
+                    v = xf_hash_u64(v);
+                }
+                sum += v;
+            }
+        }
+    }
+    bench_keep(sum);
+}
@@ -0,0 +1,117 @@
+/**
+ * @file bench_lock.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_lock 性能测试: 单线程与多线程竞争下的上锁/解锁.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <pthread.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define THREADS_MAX                     (8)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct {
+    int         threads;
+    uint64_t    iters;
+} contended_arg_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _lock_unlock(void *arg, uint64_t iters);
+static void _trylock_unlock(void *arg, uint64_t iters);
+static void _contended(void *arg, uint64_t iters);
+static void *_contended_worker(void *arg);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_lock_t s_lock = NULL;
+static volatile uint64_t s_counter = 0;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_lock(void)
+{
+    if (XF_OK != xf_lock_init(&s_lock)) {
+        bench_printf("xf_lock not registered, skip\n");
+        return;
+    }
+    bench_section("xf_lock");
+
+    bench_run("lock + unlock", _lock_unlock, NULL, 0);
+    bench_run("trylock + unlock", _trylock_unlock, NULL, 0);
+
+    /* 竞争测试: 总操作数固定, 结果为每次操作的平均墙钟时间 */
+    static const int s_threads[] = {2, 4, 8};
+    for (size_t i = 0; i < ARRAY_SIZE(s_threads); i++) {
+        char name[48];
+        contended_arg_t arg = {.threads = s_threads[i]};
+        snprintf(name, sizeof(name), "lock + unlock, %d threads contended", s_threads[i]);
+        bench_run(name, _contended, &arg, 200000);
+    }
+
+    xf_lock_destroy(s_lock);
+    s_lock = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _lock_unlock(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_lock_lock(s_lock);
+        s_counter++;
+        xf_lock_unlock(s_lock);
+    }
+}
+
+static void _trylock_unlock(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        if (xf_lock_trylock(s_lock)) {
+            s_counter++;
+            xf_lock_unlock(s_lock);
+        }
+    }
+}
+
+static void _contended(void *arg, uint64_t iters)
+{
+    contended_arg_t *p_arg = (contended_arg_t *)arg;
+    pthread_t tid[THREADS_MAX];
+    int n = p_arg->threads;
+
+    p_arg->iters = iters / (uint64_t)n;
+    for (int i = 0; i < n; i++) {
+        pthread_create(&tid[i], NULL, _contended_worker, p_arg);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_join(tid[i], NULL);
+    }
+}
+
+static void *_contended_worker(void *arg)
+{
+    contended_arg_t *p_arg = (contended_arg_t *)arg;
+    for (uint64_t i = 0; i < p_arg->iters; i++) {
+        xf_lock_lock(s_lock);
+        s_counter++;
+        xf_lock_unlock(s_lock);
+    }
+    return NULL;
+}
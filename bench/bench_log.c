@@ -0,0 +1,173 @@
+/**
+ * @file bench_log.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_utils_log 性能测试: 日志格式化与内存输出.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _log_literal(void *arg, uint64_t iters);
+static void _log_int_str(void *arg, uint64_t iters);
+static void _log_float(void *arg, uint64_t iters);
+static void _log_verbose(void *arg, uint64_t iters);
+static void _log_kv(void *arg, uint64_t iters);
+static void _dump_mem(void *arg, uint64_t iters);
+#if XF_LOG_ROUTER_IS_ENABLE
+static void _bench_router(void);
+#endif
+#if XF_LOG_ROUTER_IS_ENABLE && XF_LOG_CRASH_IS_ENABLE
+static void _crash_write(void *arg, uint64_t iters);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+static const char *TAG = "bench";
+
+static uint8_t s_dump_buf[256];
+static size_t s_dump_size = 0;
+static uint8_t s_dump_flags = 0;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_log(void)
+{
+    bench_section("xf_utils_log (stdout -> /dev/null)");
+
+    bench_run("XF_LOGI literal", _log_literal, NULL, 0);
+    bench_run("XF_LOGI %d %s %x", _log_int_str, NULL, 0);
+    bench_run("XF_LOGI %f", _log_float, NULL, 0);
+    bench_run((XF_LOG_LEVEL >= XF_LOG_VERBOSE) ? "XF_LOGV %d" : "XF_LOGV %d (filtered)",
+              _log_verbose, NULL, 0);
+    bench_run("XF_LOGI_KV int str uint", _log_kv, NULL, 0);
+
+    for (size_t i = 0; i < sizeof(s_dump_buf); i++) {
+        s_dump_buf[i] = (uint8_t)i;
+    }
+    s_dump_size = 64;
+    s_dump_flags = XF_DUMP_FLAG_HEX_ONLY;
+    bench_run("xf_dump_mem 64B hex", _dump_mem, NULL, 0);
+    s_dump_flags = XF_DUMP_FLAG_HEX_ASCII;
+    bench_run("xf_dump_mem 64B hex+ascii", _dump_mem, NULL, 0);
+    s_dump_size = 256;
+    bench_run("xf_dump_mem 256B hex+ascii", _dump_mem, NULL, 0);
+    s_dump_flags = XF_DUMP_FLAG_HEX_ASCII_ESCAPE;
+    bench_run("xf_dump_mem 256B hex+ascii+escape", _dump_mem, NULL, 0);
+
+#if XF_LOG_ROUTER_IS_ENABLE
+    _bench_router();
+#endif
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _log_literal(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_LOGI(TAG, "connection established");
+    }
+}
+
+static void _log_int_str(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_LOGI(TAG, "id: %d, peer: %s, flags: 0x%08x", (int)i, "10.0.0.1", (unsigned)i);
+    }
+}
+
+static void _log_float(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_LOGI(TAG, "value: %f", (double)i * 0.5);
+    }
+}
+
+static void _log_verbose(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_LOGV(TAG, "id: %d", (int)i);
+        bench_keep(i);
+    }
+}
+
+static void _log_kv(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_LOGI_KV(TAG, "connection established", XF_KV_INT("id", i),
+                   XF_KV_STR("peer", "10.0.0.1"), XF_KV_UINT("flags", i));
+    }
+}
+
+static void _dump_mem(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_dump_mem(s_dump_buf, s_dump_size, s_dump_flags);
+    }
+}
+
+#if XF_LOG_ROUTER_IS_ENABLE
+/**
+ * @brief 在 port_xf_log_sink() 的 stdout sink 基础上增加 sink, 对比分发开销.
+ */
+static void _bench_router(void)
+{
+    static char ring_buf[16 * 1024];
+    static char batch_buf[4096];
+    static xf_log_sink_ring_t ring;
+
+    bench_section("xf_log_router");
+
+    xf_log_sink_ring_init(&ring, ring_buf, sizeof(ring_buf), XF_LOG_VERBOSE);
+    xf_log_router_add(&ring.sink);
+    bench_run("XF_LOGI -> stdout + ring", _log_int_str, NULL, 0);
+
+    xf_log_sink_set_level(&ring.sink, XF_LOG_WARN);
+    bench_run("XF_LOGI -> stdout (ring at WARN)", _log_int_str, NULL, 0);
+
+    xf_log_router_remove(&ring.sink);
+    xf_log_sink_set_batch(&ring.sink, batch_buf, sizeof(batch_buf), XF_LOG_ERROR);
+    xf_log_sink_set_level(&ring.sink, XF_LOG_VERBOSE);
+    xf_log_router_add(&ring.sink);
+    bench_run("XF_LOGI -> stdout + ring (4K batch)", _log_int_str, NULL, 0);
+    xf_log_router_remove(&ring.sink);
+
+#if XF_LOG_CRASH_IS_ENABLE
+    /* 崩溃日志环 sink 加入后不再移出, 放在最后 */
+    xf_log_crash_init();
+    bench_run("XF_LOGI -> stdout + crash ring", _log_int_str, NULL, 0);
+    bench_run("xf_log_crash_write 100B", _crash_write, NULL, 0);
+#endif
+}
+#endif
+
+#if XF_LOG_ROUTER_IS_ENABLE && XF_LOG_CRASH_IS_ENABLE
+static void _crash_write(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    static const char line[100] = "I (123456)-bench[:42(_crash_write)]: crash ring payload\n";
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_log_crash_write(line, sizeof(line));
+    }
+}
+#endif
@@ -0,0 +1,157 @@
+/**
+ * @file bench_log_file.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 日志写文件吞吐量: stdio 与 port_xf_log_async_file 对比.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "xf_utils.h"
+#include "port_xf_log_async_file.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 每个测试项写入的总字节数 */
+#define TOTAL_BYTES                     (64u * 1024u * 1024u)
+/* 组提交测试项的同步间隔 */
+#define SYNC_BYTES                      (4u * 1024u * 1024u)
+
+#define LINE_FMT \
+    "I (%u)-bench: request done, id=%u status=%d elapsed=%uus payload=0123456789abcdef\n"
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef enum {
+    MODE_STDIO = 0,             /*!< fprintf, stdio 全缓冲 */
+    MODE_STDIO_FLUSH,           /*!< fprintf + fflush, 即行缓冲时每行一次 write() */
+    MODE_STDIO_SYNC,            /*!< fprintf, 每 SYNC_BYTES 字节 fflush + fdatasync */
+} stdio_mode_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+#if XF_LOG_ROUTER_IS_ENABLE
+static void _run_stdio(const char *name, stdio_mode_t mode);
+static void _run_async(const char *name, size_t fsync_bytes);
+static void _report(const char *name, uint64_t bytes, uint32_t lines, uint64_t ns,
+                    const char *extra);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+#if XF_LOG_ROUTER_IS_ENABLE
+static char s_path[256];
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_log_file(void)
+{
+#if XF_LOG_ROUTER_IS_ENABLE
+    const char *dir = getenv("TMPDIR");
+    snprintf(s_path, sizeof(s_path), "%s/xf_bench_log_file.log", dir ? dir : "/tmp");
+    bench_printf("\n== log to file: %u MiB of ~100 B lines, %s ==\n",
+                 TOTAL_BYTES >> 20, s_path);
+
+    _run_stdio("stdio fprintf", MODE_STDIO);
+    _run_stdio("stdio fprintf + fflush/line", MODE_STDIO_FLUSH);
+    _run_async("async_file", 0);
+    _run_stdio("stdio + fdatasync/4MiB", MODE_STDIO_SYNC);
+    _run_async("async_file + fdatasync/4MiB", SYNC_BYTES);
+
+    unlink(s_path);
+#endif
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#if XF_LOG_ROUTER_IS_ENABLE
+
+static void _run_stdio(const char *name, stdio_mode_t mode)
+{
+    uint64_t bytes = 0;
+    uint64_t unsynced = 0;
+    uint32_t i = 0;
+
+    unlink(s_path);
+    FILE *fp = fopen(s_path, "w");
+    if (NULL == fp) {
+        return;
+    }
+    uint64_t t0 = bench_now_ns();
+    while (bytes < TOTAL_BYTES) {
+        int n = fprintf(fp, LINE_FMT, i, i * 7u, 0, i & 1023u);
+        i++;
+        bytes += (uint64_t)n;
+        if (MODE_STDIO_FLUSH == mode) {
+            fflush(fp);
+        } else if (MODE_STDIO_SYNC == mode) {
+            unsynced += (uint64_t)n;
+            if (unsynced >= SYNC_BYTES) {
+                fflush(fp);
+                fdatasync(fileno(fp));
+                unsynced = 0;
+            }
+        }
+    }
+    if (MODE_STDIO_SYNC == mode) {
+        fflush(fp);
+        fdatasync(fileno(fp));
+    }
+    fclose(fp);
+    uint64_t t1 = bench_now_ns();
+    _report(name, bytes, i, t1 - t0, "");
+}
+
+static void _run_async(const char *name, size_t fsync_bytes)
+{
+    static port_xf_log_async_file_t s_af;
+    port_xf_log_async_file_cfg_t cfg = PORT_XF_LOG_ASYNC_FILE_CFG_DEFAULT(s_path);
+    char line[128];
+    char extra[96];
+    uint64_t bytes = 0;
+    uint32_t i = 0;
+
+    cfg.fsync_bytes = fsync_bytes;
+    cfg.fsync_interval_ms = 0;
+    cfg.rotate_bytes = 0;
+    unlink(s_path);
+    if (XF_OK != port_xf_log_async_file_open(&s_af, &cfg, XF_LOG_VERBOSE)) {
+        return;
+    }
+    /* 直接调用 sink 的写出回调, 不经过路由的其他 sink */
+    uint64_t t0 = bench_now_ns();
+    while (bytes < TOTAL_BYTES) {
+        int n = snprintf(line, sizeof(line), LINE_FMT, i, i * 7u, 0, i & 1023u);
+        i++;
+        s_af.sink.write(&s_af.sink, line, (size_t)n);
+        bytes += (uint64_t)n;
+    }
+    port_xf_log_async_file_close(&s_af);
+    uint64_t t1 = bench_now_ns();
+    snprintf(extra, sizeof(extra), " (writev %llu, fdatasync %llu, waits %llu)",
+             (unsigned long long)s_af.writev_calls, (unsigned long long)s_af.fsync_calls,
+             (unsigned long long)s_af.waits);
+    _report(name, bytes, i, t1 - t0, extra);
+}
+
+static void _report(const char *name, uint64_t bytes, uint32_t lines, uint64_t ns,
+                    const char *extra)
+{
+    bench_printf("%-32s %8.1f MB/s %8.1f ns/line%s\n", name,
+                 (double)bytes / 1e6 / ((double)ns / 1e9),
+                 (double)ns / lines, extra);
+}
+
+#endif /* XF_LOG_ROUTER_IS_ENABLE */
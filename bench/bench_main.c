@@ -0,0 +1,65 @@
+/**
+ * @file bench_main.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_utils 性能测试入口.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils.h"
+#include "port_xf_lock.h"
+#include "port_xf_time.h"
+#include "port_xf_thread.h"
+#include "port_xf_log_sink.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int main(void)
+{
+    port_xf_lock();
+    port_xf_time();
+    port_xf_thread();
+    port_xf_log_sink();
+    bench_init();
+
+    bench_err();
+    bench_list();
+    bench_vec();
+    bench_heap();
+    bench_hashmap();
+    bench_crc();
+    bench_skiplist();
+    bench_rcu();
+    bench_clist();
+    bench_threadpool();
+    bench_lock();
+    bench_log();
+    bench_log_file();
+    bench_time();
+    bench_stdio();
+    bench_string();
+    bench_strbuf();
+    bench_histogram();
+    bench_trace();
+    bench_timer_wheel();
+
+    return 0;
+}
+
+/* ==================== [Static Functions] ================================== */
@@ -0,0 +1,259 @@
+/**
+ * @file bench_rcu.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 读多写少的 xf_list: xf_lock 保护与 RCU 变体 + xf_epoch 对比.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define KEY_NUM                         (64)
+#define THREADS_MAX                     (8)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef enum {
+    MODE_LOCKED = 0,                    /*!< 读者也加 xf_lock */
+    MODE_RCU_EPOCH,                     /*!< 读者每次查找 xf_epoch_enter() / exit() */
+    MODE_RCU_QSBR,                      /*!< 读者常驻临界区, 每次查找后 xf_epoch_quiescent() */
+} bench_mode_t;
+
+typedef struct {
+    uint32_t            key;
+    uint32_t            value;
+    xf_list_t           node;
+    xf_epoch_entry_t    retire;
+} bench_item_t;
+
+typedef struct {
+    bench_mode_t    mode;
+    int             threads;
+    uint64_t        iters;
+    volatile int    done;
+} read_arg_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _single(void *arg, uint64_t iters);
+static void _contended(void *arg, uint64_t iters);
+static void *_reader(void *arg);
+static void *_writer(void *arg);
+static uint32_t _read_loop(bench_mode_t mode, uint64_t iters, uint32_t seed);
+static uint32_t _lookup(uint32_t key);
+static void _replace_one(bench_mode_t mode, uint32_t *seed);
+static bench_item_t *_new_item(uint32_t key);
+static void _free_cb(xf_epoch_entry_t *entry);
+static uint32_t _rand(uint32_t *seed);
+
+/* ==================== [Static Variables] ================================== */
+
+static XF_LIST_HEAD(s_list);
+static xf_epoch_t s_ep;
+static xf_lock_t s_lock = NULL;
+
+static const char *const s_mode_names[] = {
+    "xf_lock + xf_list",
+    "xf_list_*_rcu + epoch enter/exit",
+    "xf_list_*_rcu + epoch quiescent",
+};
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_rcu(void)
+{
+    if (XF_OK != xf_lock_init(&s_lock)) {
+        bench_printf("xf_lock not registered, skip\n");
+        return;
+    }
+    xf_epoch_init(&s_ep, true);
+    for (uint32_t i = 0; i < KEY_NUM; i++) {
+        xf_list_add_tail_rcu(&_new_item(i)->node, &s_list);
+    }
+
+    bench_section("xf_list rcu: lookup, 64 entries, 1 thread");
+    for (int m = MODE_LOCKED; m <= MODE_RCU_QSBR; m++) {
+        read_arg_t arg = {.mode = (bench_mode_t)m};
+        bench_run(s_mode_names[m], _single, &arg, 0);
+    }
+
+    /* 读者总查找次数固定, 同时有一个写者不断替换节点; 结果为每次查找的平均墙钟时间 */
+    static const int s_threads[] = {1, 2, 4, 8};
+    for (size_t i = 0; i < ARRAY_SIZE(s_threads); i++) {
+        char title[64];
+        snprintf(title, sizeof(title),
+                 "xf_list rcu: lookup, %d readers + 1 writer", s_threads[i]);
+        bench_section(title);
+        for (int m = MODE_LOCKED; m <= MODE_RCU_QSBR; m++) {
+            read_arg_t arg = {.mode = (bench_mode_t)m, .threads = s_threads[i]};
+            bench_run(s_mode_names[m], _contended, &arg, 400000);
+        }
+    }
+
+    bench_item_t *item;
+    bench_item_t *n;
+    xf_list_for_each_entry_safe(item, n, &s_list, bench_item_t, node) {
+        xf_list_del(&item->node);
+        free(item);
+    }
+    xf_epoch_deinit(&s_ep);
+    xf_lock_destroy(s_lock);
+    s_lock = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _single(void *arg, uint64_t iters)
+{
+    read_arg_t *p_arg = (read_arg_t *)arg;
+    bench_keep(_read_loop(p_arg->mode, iters, 1));
+}
+
+static void _contended(void *arg, uint64_t iters)
+{
+    read_arg_t *p_arg = (read_arg_t *)arg;
+    pthread_t tid[THREADS_MAX];
+    pthread_t writer;
+    int n = p_arg->threads;
+
+    p_arg->iters = iters / (uint64_t)n;
+    p_arg->done = 0;
+    pthread_create(&writer, NULL, _writer, p_arg);
+    for (int i = 0; i < n; i++) {
+        pthread_create(&tid[i], NULL, _reader, p_arg);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_join(tid[i], NULL);
+    }
+    p_arg->done = 1;
+    pthread_join(writer, NULL);
+}
+
+static void *_reader(void *arg)
+{
+    read_arg_t *p_arg = (read_arg_t *)arg;
+    bench_keep(_read_loop(p_arg->mode, p_arg->iters, (uint32_t)(uintptr_t)&arg));
+    return NULL;
+}
+
+static void *_writer(void *arg)
+{
+    read_arg_t *p_arg = (read_arg_t *)arg;
+    uint32_t seed = 12345;
+    while (!p_arg->done) {
+        _replace_one(p_arg->mode, &seed);
+    }
+    return NULL;
+}
+
+static uint32_t _read_loop(bench_mode_t mode, uint64_t iters, uint32_t seed)
+{
+    xf_epoch_record_t rec;
+    uint32_t sum = 0;
+
+    xf_epoch_register(&s_ep, &rec);
+    switch (mode) {
+    case MODE_LOCKED:
+        for (uint64_t i = 0; i < iters; i++) {
+            xf_lock_lock(s_lock);
+            sum += _lookup(_rand(&seed) % KEY_NUM);
+            xf_lock_unlock(s_lock);
+        }
+        break;
+    case MODE_RCU_EPOCH:
+        for (uint64_t i = 0; i < iters; i++) {
+            xf_epoch_enter(&s_ep, &rec);
+            sum += _lookup(_rand(&seed) % KEY_NUM);
+            xf_epoch_exit(&rec);
+        }
+        break;
+    case MODE_RCU_QSBR:
+    default:
+        xf_epoch_enter(&s_ep, &rec);
+        for (uint64_t i = 0; i < iters; i++) {
+            sum += _lookup(_rand(&seed) % KEY_NUM);
+            xf_epoch_quiescent(&s_ep, &rec);
+        }
+        xf_epoch_exit(&rec);
+        break;
+    }
+    xf_epoch_unregister(&s_ep, &rec);
+    return sum;
+}
+
+/**
+ * @brief 按键线性查找. 加锁模式下与 RCU 模式使用同一遍历宏, 只比较同步开销.
+ */
+static uint32_t _lookup(uint32_t key)
+{
+    bench_item_t *item;
+    xf_list_for_each_entry_rcu(item, &s_list, bench_item_t, node) {
+        if (item->key == key) {
+            return item->value;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 以新节点替换一个随机的键, 节点总数不变.
+ */
+static void _replace_one(bench_mode_t mode, uint32_t *seed)
+{
+    uint32_t key = _rand(seed) % KEY_NUM;
+    bench_item_t *fresh = _new_item(key);
+    bench_item_t *item = NULL;
+    bench_item_t *pos;
+
+    xf_lock_lock(s_lock);
+    xf_list_for_each_entry(pos, &s_list, bench_item_t, node) {
+        if (pos->key == key) {
+            item = pos;
+            break;
+        }
+    }
+    xf_list_replace_rcu(&item->node, &fresh->node);
+    xf_lock_unlock(s_lock);
+
+    if (MODE_LOCKED == mode) {
+        free(item);
+    } else {
+        xf_epoch_retire(&s_ep, &item->retire, _free_cb);
+    }
+}
+
+static bench_item_t *_new_item(uint32_t key)
+{
+    bench_item_t *item = (bench_item_t *)malloc(sizeof(bench_item_t));
+    if (NULL == item) {
+        abort();
+    }
+    item->key = key;
+    item->value = key + 1;
+    return item;
+}
+
+static void _free_cb(xf_epoch_entry_t *entry)
+{
+    free(xf_container_of(entry, bench_item_t, retire));
+}
+
+static uint32_t _rand(uint32_t *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
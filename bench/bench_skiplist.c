@@ -0,0 +1,278 @@
+/**
+ * @file bench_skiplist.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_skiplist 查找: 无锁读者 + xf_epoch 与 xf_lock 保护的跳表/有序 xf_list 对比.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define KEY_NUM                         (1000)
+#define THREADS_MAX                     (8)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef enum {
+    MODE_LIST_LOCKED = 0,               /*!< xf_lock + 有序 xf_list */
+    MODE_SKIPLIST_LOCKED,               /*!< 读者也加 xf_lock 的跳表 */
+    MODE_SKIPLIST_EPOCH,                /*!< 读者无锁, 写者通过 xf_epoch 延迟释放 */
+} bench_mode_t;
+
+typedef struct {
+    uint32_t            key;
+    xf_list_t           list_node;
+    xf_epoch_entry_t    retire;
+    xf_skiplist_node_t  node;           /* 必须是最后一个成员 */
+} bench_item_t;
+
+typedef struct {
+    bench_mode_t    mode;
+    int             threads;
+    uint64_t        iters;
+    volatile int    done;
+} read_arg_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _single(void *arg, uint64_t iters);
+static void _contended(void *arg, uint64_t iters);
+static void *_reader(void *arg);
+static void *_writer(void *arg);
+static uint32_t _lookup(bench_mode_t mode, uint32_t key, xf_epoch_record_t *rec);
+static void _replace_one(bench_mode_t mode, uint32_t *seed);
+static bench_item_t *_new_item(uint32_t key);
+static void _free_cb(xf_epoch_entry_t *entry);
+static int _cmp(const xf_skiplist_node_t *node, const void *key);
+static uint32_t _rand(uint32_t *seed);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_skiplist_t s_sl;
+static XF_LIST_HEAD(s_list);
+static xf_epoch_t s_ep;
+static xf_lock_t s_lock = NULL;
+
+static const char *const s_mode_names[] = {
+    "xf_lock + sorted xf_list",
+    "xf_lock + xf_skiplist",
+    "xf_skiplist + xf_epoch",
+};
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_skiplist(void)
+{
+    if (XF_OK != xf_lock_init(&s_lock)) {
+        bench_printf("xf_lock not registered, skip\n");
+        return;
+    }
+    xf_skiplist_init(&s_sl, _cmp, true);
+    xf_epoch_init(&s_ep, true);
+    for (uint32_t i = 0; i < KEY_NUM; i++) {
+        bench_item_t *item = _new_item(i * 2);
+        xf_skiplist_insert(&s_sl, &item->node, &item->key);
+        xf_list_add_tail(&item->list_node, &s_list);
+    }
+
+    bench_section("xf_skiplist: lookup, 1000 keys, 1 thread");
+    for (int m = MODE_LIST_LOCKED; m <= MODE_SKIPLIST_EPOCH; m++) {
+        read_arg_t arg = {.mode = (bench_mode_t)m};
+        bench_run(s_mode_names[m], _single, &arg, 0);
+    }
+
+    /* 读者总查找次数固定, 同时有一个写者不断删除、插入; 结果为每次查找的平均墙钟时间 */
+    static const int s_threads[] = {1, 2, 4, 8};
+    for (size_t i = 0; i < ARRAY_SIZE(s_threads); i++) {
+        char title[64];
+        snprintf(title, sizeof(title),
+                 "xf_skiplist: lookup, %d readers + 1 writer", s_threads[i]);
+        bench_section(title);
+        for (int m = MODE_LIST_LOCKED; m <= MODE_SKIPLIST_EPOCH; m++) {
+            read_arg_t arg = {.mode = (bench_mode_t)m, .threads = s_threads[i]};
+            bench_run(s_mode_names[m], _contended, &arg, 200000);
+        }
+    }
+
+    bench_item_t *item;
+    bench_item_t *n;
+    xf_list_for_each_entry_safe(item, n, &s_list, bench_item_t, list_node) {
+        xf_list_del(&item->list_node);
+        free(item);
+    }
+    xf_skiplist_deinit(&s_sl);
+    xf_epoch_deinit(&s_ep);
+    xf_lock_destroy(s_lock);
+    s_lock = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _single(void *arg, uint64_t iters)
+{
+    read_arg_t *p_arg = (read_arg_t *)arg;
+    xf_epoch_record_t rec;
+    uint32_t seed = 1;
+    uint32_t sum = 0;
+
+    xf_epoch_register(&s_ep, &rec);
+    for (uint64_t i = 0; i < iters; i++) {
+        sum += _lookup(p_arg->mode, _rand(&seed) % (KEY_NUM * 2), &rec);
+    }
+    xf_epoch_unregister(&s_ep, &rec);
+    bench_keep(sum);
+}
+
+static void _contended(void *arg, uint64_t iters)
+{
+    read_arg_t *p_arg = (read_arg_t *)arg;
+    pthread_t tid[THREADS_MAX];
+    pthread_t writer;
+    int n = p_arg->threads;
+
+    p_arg->iters = iters / (uint64_t)n;
+    p_arg->done = 0;
+    pthread_create(&writer, NULL, _writer, p_arg);
+    for (int i = 0; i < n; i++) {
+        pthread_create(&tid[i], NULL, _reader, p_arg);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_join(tid[i], NULL);
+    }
+    p_arg->done = 1;
+    pthread_join(writer, NULL);
+}
+
+static void *_reader(void *arg)
+{
+    read_arg_t *p_arg = (read_arg_t *)arg;
+    xf_epoch_record_t rec;
+    uint32_t seed = (uint32_t)(uintptr_t)&rec;
+    uint32_t sum = 0;
+
+    xf_epoch_register(&s_ep, &rec);
+    for (uint64_t i = 0; i < p_arg->iters; i++) {
+        sum += _lookup(p_arg->mode, _rand(&seed) % (KEY_NUM * 2), &rec);
+    }
+    xf_epoch_unregister(&s_ep, &rec);
+    bench_keep(sum);
+    return NULL;
+}
+
+static void *_writer(void *arg)
+{
+    read_arg_t *p_arg = (read_arg_t *)arg;
+    uint32_t seed = 12345;
+    while (!p_arg->done) {
+        _replace_one(p_arg->mode, &seed);
+    }
+    return NULL;
+}
+
+static uint32_t _lookup(bench_mode_t mode, uint32_t key, xf_epoch_record_t *rec)
+{
+    uint32_t found = 0;
+    bench_item_t *item;
+    xf_skiplist_node_t *node;
+
+    switch (mode) {
+    case MODE_LIST_LOCKED:
+        xf_lock_lock(s_lock);
+        xf_list_for_each_entry(item, &s_list, bench_item_t, list_node) {
+            if (item->key >= key) {
+                found = (item->key == key);
+                break;
+            }
+        }
+        xf_lock_unlock(s_lock);
+        break;
+    case MODE_SKIPLIST_LOCKED:
+        xf_lock_lock(s_lock);
+        found = (NULL != xf_skiplist_find(&s_sl, &key));
+        xf_lock_unlock(s_lock);
+        break;
+    case MODE_SKIPLIST_EPOCH:
+    default:
+        xf_epoch_enter(&s_ep, rec);
+        node = xf_skiplist_find(&s_sl, &key);
+        found = (NULL != node);
+        xf_epoch_exit(rec);
+        break;
+    }
+    return found;
+}
+
+/**
+ * @brief 删除一个随机的键并以新节点重新插入, 节点总数不变.
+ */
+static void _replace_one(bench_mode_t mode, uint32_t *seed)
+{
+    uint32_t key = (_rand(seed) % KEY_NUM) * 2;
+    bench_item_t *item;
+    bench_item_t *fresh = _new_item(key);
+
+    if (MODE_SKIPLIST_EPOCH == mode) {
+        xf_skiplist_node_t *node = xf_skiplist_find(&s_sl, &key);
+        item = xf_container_of(node, bench_item_t, node);
+        xf_skiplist_remove(&s_sl, node, &key);
+        xf_skiplist_insert(&s_sl, &fresh->node, &fresh->key);
+        /* 无锁读者可能仍在访问, 等到宽限期之后再释放; 有序链表同样需要替换 */
+        xf_lock_lock(s_lock);
+        xf_list_replace(&item->list_node, &fresh->list_node);
+        xf_lock_unlock(s_lock);
+        xf_epoch_retire(&s_ep, &item->retire, _free_cb);
+        return;
+    }
+    xf_lock_lock(s_lock);
+    item = xf_container_of(xf_skiplist_find(&s_sl, &key), bench_item_t, node);
+    xf_skiplist_remove(&s_sl, &item->node, &key);
+    xf_skiplist_insert(&s_sl, &fresh->node, &fresh->key);
+    xf_list_replace(&item->list_node, &fresh->list_node);
+    xf_lock_unlock(s_lock);
+    free(item);
+}
+
+static bench_item_t *_new_item(uint32_t key)
+{
+    uint32_t level = xf_skiplist_random_level(&s_sl);
+    bench_item_t *item = (bench_item_t *)malloc(
+                             sizeof(bench_item_t) + XF_SKIPLIST_NODE_EXTRA_SIZE(level));
+    if (NULL == item) {
+        abort();
+    }
+    item->key = key;
+    xf_skiplist_node_init(&item->node, level);
+    return item;
+}
+
+static void _free_cb(xf_epoch_entry_t *entry)
+{
+    free(xf_container_of(entry, bench_item_t, retire));
+}
+
+static int _cmp(const xf_skiplist_node_t *node, const void *key)
+{
+    uint32_t a = xf_container_of(node, bench_item_t, node)->key;
+    uint32_t b = *(const uint32_t *)key;
+    return (a > b) - (a < b);
+}
+
+static uint32_t _rand(uint32_t *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
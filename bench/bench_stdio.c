@@ -0,0 +1,354 @@
+/**
+ * @file bench_stdio.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_builtin_snprintf 与 C 库 snprintf 对比, 整数与字符串转换.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define FLOAT_CHECK_NUM                 (100000)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef int (*snprintf_fn_t)(char *buf, size_t size, const char *format, ...);
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _conv_snprintf_u32(void *arg, uint64_t iters);
+static void _conv_utoa(void *arg, uint64_t iters);
+static void _conv_snprintf_u64(void *arg, uint64_t iters);
+static void _conv_u64toa(void *arg, uint64_t iters);
+static void _conv_sscanf(void *arg, uint64_t iters);
+static void _conv_strtoul(void *arg, uint64_t iters);
+static void _conv_atou(void *arg, uint64_t iters);
+static void _conv_strtoul_hex(void *arg, uint64_t iters);
+static void _conv_hextou(void *arg, uint64_t iters);
+#if XF_STDIO_BUILTIN_PRINTF_IS_ENABLE
+static void _run_pair(const char *name, bench_fn_t fn);
+static void _fmt_int(void *arg, uint64_t iters);
+static void _fmt_uint_hex(void *arg, uint64_t iters);
+static void _fmt_str_int(void *arg, uint64_t iters);
+static void _fmt_pad_hex(void *arg, uint64_t iters);
+static void _fmt_log_prefix(void *arg, uint64_t iters);
+static void _fmt_int64(void *arg, uint64_t iters);
+static void _fmt_ptr(void *arg, uint64_t iters);
+static void _fmt_float_f(void *arg, uint64_t iters);
+static void _fmt_float_g(void *arg, uint64_t iters);
+static void _fmt_float_g17(void *arg, uint64_t iters);
+#if XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE
+static void _check_float(void);
+#endif
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+static char s_buf[128];
+/* 防止编译器把参数当作常量折叠 */
+static volatile int s_seed = 123456;
+
+static const char *const s_dec_strs[] = {"7", "1234", "65535", "3000000000", "42"};
+static const char *const s_hex_strs[] = {"0x7", "deadbeef", "0xFFFF", "1a2b3c", "0x42"};
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_stdio(void)
+{
+    bench_section("xf_stdlib: integer <-> string");
+    bench_run("snprintf \"%u\"", _conv_snprintf_u32, NULL, 0);
+    bench_run("xf_utoa", _conv_utoa, NULL, 0);
+    bench_run("snprintf \"%llu\" (20 digits)", _conv_snprintf_u64, NULL, 0);
+    bench_run("xf_u64toa (20 digits)", _conv_u64toa, NULL, 0);
+    bench_run("sscanf \"%u\"", _conv_sscanf, NULL, 0);
+    bench_run("strtoul base 10", _conv_strtoul, NULL, 0);
+    bench_run("xf_atou", _conv_atou, NULL, 0);
+    bench_run("strtoul base 16", _conv_strtoul_hex, NULL, 0);
+    bench_run("xf_hextou", _conv_hextou, NULL, 0);
+
+#if XF_STDIO_BUILTIN_PRINTF_IS_ENABLE
+    bench_section("xf_builtin_snprintf vs C library snprintf");
+
+    _run_pair("\"%d\"", _fmt_int);
+    _run_pair("\"%u %x\"", _fmt_uint_hex);
+    _run_pair("\"%s=%d\"", _fmt_str_int);
+    _run_pair("\"%08x\"", _fmt_pad_hex);
+    _run_pair("log prefix", _fmt_log_prefix);
+    _run_pair("\"%lld\"", _fmt_int64);
+    _run_pair("\"%p\"", _fmt_ptr);
+    _run_pair("\"%.3f\"", _fmt_float_f);
+    _run_pair("\"%.9g\"", _fmt_float_g);
+    _run_pair("\"%.17g\"", _fmt_float_g17);
+#if XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE
+    _check_float();
+#endif
+#endif
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _conv_snprintf_u32(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    unsigned v = (unsigned)s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        snprintf(s_buf, sizeof(s_buf), "%u", v * (unsigned)i);
+        bench_keep(s_buf);
+    }
+}
+
+static void _conv_utoa(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    unsigned v = (unsigned)s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_utoa(v * (unsigned)i, s_buf);
+        bench_keep(s_buf);
+    }
+}
+
+static void _conv_snprintf_u64(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        snprintf(s_buf, sizeof(s_buf), "%llu", (unsigned long long)(~0ULL - i));
+        bench_keep(s_buf);
+    }
+}
+
+static void _conv_u64toa(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_u64toa(~0ULL - i, s_buf);
+        bench_keep(s_buf);
+    }
+}
+
+static void _conv_sscanf(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    unsigned v = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        sscanf(s_dec_strs[i % ARRAY_SIZE(s_dec_strs)], "%u", &v);
+        bench_keep(&v);
+    }
+}
+
+static void _conv_strtoul(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        unsigned long v = strtoul(s_dec_strs[i % ARRAY_SIZE(s_dec_strs)], NULL, 10);
+        bench_keep(&v);
+    }
+}
+
+static void _conv_atou(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint32_t v = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_atou(s_dec_strs[i % ARRAY_SIZE(s_dec_strs)], SIZE_MAX, &v);
+        bench_keep(&v);
+    }
+}
+
+static void _conv_strtoul_hex(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        unsigned long v = strtoul(s_hex_strs[i % ARRAY_SIZE(s_hex_strs)], NULL, 16);
+        bench_keep(&v);
+    }
+}
+
+static void _conv_hextou(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint32_t v = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_hextou(s_hex_strs[i % ARRAY_SIZE(s_hex_strs)], SIZE_MAX, &v);
+        bench_keep(&v);
+    }
+}
+
+#if XF_STDIO_BUILTIN_PRINTF_IS_ENABLE
+
+static void _run_pair(const char *name, bench_fn_t fn)
+{
+    char title[64];
+
+    snprintf(title, sizeof(title), "snprintf %s", name);
+    bench_run(title, fn, (void *)snprintf, 0);
+    snprintf(title, sizeof(title), "xf_builtin %s", name);
+    bench_run(title, fn, (void *)xf_builtin_snprintf, 0);
+}
+
+static void _fmt_int(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    int v = s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%d", v + (int)i);
+        bench_keep(s_buf);
+    }
+}
+
+static void _fmt_uint_hex(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    unsigned v = (unsigned)s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%u %x", v + (unsigned)i, v ^ (unsigned)i);
+        bench_keep(s_buf);
+    }
+}
+
+static void _fmt_str_int(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    int v = s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%s=%d", "temperature", v - (int)i);
+        bench_keep(s_buf);
+    }
+}
+
+static void _fmt_pad_hex(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    unsigned v = (unsigned)s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%08x", v + (unsigned)i);
+        bench_keep(s_buf);
+    }
+}
+
+/**
+ * @brief 与默认日志前缀 XF_LOG_PREFIX_FMT 相同的格式.
+ */
+static void _fmt_log_prefix(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    unsigned long ts = (unsigned long)s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%c (%lu)-%s[:%d(%s)]: value %d\n",
+           'I', ts + (unsigned long)i, "bench", 123, "_fmt_log_prefix", (int)i);
+        bench_keep(s_buf);
+    }
+}
+
+static void _fmt_int64(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    long long v = (long long)s_seed * -1000000007LL;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%lld", v - (long long)i);
+        bench_keep(s_buf);
+    }
+}
+
+static void _fmt_ptr(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%p", (void *)(s_buf + (i & 63)));
+        bench_keep(s_buf);
+    }
+}
+
+static void _fmt_float_f(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    double v = (double)s_seed / 7.0;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%.3f", v + (double)i);
+        bench_keep(s_buf);
+    }
+}
+
+static void _fmt_float_g(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    double v = (double)s_seed / 7.0;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%.9g", v * (double)(i + 1));
+        bench_keep(s_buf);
+    }
+}
+
+static void _fmt_float_g17(void *arg, uint64_t iters)
+{
+    snprintf_fn_t fn = (snprintf_fn_t)arg;
+    double v = (double)s_seed / 7.0;
+    for (uint64_t i = 0; i < iters; i++) {
+        fn(s_buf, sizeof(s_buf), "%.17g", v * (double)(i + 1));
+        bench_keep(s_buf);
+    }
+}
+
+#if XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE
+/**
+ * @brief 随机 double（全范围的位模式, 以及 [1e-7, 0.1) 内的值）:
+ *        "%.17g" 必须能被 strtod() 还原, 不超过 17 位有效数字的输出必须与 C 库一致.
+ */
+static void _check_float(void)
+{
+    static const char *const s_fmts[] = {"%.17g", "%.16e", "%.6e", "%.12f"};
+    char ref[sizeof(s_buf)];
+    uint64_t x = 0x9e3779b97f4a7c15ULL;
+    uint32_t bad_rt = 0;
+    uint32_t bad_fmt = 0;
+
+    for (uint32_t i = 0; i < FLOAT_CHECK_NUM; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        double v;
+        if (i & 1) {
+            /* 1e-7 * 2^[0, 20) */
+            v = (1.0 + (double)(x >> 12) / 4503599627370496.0) * 1e-7;
+            v *= (double)(1UL << ((x & 0xff) % 20));
+        } else {
+            memcpy(&v, &x, sizeof(v));
+            if ((v != v) || (v - v != 0.0)) {
+                continue;
+            }
+        }
+        xf_builtin_snprintf(s_buf, sizeof(s_buf), "%.17g", v);
+        if (strtod(s_buf, NULL) != v) {
+            bad_rt++;
+        }
+        for (size_t f = 0; f < ARRAY_SIZE(s_fmts); f++) {
+            /* "%.12f" 只在有效数字不超过 17 位时比较 */
+            if ((3 == f) && ((v >= 1e5) || (v <= -1e5))) {
+                continue;
+            }
+            snprintf(ref, sizeof(ref), s_fmts[f], v);
+            xf_builtin_snprintf(s_buf, sizeof(s_buf), s_fmts[f], v);
+            if (0 != strcmp(ref, s_buf)) {
+                bad_fmt++;
+            }
+        }
+    }
+    bench_printf("float check: %u values, %u round-trip failures, %u differ from C library\n",
+                 (unsigned)FLOAT_CHECK_NUM, (unsigned)bad_rt, (unsigned)bad_fmt);
+}
+#endif
+
+#endif /* XF_STDIO_BUILTIN_PRINTF_IS_ENABLE */
@@ -0,0 +1,189 @@
+/**
+ * @file bench_strbuf.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_strbuf 与手动 snprintf 偏移拼接、每次 malloc 的拼接对比.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define HEX_BYTES                       (256)
+#define LONG_FIELDS                     (128)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _short_snprintf(void *arg, uint64_t iters);
+static void _short_malloc(void *arg, uint64_t iters);
+static void _short_strbuf(void *arg, uint64_t iters);
+static void _hex_snprintf(void *arg, uint64_t iters);
+static void _hex_strbuf(void *arg, uint64_t iters);
+static void _long_realloc(void *arg, uint64_t iters);
+static void _long_strbuf(void *arg, uint64_t iters);
+static void _long_strbuf_steal(void *arg, uint64_t iters);
+
+/* ==================== [Static Variables] ================================== */
+
+static char s_buf[HEX_BYTES * 2 + 1];
+static uint8_t s_bytes[HEX_BYTES];
+/* 防止编译器把参数当作常量折叠 */
+static volatile int s_seed = 123456;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_strbuf(void)
+{
+    for (size_t i = 0; i < sizeof(s_bytes); i++) {
+        s_bytes[i] = (uint8_t)(i * 37 + 11);
+    }
+
+    bench_section("xf_strbuf: 3 fields (inline buffer)");
+    bench_run("snprintf at offset (stack)", _short_snprintf, NULL, 0);
+    bench_run("malloc + snprintf + free", _short_malloc, NULL, 0);
+    bench_run("xf_strbuf_appendf", _short_strbuf, NULL, 0);
+
+    bench_section("xf_strbuf: 256 B hex");
+    bench_run("snprintf \"%02x\" loop", _hex_snprintf, NULL, 0);
+    bench_run("xf_strbuf_append_hex", _hex_strbuf, NULL, 0);
+
+    bench_section("xf_strbuf: 128 fields (~2 KiB, heap)");
+    bench_run("realloc to fit + snprintf", _long_realloc, NULL, 0);
+    bench_run("xf_strbuf_appendf", _long_strbuf, NULL, 0);
+    bench_run("xf_strbuf_appendf + steal", _long_strbuf_steal, NULL, 0);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _short_snprintf(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    int v = s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        char buf[XF_STRBUF_INLINE_SIZE];
+        int n = snprintf(buf, sizeof(buf), "id=%d ", v);
+        n += snprintf(buf + n, sizeof(buf) - (size_t)n, "temp=%d ", v + (int)i);
+        n += snprintf(buf + n, sizeof(buf) - (size_t)n, "state=%s", "ok");
+        bench_keep(buf);
+    }
+}
+
+static void _short_malloc(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    int v = s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        char *buf = (char *)malloc(XF_STRBUF_INLINE_SIZE);
+        int n = snprintf(buf, XF_STRBUF_INLINE_SIZE, "id=%d ", v);
+        n += snprintf(buf + n, XF_STRBUF_INLINE_SIZE - (size_t)n, "temp=%d ", v + (int)i);
+        n += snprintf(buf + n, XF_STRBUF_INLINE_SIZE - (size_t)n, "state=%s", "ok");
+        bench_keep(buf);
+        free(buf);
+    }
+}
+
+static void _short_strbuf(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    int v = s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_strbuf_t sb;
+        xf_strbuf_init(&sb);
+        xf_strbuf_appendf(&sb, "id=%d ", v);
+        xf_strbuf_appendf(&sb, "temp=%d ", v + (int)i);
+        xf_strbuf_appendf(&sb, "state=%s", "ok");
+        bench_keep(sb.data);
+        xf_strbuf_deinit(&sb);
+    }
+}
+
+static void _hex_snprintf(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        char *p = s_buf;
+        for (size_t j = 0; j < sizeof(s_bytes); j++) {
+            p += snprintf(p, 3, "%02x", s_bytes[j]);
+        }
+        bench_keep(s_buf);
+    }
+}
+
+static void _hex_strbuf(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    xf_strbuf_t sb;
+    xf_strbuf_init(&sb);
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_strbuf_clear(&sb);
+        xf_strbuf_append_hex(&sb, s_bytes, sizeof(s_bytes));
+        bench_keep(sb.data);
+    }
+    xf_strbuf_deinit(&sb);
+}
+
+/**
+ * @brief 常见的手写拼接: 每个字段先求长度, 再 realloc 到刚好放下.
+ */
+static void _long_realloc(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    int v = s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        char *str = NULL;
+        size_t len = 0;
+        for (int j = 0; j < LONG_FIELDS; j++) {
+            int n = snprintf(NULL, 0, "k%d=%d, ", j, v + j);
+            str = (char *)realloc(str, len + (size_t)n + 1);
+            snprintf(str + len, (size_t)n + 1, "k%d=%d, ", j, v + j);
+            len += (size_t)n;
+        }
+        bench_keep(str);
+        free(str);
+    }
+}
+
+static void _long_strbuf(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    int v = s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_strbuf_t sb;
+        xf_strbuf_init(&sb);
+        for (int j = 0; j < LONG_FIELDS; j++) {
+            xf_strbuf_appendf(&sb, "k%d=%d, ", j, v + j);
+        }
+        bench_keep(sb.data);
+        xf_strbuf_deinit(&sb);
+    }
+}
+
+static void _long_strbuf_steal(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    int v = s_seed;
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_strbuf_t sb;
+        xf_strbuf_init(&sb);
+        for (int j = 0; j < LONG_FIELDS; j++) {
+            xf_strbuf_appendf(&sb, "k%d=%d, ", j, v + j);
+        }
+        char *str = xf_strbuf_steal(&sb, NULL);
+        bench_keep(str);
+        xf_free(str);
+    }
+}
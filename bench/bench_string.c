@@ -0,0 +1,230 @@
+/**
+ * @file bench_string.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_builtin_memcpy/memset/memcmp/strlen 与逐字节实现及 C 库对比, 1 B ~ 1 MiB.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define MAX_SIZE                        (1024u * 1024u)
+
+/* 逐字节实现不能被编译器替换为库函数调用或向量化 */
+#if defined(__GNUC__) && !defined(__clang__)
+#   define BYTE_LOOP    __attribute__((noinline, optimize("no-tree-loop-distribute-patterns", "no-tree-vectorize")))
+#else
+#   define BYTE_LOOP    __attribute__((noinline))
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef enum {
+    OP_MEMCPY = 0,
+    OP_MEMSET,
+    OP_MEMCMP,
+    OP_STRLEN,
+    OP_MAX,
+} op_t;
+
+typedef struct {
+    const char *name;
+    void *(*cpy)(void *dest, const void *src, size_t n);
+    void *(*set)(void *ptr, int value, size_t n);
+    int (*cmp)(const void *a, const void *b, size_t n);
+    size_t (*len)(const char *str);
+} impl_t;
+
+typedef struct {
+    const impl_t   *impl;
+    size_t          size;
+} case_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+#if XF_STRING_BUILTIN_IS_ENABLE
+static void _run_op(op_t op, bench_fn_t fn);
+static void *_byte_memcpy(void *dest, const void *src, size_t n);
+static void *_byte_memset(void *ptr, int value, size_t n);
+static int _byte_memcmp(const void *a, const void *b, size_t n);
+static size_t _byte_strlen(const char *str);
+static void _memcpy(void *arg, uint64_t iters);
+static void _memset(void *arg, uint64_t iters);
+static void _memcmp(void *arg, uint64_t iters);
+static void _strlen(void *arg, uint64_t iters);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+#if XF_STRING_BUILTIN_IS_ENABLE
+/* 逐字节实现相当于部分 MCU C 库中的版本 */
+static const impl_t s_impls[] = {
+    {"byte loop",   _byte_memcpy,       _byte_memset,       _byte_memcmp,       _byte_strlen},
+    {"libc",        memcpy,             memset,             memcmp,             strlen},
+    {"xf_builtin",  xf_builtin_memcpy,  xf_builtin_memset,  xf_builtin_memcmp,  xf_builtin_strlen},
+};
+
+static const size_t s_sizes[] = {1, 8, 64, 512, 4096, 64 * 1024, MAX_SIZE};
+
+static const char *const s_op_names[OP_MAX] = {"memcpy", "memset", "memcmp", "strlen"};
+
+static uint8_t *s_src;
+static uint8_t *s_dst;
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_string(void)
+{
+#if XF_STRING_BUILTIN_IS_ENABLE
+    s_src = (uint8_t *)malloc(MAX_SIZE + 64);
+    s_dst = (uint8_t *)malloc(MAX_SIZE + 64);
+    if ((NULL == s_src) || (NULL == s_dst)) {
+        free(s_src);
+        free(s_dst);
+        return;
+    }
+    memset(s_src, 'a', MAX_SIZE + 64);
+    memset(s_dst, 'a', MAX_SIZE + 64);
+
+    _run_op(OP_MEMCPY, _memcpy);
+    _run_op(OP_MEMSET, _memset);
+    _run_op(OP_MEMCMP, _memcmp);
+    _run_op(OP_STRLEN, _strlen);
+
+    free(s_src);
+    free(s_dst);
+#endif
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#if XF_STRING_BUILTIN_IS_ENABLE
+
+static void _run_op(op_t op, bench_fn_t fn)
+{
+    double gbps[ARRAY_SIZE(s_sizes)][ARRAY_SIZE(s_impls)];
+    char title[64];
+
+    snprintf(title, sizeof(title), "xf_string: %s", s_op_names[op]);
+    bench_section(title);
+    for (size_t i = 0; i < ARRAY_SIZE(s_sizes); i++) {
+        for (size_t j = 0; j < ARRAY_SIZE(s_impls); j++) {
+            case_t c = {&s_impls[j], s_sizes[i]};
+            char name[64];
+            snprintf(name, sizeof(name), "%s %zu B %s", s_op_names[op], c.size, c.impl->name);
+            bench_result_t res = bench_run(name, fn, &c, 0);
+            gbps[i][j] = (double)c.size / res.median;
+        }
+    }
+    bench_printf("%-12s", "size (GB/s)");
+    for (size_t j = 0; j < ARRAY_SIZE(s_impls); j++) {
+        bench_printf(" %12s", s_impls[j].name);
+    }
+    bench_printf("\n");
+    for (size_t i = 0; i < ARRAY_SIZE(s_sizes); i++) {
+        bench_printf("%-12zu", s_sizes[i]);
+        for (size_t j = 0; j < ARRAY_SIZE(s_impls); j++) {
+            bench_printf(" %12.2f", gbps[i][j]);
+        }
+        bench_printf("\n");
+    }
+}
+
+static void _memcpy(void *arg, uint64_t iters)
+{
+    const case_t *c = (const case_t *)arg;
+    for (uint64_t i = 0; i < iters; i++) {
+        c->impl->cpy(s_dst, s_src, c->size);
+        bench_keep(s_dst);
+    }
+}
+
+static void _memset(void *arg, uint64_t iters)
+{
+    const case_t *c = (const case_t *)arg;
+    for (uint64_t i = 0; i < iters; i++) {
+        c->impl->set(s_dst, (int)i, c->size);
+        bench_keep(s_dst);
+    }
+}
+
+/**
+ * @brief 两个缓冲区内容相同, 需要比较全部字节.
+ */
+static void _memcmp(void *arg, uint64_t iters)
+{
+    const case_t *c = (const case_t *)arg;
+    memset(s_dst, 'a', c->size);
+    for (uint64_t i = 0; i < iters; i++) {
+        int r = c->impl->cmp(s_dst, s_src, c->size);
+        bench_keep(&r);
+    }
+}
+
+static void _strlen(void *arg, uint64_t iters)
+{
+    const case_t *c = (const case_t *)arg;
+    s_src[c->size] = '\0';
+    for (uint64_t i = 0; i < iters; i++) {
+        size_t n = c->impl->len((const char *)s_src);
+        bench_keep(&n);
+    }
+    s_src[c->size] = 'a';
+}
+
+BYTE_LOOP static void *_byte_memcpy(void *dest, const void *src, size_t n)
+{
+    uint8_t *d = (uint8_t *)dest;
+    const uint8_t *s = (const uint8_t *)src;
+    while (n--) {
+        *d++ = *s++;
+    }
+    return dest;
+}
+
+BYTE_LOOP static void *_byte_memset(void *ptr, int value, size_t n)
+{
+    uint8_t *d = (uint8_t *)ptr;
+    while (n--) {
+        *d++ = (uint8_t)value;
+    }
+    return ptr;
+}
+
+BYTE_LOOP static int _byte_memcmp(const void *a, const void *b, size_t n)
+{
+    const uint8_t *pa = (const uint8_t *)a;
+    const uint8_t *pb = (const uint8_t *)b;
+    for (; n > 0; n--, pa++, pb++) {
+        if (*pa != *pb) {
+            return (int)*pa - (int)*pb;
+        }
+    }
+    return 0;
+}
+
+BYTE_LOOP static size_t _byte_strlen(const char *str)
+{
+    const char *p = str;
+    while ('\0' != *p) {
+        p++;
+    }
+    return (size_t)(p - str);
+}
+
+#endif /* XF_STRING_BUILTIN_IS_ENABLE */
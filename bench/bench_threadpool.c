@@ -0,0 +1,272 @@
+/**
+ * @file bench_threadpool.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_threadpool: 任务提交开销、parallel_for 与递归任务随工作线程数的扩展性.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define TASK_NUM                        (10000)
+#define ELEM_NUM                        (1 << 18)
+#define MIX_ROUNDS                      (16)
+#define FIB_N                           (25)
+#define FIB_CUTOFF                      (15)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef enum {
+    MODE_SUBMIT = 0,                    /*!< 外部线程逐个 xf_threadpool_submit() */
+    MODE_BATCH,                         /*!< 外部线程一次 xf_threadpool_submit_batch() */
+    MODE_SPAWN,                         /*!< 在工作线程中逐个提交, 压入自己的队列 */
+} bench_mode_t;
+
+typedef struct {
+    bench_mode_t        mode;
+    xf_threadpool_t    *pool;
+} submit_arg_t;
+
+typedef struct {
+    xf_threadpool_task_t    task;
+    submit_arg_t           *arg;
+    uint64_t                iters;
+} spawn_root_t;
+
+typedef struct {
+    xf_threadpool_task_t    task;
+    xf_threadpool_t        *pool;
+    uint32_t                n;
+    uint32_t                result;
+} fib_task_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _submit(void *arg, uint64_t iters);
+static void _spawn_root_cb(xf_threadpool_task_t *task);
+static void _empty_cb(xf_threadpool_task_t *task);
+static void _pfor_serial(void *arg, uint64_t iters);
+static void _pfor_pool(void *arg, uint64_t iters);
+static void _mix_range(size_t begin, size_t end, void *arg);
+static void _fib_serial_run(void *arg, uint64_t iters);
+static void _fib_pool_run(void *arg, uint64_t iters);
+static void _fib_cb(xf_threadpool_task_t *task);
+static uint32_t _fib(uint32_t n);
+
+/* ==================== [Static Variables] ================================== */
+
+static xf_threadpool_task_t s_tasks[TASK_NUM];
+static xf_threadpool_task_t *s_ptrs[TASK_NUM];
+static xf_threadpool_group_t s_group;
+static uint32_t *s_data;
+
+static const char *const s_mode_names[] = {
+    "submit (external)",
+    "submit_batch (external)",
+    "submit (from worker)",
+};
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_threadpool(void)
+{
+    xf_threadpool_t pool;
+    if (XF_OK != xf_threadpool_init(&pool, 1, false)) {
+        bench_printf("xf_thread / xf_cond not supported, skip\n");
+        return;
+    }
+    xf_threadpool_deinit(&pool);
+
+    s_data = (uint32_t *)malloc(sizeof(uint32_t) * ELEM_NUM);
+    if (NULL == s_data) {
+        return;
+    }
+    for (size_t i = 0; i < ELEM_NUM; i++) {
+        s_data[i] = (uint32_t)i;
+    }
+    for (size_t i = 0; i < TASK_NUM; i++) {
+        s_ptrs[i] = &s_tasks[i];
+    }
+    bench_printf("cpu num: %u\n", (unsigned)xf_thread_get_cpu_num());
+
+    static const uint32_t s_workers[] = {1, 2, 4, 8};
+
+    /* 结果为每个空任务从提交到执行完的平均墙钟时间 */
+    for (size_t i = 0; i < ARRAY_SIZE(s_workers); i++) {
+        char title[64];
+        snprintf(title, sizeof(title), "xf_threadpool: empty tasks, %u workers",
+                 (unsigned)s_workers[i]);
+        bench_section(title);
+        xf_threadpool_init(&pool, s_workers[i], false);
+        for (int m = MODE_SUBMIT; m <= MODE_SPAWN; m++) {
+            submit_arg_t arg = {.mode = (bench_mode_t)m, .pool = &pool};
+            bench_run(s_mode_names[m], _submit, &arg, TASK_NUM);
+        }
+        xf_threadpool_deinit(&pool);
+    }
+
+    /* 结果为每个元素的平均墙钟时间 */
+    bench_section("xf_threadpool: parallel_for, 256k elements x 16 rounds");
+    bench_run("serial loop", _pfor_serial, NULL, ELEM_NUM);
+    for (size_t i = 0; i < ARRAY_SIZE(s_workers); i++) {
+        char name[64];
+        snprintf(name, sizeof(name), "parallel_for, %u workers", (unsigned)s_workers[i]);
+        xf_threadpool_init(&pool, s_workers[i], false);
+        bench_run(name, _pfor_pool, &pool, ELEM_NUM);
+        xf_threadpool_deinit(&pool);
+    }
+
+    /* 结果为每次计算 fib(25) 的墙钟时间; n < 15 时串行计算 */
+    bench_section("xf_threadpool: recursive fib(25), cutoff 15");
+    bench_run("serial", _fib_serial_run, NULL, 1);
+    for (size_t i = 0; i < ARRAY_SIZE(s_workers); i++) {
+        char name[64];
+        snprintf(name, sizeof(name), "spawn + group_wait, %u workers", (unsigned)s_workers[i]);
+        xf_threadpool_init(&pool, s_workers[i], false);
+        bench_run(name, _fib_pool_run, &pool, 1);
+        xf_threadpool_deinit(&pool);
+    }
+
+    bench_keep(s_data[ELEM_NUM / 2]);
+    free(s_data);
+    s_data = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _submit(void *arg, uint64_t iters)
+{
+    submit_arg_t *p_arg = (submit_arg_t *)arg;
+    if (iters > TASK_NUM) {
+        iters = TASK_NUM;
+    }
+    xf_threadpool_group_init(&s_group);
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_threadpool_task_init(&s_tasks[i], _empty_cb, &s_group);
+    }
+    switch (p_arg->mode) {
+    case MODE_SUBMIT:
+        for (uint64_t i = 0; i < iters; i++) {
+            xf_threadpool_submit(p_arg->pool, &s_tasks[i]);
+        }
+        break;
+    case MODE_BATCH:
+        xf_threadpool_submit_batch(p_arg->pool, s_ptrs, (size_t)iters);
+        break;
+    case MODE_SPAWN:
+    default: {
+        /* 根任务在工作线程中提交所有子任务, 根任务本身不计入 s_group */
+        xf_threadpool_group_t root_group;
+        spawn_root_t root = {.arg = p_arg, .iters = iters};
+        xf_threadpool_group_init(&root_group);
+        xf_threadpool_task_init(&root.task, _spawn_root_cb, &root_group);
+        xf_threadpool_submit(p_arg->pool, &root.task);
+        /* 不用 group_wait(), 否则调用者可能自己取走根任务 */
+        while (!xf_threadpool_group_done(&root_group)) {
+            xf_thread_yield();
+        }
+    } break;
+    }
+    xf_threadpool_group_wait(p_arg->pool, &s_group);
+}
+
+static void _spawn_root_cb(xf_threadpool_task_t *task)
+{
+    spawn_root_t *root = xf_container_of(task, spawn_root_t, task);
+    for (uint64_t i = 0; i < root->iters; i++) {
+        xf_threadpool_submit(root->arg->pool, &s_tasks[i]);
+    }
+}
+
+static void _empty_cb(xf_threadpool_task_t *task)
+{
+    bench_keep((uint32_t)(uintptr_t)task);
+}
+
+static void _pfor_serial(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    _mix_range(0, (size_t)iters, NULL);
+}
+
+static void _pfor_pool(void *arg, uint64_t iters)
+{
+    xf_threadpool_parallel_for((xf_threadpool_t *)arg, 0, (size_t)iters, 0, _mix_range, NULL);
+}
+
+/**
+ * @brief 每个元素做若干轮整数混合, 计算密集, 几乎不受内存带宽限制.
+ */
+static void _mix_range(size_t begin, size_t end, void *arg)
+{
+    UNUSED(arg);
+    for (size_t i = begin; i < end; i++) {
+        uint32_t x = s_data[i];
+        for (int r = 0; r < MIX_ROUNDS; r++) {
+            x ^= x >> 15;
+            x *= 0x2c1b3c6dU;
+        }
+        s_data[i] = x;
+    }
+}
+
+static void _fib_serial_run(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        bench_keep(_fib(FIB_N));
+    }
+}
+
+static void _fib_pool_run(void *arg, uint64_t iters)
+{
+    for (uint64_t i = 0; i < iters; i++) {
+        xf_threadpool_group_t group;
+        fib_task_t root = {.pool = (xf_threadpool_t *)arg, .n = FIB_N};
+        xf_threadpool_group_init(&group);
+        xf_threadpool_task_init(&root.task, _fib_cb, &group);
+        xf_threadpool_submit(root.pool, &root.task);
+        xf_threadpool_group_wait(root.pool, &group);
+        bench_keep(root.result);
+    }
+}
+
+/**
+ * @brief fib(n - 1) 交给线程池, fib(n - 2) 在当前线程计算, 再等待子任务.
+ */
+static void _fib_cb(xf_threadpool_task_t *task)
+{
+    fib_task_t *ft = xf_container_of(task, fib_task_t, task);
+    if (ft->n < FIB_CUTOFF) {
+        ft->result = _fib(ft->n);
+        return;
+    }
+    xf_threadpool_group_t group;
+    fib_task_t a = {.pool = ft->pool, .n = ft->n - 1};
+    fib_task_t b = {.pool = ft->pool, .n = ft->n - 2};
+    xf_threadpool_group_init(&group);
+    xf_threadpool_task_init(&a.task, _fib_cb, &group);
+    xf_threadpool_task_init(&b.task, _fib_cb, NULL);
+    xf_threadpool_submit(ft->pool, &a.task);
+    _fib_cb(&b.task);
+    xf_threadpool_group_wait(ft->pool, &group);
+    ft->result = a.result + b.result;
+}
+
+static uint32_t _fib(uint32_t n)
+{
+    return (n < 2) ? n : (_fib(n - 1) + _fib(n - 2));
+}
@@ -0,0 +1,72 @@
+/**
+ * @file bench_time.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_time 性能测试.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <time.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _time_get_ns(void *arg, uint64_t iters);
+static void _time_get_ms(void *arg, uint64_t iters);
+static void _clock_gettime(void *arg, uint64_t iters);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_time(void)
+{
+    bench_section("xf_time");
+
+    bench_run("xf_time_get_ns()", _time_get_ns, NULL, 0);
+    bench_run("xf_time_get_ms()", _time_get_ms, NULL, 0);
+    bench_run("clock_gettime(MONOTONIC)", _clock_gettime, NULL, 0);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _time_get_ns(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        uint64_t t = xf_time_get_ns();
+        bench_keep(&t);
+    }
+}
+
+static void _time_get_ms(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        uint64_t t = xf_time_get_ms();
+        bench_keep(&t);
+    }
+}
+
+static void _clock_gettime(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    struct timespec ts;
+    for (uint64_t i = 0; i < iters; i++) {
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        bench_keep(&ts);
+    }
+}
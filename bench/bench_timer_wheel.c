@@ -0,0 +1,158 @@
+/**
+ * @file bench_timer_wheel.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_timer_wheel 性能测试: 10 万个活动定时器.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdlib.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define TIMER_NUM                       (100000)
+/* 超时均匀分布在 [1, TIMEOUT_MAX] 个 tick 内 */
+#define TIMEOUT_MAX                     (60000)
+/* 对照组（无序链表逐 tick 遍历）只测试的 tick 数 */
+#define LIST_SCAN_TICKS                 (1000)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct {
+    xf_timer_wheel_timer_t  timer;
+    xf_list_t               node;       /*!< 对照组使用的链表节点 */
+    uint32_t                expires;    /*!< 对照组使用的到期时间 */
+} bench_timer_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _run(bool thread_safe);
+static void _run_list_scan(void);
+static void _timer_cb(xf_timer_wheel_timer_t *timer, void *user_data);
+static uint32_t _rand(void);
+
+/* ==================== [Static Variables] ================================== */
+
+static bench_timer_t *s_timers = NULL;
+static xf_timer_wheel_t s_wheel;
+static uint32_t s_seed = 12345;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_timer_wheel(void)
+{
+    s_timers = (bench_timer_t *)malloc(sizeof(bench_timer_t) * TIMER_NUM);
+    if (NULL == s_timers) {
+        return;
+    }
+    bench_printf("\n== xf_timer_wheel: %d active timers, timeout 1..%d ticks ==\n",
+                 TIMER_NUM, TIMEOUT_MAX);
+    _run(false);
+    _run(true);
+    _run_list_scan();
+    free(s_timers);
+    s_timers = NULL;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _run(bool thread_safe)
+{
+    uint64_t t0;
+    uint64_t t1;
+    uint32_t expired = 0;
+
+    xf_timer_wheel_init(&s_wheel, thread_safe);
+    s_seed = 12345;
+
+    t0 = bench_now_ns();
+    for (int i = 0; i < TIMER_NUM; i++) {
+        xf_timer_wheel_timer_init(&s_timers[i].timer, _timer_cb, NULL);
+        xf_timer_wheel_add(&s_wheel, &s_timers[i].timer, 1 + _rand() % TIMEOUT_MAX);
+    }
+    t1 = bench_now_ns();
+    bench_printf("%-28s add     : %8.1f ns/op\n", thread_safe ? "wheel (xf_lock)" : "wheel",
+                 (double)(t1 - t0) / TIMER_NUM);
+
+    /* 典型的 "收到报文后刷新超时" 场景 */
+    t0 = bench_now_ns();
+    for (int i = 0; i < TIMER_NUM; i++) {
+        xf_timer_wheel_add(&s_wheel, &s_timers[i].timer, 1 + _rand() % TIMEOUT_MAX);
+    }
+    t1 = bench_now_ns();
+    bench_printf("%-28s re-arm  : %8.1f ns/op\n", "", (double)(t1 - t0) / TIMER_NUM);
+
+    t0 = bench_now_ns();
+    for (int i = 0; i < TIMEOUT_MAX + 1; i++) {
+        expired += xf_timer_wheel_tick(&s_wheel);
+    }
+    t1 = bench_now_ns();
+    bench_printf("%-28s tick    : %8.1f ns/tick (%u expired, %.1f ns/expiry)\n", "",
+                 (double)(t1 - t0) / (TIMEOUT_MAX + 1), (unsigned)expired,
+                 (double)(t1 - t0) / (expired ? expired : 1));
+
+    for (int i = 0; i < TIMER_NUM; i++) {
+        xf_timer_wheel_add(&s_wheel, &s_timers[i].timer, 1 + _rand() % TIMEOUT_MAX);
+    }
+    t0 = bench_now_ns();
+    for (int i = 0; i < TIMER_NUM; i++) {
+        xf_timer_wheel_del(&s_wheel, &s_timers[i].timer);
+    }
+    t1 = bench_now_ns();
+    bench_printf("%-28s cancel  : %8.1f ns/op\n", "", (double)(t1 - t0) / TIMER_NUM);
+
+    xf_timer_wheel_deinit(&s_wheel);
+}
+
+/**
+ * @brief 对照组: 所有定时器挂在一个无序 xf_list 上, 每个 tick 遍历一次.
+ */
+static void _run_list_scan(void)
+{
+    XF_LIST_HEAD(head);
+    bench_timer_t *pos;
+    bench_timer_t *n;
+    uint64_t t0;
+    uint64_t t1;
+    uint32_t expired = 0;
+
+    s_seed = 12345;
+    for (int i = 0; i < TIMER_NUM; i++) {
+        s_timers[i].expires = 1 + _rand() % TIMEOUT_MAX;
+        xf_list_add_tail(&s_timers[i].node, &head);
+    }
+    t0 = bench_now_ns();
+    for (uint32_t tick = 0; tick < LIST_SCAN_TICKS; tick++) {
+        xf_list_for_each_entry_safe(pos, n, &head, bench_timer_t, node) {
+            if (pos->expires == tick) {
+                xf_list_del(&pos->node);
+                expired++;
+            }
+        }
+    }
+    t1 = bench_now_ns();
+    bench_printf("%-28s tick    : %8.1f ns/tick (%u expired)\n", "unsorted xf_list scan",
+                 (double)(t1 - t0) / LIST_SCAN_TICKS, (unsigned)expired);
+}
+
+static void _timer_cb(xf_timer_wheel_timer_t *timer, void *user_data)
+{
+    UNUSED(timer);
+    UNUSED(user_data);
+}
+
+static uint32_t _rand(void)
+{
+    s_seed = s_seed * 1103515245u + 12345u;
+    return s_seed >> 8;
+}
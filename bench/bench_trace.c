@@ -0,0 +1,90 @@
+/**
+ * @file bench_trace.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_trace 性能测试.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+#if XF_TRACE_IS_ENABLE
+static void _instant(void *arg, uint64_t iters);
+static void _scope(void *arg, uint64_t iters);
+static void _counter(void *arg, uint64_t iters);
+static void _export_write(void *user_data, const char *data, size_t len);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_trace(void)
+{
+#if XF_TRACE_IS_ENABLE
+    bench_section("xf_trace");
+
+    xf_trace_thread_set_name("bench");
+    bench_run("XF_TRACE_INSTANT", _instant, NULL, 0);
+    bench_run("XF_TRACE_SCOPE (begin + end)", _scope, NULL, 0);
+    bench_run("XF_TRACE_COUNTER", _counter, NULL, 0);
+
+    size_t bytes = 0;
+    uint64_t t0 = bench_now_ns();
+    xf_trace_export_json(_export_write, &bytes);
+    uint64_t t1 = bench_now_ns();
+    bench_printf("export %d events: %.1f us, %u bytes\n", XF_TRACE_BUF_EVENTS,
+                 (double)(t1 - t0) / 1000.0, (unsigned)bytes);
+    xf_trace_clear();
+#endif
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#if XF_TRACE_IS_ENABLE
+
+static void _instant(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_TRACE_INSTANT("instant");
+    }
+}
+
+static void _scope(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_TRACE_SCOPE("scope");
+    }
+}
+
+static void _counter(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    for (uint64_t i = 0; i < iters; i++) {
+        XF_TRACE_COUNTER("counter", i);
+    }
+}
+
+static void _export_write(void *user_data, const char *data, size_t len)
+{
+    bench_keep(data);
+    *(size_t *)user_data += len;
+}
+
+#endif /* XF_TRACE_IS_ENABLE */
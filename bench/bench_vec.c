@@ -0,0 +1,136 @@
+/**
+ * @file bench_vec.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_vec 追加、遍历与排序, 遍历与 xf_list 对比, 排序与 qsort 对比.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "xf_utils.h"
+#include "bench.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define ELEM_NUM                        (100000)
+#define SORT_NUM                        (10000)
+
+/* ==================== [Typedefs] ========================================== */
+
+XF_VEC_DEFINE(bench_u32_vec, uint32_t)
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _push(void *arg, uint64_t iters);
+static void _iterate(void *arg, uint64_t iters);
+static void _sort_qsort(void *arg, uint64_t iters);
+static void _sort_vec(void *arg, uint64_t iters);
+static int _cmp_u32(const uint32_t *a, const uint32_t *b);
+static int _qsort_cmp_u32(const void *a, const void *b);
+
+/* ==================== [Static Variables] ================================== */
+
+static bench_u32_vec_t s_vec;
+static uint32_t s_random[SORT_NUM];
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void bench_vec(void)
+{
+    uint32_t seed = 1;
+
+    bench_u32_vec_init(&s_vec);
+    if (XF_OK != bench_u32_vec_reserve(&s_vec, ELEM_NUM)) {
+        return;
+    }
+    for (uint32_t i = 0; i < ELEM_NUM; i++) {
+        bench_u32_vec_push(&s_vec, i);
+    }
+    for (size_t i = 0; i < SORT_NUM; i++) {
+        seed = seed * 1103515245u + 12345u;
+        s_random[i] = seed >> 8;
+    }
+
+    bench_section("xf_vec");
+
+    /* 结果按元素数归一化, 与 bench_list 的 for_each_entry 可直接比较 */
+    bench_run("push 100k from empty (per elem)", _push, NULL, ELEM_NUM * 10);
+    bench_run("for_each 100k (per elem)", _iterate, NULL, ELEM_NUM * 10);
+    bench_run("qsort 10k random (per elem)", _sort_qsort, NULL, SORT_NUM * 10);
+    bench_run("xf_vec sort 10k random (per elem)", _sort_vec, NULL, SORT_NUM * 10);
+
+    bench_u32_vec_deinit(&s_vec);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _push(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t loops = iters / ELEM_NUM;
+    for (uint64_t i = 0; i < loops; i++) {
+        bench_u32_vec_t v;
+        bench_u32_vec_init(&v);
+        for (uint32_t j = 0; j < ELEM_NUM; j++) {
+            bench_u32_vec_push(&v, j);
+        }
+        bench_keep(v.data);
+        bench_u32_vec_deinit(&v);
+    }
+}
+
+static void _iterate(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint32_t *it;
+    uint64_t sum = 0;
+    uint64_t loops = iters / ELEM_NUM;
+    for (uint64_t i = 0; i < loops; i++) {
+        xf_vec_for_each(it, &s_vec) {
+            sum += *it;
+        }
+        bench_keep(sum);
+    }
+}
+
+static void _sort_qsort(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t loops = iters / SORT_NUM;
+    for (uint64_t i = 0; i < loops; i++) {
+        memcpy(s_vec.data, s_random, sizeof(s_random));
+        qsort(s_vec.data, SORT_NUM, sizeof(uint32_t), _qsort_cmp_u32);
+        bench_keep(s_vec.data);
+    }
+}
+
+static void _sort_vec(void *arg, uint64_t iters)
+{
+    UNUSED(arg);
+    uint64_t loops = iters / SORT_NUM;
+    bench_u32_vec_t v = {s_vec.data, SORT_NUM, SORT_NUM};
+    for (uint64_t i = 0; i < loops; i++) {
+        memcpy(v.data, s_random, sizeof(s_random));
+        bench_u32_vec_sort(&v, _cmp_u32);
+        bench_keep(v.data);
+    }
+}
+
+static int _cmp_u32(const uint32_t *a, const uint32_t *b)
+{
+    return (*a > *b) - (*a < *b);
+}
+
+static int _qsort_cmp_u32(const void *a, const void *b)
+{
+    return _cmp_u32((const uint32_t *)a, (const uint32_t *)b);
+}
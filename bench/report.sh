@@ -0,0 +1,37 @@
+#!/bin/sh
+# 对比各编译模式下 xf_utils 静态库/性能测试程序的体积与性能.
+#
+# 用法（在仓库根目录下）: sh bench/report.sh
+# 结果保存在 build/bench_report/ 下, 每种模式一个文件.
+
+set -e
+
+OUT_DIR=build/bench_report
+mkdir -p "$OUT_DIR"
+
+run_mode() {
+    name=$1
+    shift
+    xmake f "$@" -y > /dev/null
+    xmake build -y xf_utils_static > /dev/null
+    xmake build -y bench > /dev/null
+    lib=$(find build -path "*/$2/*" -name 'libxf_utils.a' | head -n 1)
+    bin=$(find build -path "*/$2/*" -name 'bench' -type f | head -n 1)
+    {
+        echo "### $name ($*)"
+        echo
+        echo '```'
+        size -t "$lib" | tail -n 1
+        size "$bin" | tail -n 1
+        echo
+        xmake run bench
+        echo '```'
+    } > "$OUT_DIR/$name.md"
+    echo "$name: $OUT_DIR/$name.md"
+}
+
+run_mode debug          -m debug
+run_mode releasedbg     -m releasedbg
+run_mode release        -m release
+run_mode minsizerel     -m minsizerel
+run_mode release_lto    -m release --lto=y
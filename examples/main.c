@@ -20,6 +20,10 @@
 
 #include "xf_utils_config.h"
 #include "port_xf_lock.h"
+#include "port_xf_time.h"
+#include "port_xf_thread.h"
+#include "port_xf_log_sink.h"
+#include "port_xf_log_crash.h"
 
 /* ==================== [Defines] =========================================== */
 
@@ -31,6 +35,11 @@ static void test_log_hello(void);
 static void test_log_level(void);
 
 static void test_xf_lock(void);
+static void test_xf_trace(void);
+static void test_log_stats(void);
+static void test_log_kv(void);
+static void test_log_router(void);
+static void test_log_crash(void);
 
 /* ==================== [Static Variables] ================================== */
 
@@ -44,10 +53,19 @@ int main(void)
 {
     /* 初始化对接 */
     port_xf_lock();
+    port_xf_time();
+    port_xf_thread();
+    port_xf_log_sink();
+    port_xf_log_crash();
 
     test_log_hello();
     test_log_level();
     test_xf_lock();
+    test_xf_trace();
+    test_log_stats();
+    test_log_kv();
+    test_log_router();
+    test_log_crash();
 }
 
 /* ==================== [Static Functions] ================================== */
@@ -122,3 +140,91 @@ static void test_xf_lock(void)
     heap_lock = NULL;
     user_lock = NULL;
 }
+
+#if XF_TRACE_IS_ENABLE
+static void _trace_write(void *user_data, const char *data, size_t len)
+{
+    fwrite(data, 1, len, (FILE *)user_data);
+}
+#endif
+
+static void test_xf_trace(void)
+{
+#if XF_TRACE_IS_ENABLE
+    xf_trace_thread_set_name("main");
+    for (int i = 0; i < 3; i++) {
+        XF_TRACE_SCOPE("loop");
+        XF_TRACE_COUNTER("i", i);
+        usleep(1000);
+        XF_TRACE_INSTANT_ARGS("tick", i, i * 2);
+    }
+
+    /* 用 chrome://tracing 或 https://ui.perfetto.dev 打开 */
+    FILE *fp = fopen("xf_trace.json", "w");
+    if (NULL == fp) {
+        XF_LOGE(TAG, "open xf_trace.json failed");
+        return;
+    }
+    xf_trace_set_enable(false);
+    xf_trace_export_json(_trace_write, fp);
+    fclose(fp);
+    XF_LOGI(TAG, "trace saved to xf_trace.json");
+#endif
+}
+
+static void test_log_stats(void)
+{
+#if XF_LOG_STATS_IS_ENABLE
+    for (int i = 0; i < 10; i++) {
+        XF_LOGD(TAG, "hot log %d", i);
+    }
+    xf_log_stats_dump(5, XF_LOG_STATS_BY_BYTES);
+    xf_log_stats_dump(3, XF_LOG_STATS_BY_HITS);
+#endif
+}
+
+static void test_log_kv(void)
+{
+    int id = 42;
+    const char *peer = "10.0.0.1:\"8080\"";
+    XF_LOGI_KV(TAG, "connected", XF_KV_INT("id", id), XF_KV_STR("peer", peer),
+               XF_KV_FLOAT("rtt_ms", 1.25), XF_KV_BOOL("tls", true));
+    XF_LOGW_KV(TAG, "no fields");
+}
+
+static void test_log_router(void)
+{
+#if XF_LOG_ROUTER_IS_ENABLE
+    static char ring_buf[256];
+    static char batch_buf[128];
+    static xf_log_sink_ring_t ring;
+    char out[sizeof(ring_buf) + 1];
+
+    /* 只保存 WARN 及以上等级的日志, 且批量写入, ERROR 及以上立即写入 */
+    xf_log_sink_ring_init(&ring, ring_buf, sizeof(ring_buf), XF_LOG_WARN);
+    xf_log_sink_set_batch(&ring.sink, batch_buf, sizeof(batch_buf), XF_LOG_ERROR);
+    xf_log_router_add(&ring.sink);
+
+    XF_LOGI(TAG, "only to stdout");
+    XF_LOGW(TAG, "to stdout and ring (batched)");
+    XF_LOGE(TAG, "to stdout and ring (flushed)");
+
+    size_t len = xf_log_sink_ring_read(&ring, out, sizeof(out) - 1);
+    out[len] = '\0';
+    xf_log_router_remove(&ring.sink);
+    XF_LOGI(TAG, "ring sink content:\n%s", out);
+#endif
+}
+
+static void test_log_crash(void)
+{
+#if XF_LOG_CRASH_IS_ENABLE
+    char out[128];
+
+    XF_LOGW(TAG, "last words before crash");
+    /* 崩溃时日志环由信号处理函数写到标准错误, 这里只读出最近的内容 */
+    size_t len = xf_log_crash_read(out, sizeof(out) - 1);
+    out[len] = '\0';
+    XF_LOGI(TAG, "crash ring tail:\n%s", out);
+#endif
+}
@@ -29,6 +29,11 @@ static int _lock_trylock(xf_lock_t lock);
 static int _lock_lock(xf_lock_t lock);
 static int _lock_timedlock(xf_lock_t lock, uint32_t timeout_ms);
 static int _lock_unlock(xf_lock_t lock);
+static xf_err_t _cond_init(xf_cond_t *p_cond);
+static xf_err_t _cond_destroy(xf_cond_t cond);
+static int _cond_wait(xf_cond_t cond, xf_lock_t lock, uint32_t timeout_ms);
+static int _cond_signal(xf_cond_t cond);
+static int _cond_broadcast(xf_cond_t cond);
 
 /* ==================== [Static Variables] ================================== */
 
@@ -39,6 +44,12 @@ static const xf_lock_ops_t lock_ops = {
     .lock       = _lock_lock,
     .timedlock  = _lock_timedlock,
     .unlock     = _lock_unlock,
+
+    .cond_init      = _cond_init,
+    .cond_destroy   = _cond_destroy,
+    .cond_wait      = _cond_wait,
+    .cond_signal    = _cond_signal,
+    .cond_broadcast = _cond_broadcast,
 };
 
 /* ==================== [Macros] ============================================ */
@@ -149,3 +160,80 @@ static int _lock_unlock(xf_lock_t lock)
     return XF_LOCK_SUCC;
 }
 
+static xf_err_t _cond_init(xf_cond_t *p_cond)
+{
+    int ret = 0;
+    pthread_condattr_t attr;
+
+    pthread_cond_t *p_pthread_cond =
+        (pthread_cond_t *)malloc(sizeof(pthread_cond_t));
+    _CHECK(NULL == p_pthread_cond, XF_FAIL);
+
+    /* 超时按单调时钟计算, 不受系统时间调整影响 */
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    ret = pthread_cond_init(p_pthread_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    if (0 != ret) {
+        free(p_pthread_cond);
+    }
+    _CHECK(0 != ret, XF_FAIL);
+
+    *p_cond = (void *)p_pthread_cond;
+
+    return XF_OK;
+}
+
+static xf_err_t _cond_destroy(xf_cond_t cond)
+{
+    int ret = 0;
+    pthread_cond_t *p_pthread_cond = (pthread_cond_t *)cond;
+
+    ret = pthread_cond_destroy(p_pthread_cond);
+    _CHECK(0 != ret, XF_FAIL);
+
+    free(p_pthread_cond);
+
+    return XF_OK;
+}
+
+static int _cond_wait(xf_cond_t cond, xf_lock_t lock, uint32_t timeout_ms)
+{
+    int ret = 0;
+    pthread_cond_t *p_pthread_cond = (pthread_cond_t *)cond;
+    pthread_mutex_t *p_pthread_mutex = (pthread_mutex_t *)lock;
+
+    if ((uint32_t)(~0) == timeout_ms) {
+        ret = pthread_cond_wait(p_pthread_cond, p_pthread_mutex);
+    } else {
+        struct timespec ts = {0};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        ts.tv_sec += timeout_ms / 1000;
+        ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+        if (ts.tv_nsec >= 1000000000) {
+            ts.tv_sec += 1;
+            ts.tv_nsec -= 1000000000;
+        }
+        ret = pthread_cond_timedwait(p_pthread_cond, p_pthread_mutex, &ts);
+    }
+    if (0 != ret) {
+        return XF_LOCK_FAIL;
+    }
+    return XF_LOCK_SUCC;
+}
+
+static int _cond_signal(xf_cond_t cond)
+{
+    if (0 != pthread_cond_signal((pthread_cond_t *)cond)) {
+        return XF_LOCK_FAIL;
+    }
+    return XF_LOCK_SUCC;
+}
+
+static int _cond_broadcast(xf_cond_t cond)
+{
+    if (0 != pthread_cond_broadcast((pthread_cond_t *)cond)) {
+        return XF_LOCK_FAIL;
+    }
+    return XF_LOCK_SUCC;
+}
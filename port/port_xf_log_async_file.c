@@ -0,0 +1,394 @@
+/**
+ * @file port_xf_log_async_file.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief Linux 下批量异步写文件的日志 sink.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include "port_xf_log_async_file.h"
+
+#if XF_LOG_ROUTER_IS_ENABLE
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _sink_write(xf_log_sink_t *sink, const char *data, size_t len);
+static void _sink_flush(xf_log_sink_t *sink);
+static void *_writer_thread(void *arg);
+static void _write_bufs(port_xf_log_async_file_t *af, uint32_t start, uint32_t count);
+static void _sync(port_xf_log_async_file_t *af, uint64_t now);
+static void _rotate(port_xf_log_async_file_t *af);
+static int _open_file(const char *path);
+static void _seal(port_xf_log_async_file_t *af);
+static void _free_bufs(port_xf_log_async_file_t *af);
+static uint64_t _now_ms(void);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t port_xf_log_async_file_open(port_xf_log_async_file_t *af,
+                                     const port_xf_log_async_file_cfg_t *cfg, uint8_t level)
+{
+    if ((NULL == af) || (NULL == cfg) || (NULL == cfg->path)
+            || (cfg->buf_count < 2) || (cfg->buf_count > PORT_XF_LOG_ASYNC_FILE_BUF_MAX)
+            || (0 == cfg->buf_size)
+            || (strlen(cfg->path) + sizeof(".4294967295") > sizeof(af->path))) {
+        return XF_ERR_INVALID_ARG;
+    }
+    memset(af, 0, sizeof(*af));
+    af->fd = -1;
+    af->cfg = *cfg;
+    strcpy(af->path, cfg->path);
+    af->cfg.path = af->path;
+
+    /* 缓冲区按页对齐, 写出时内核按整页拷贝 */
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    af->cfg.buf_size = (cfg->buf_size + page - 1) & ~(page - 1);
+    for (uint32_t i = 0; i < af->cfg.buf_count; i++) {
+        void *p = NULL;
+        if (0 != posix_memalign(&p, page, af->cfg.buf_size)) {
+            _free_bufs(af);
+            return XF_ERR_NO_MEM;
+        }
+        af->bufs[i] = (char *)p;
+    }
+
+    af->fd = _open_file(af->path);
+    if (af->fd < 0) {
+        _free_bufs(af);
+        return XF_FAIL;
+    }
+    struct stat st;
+    if (0 == fstat(af->fd, &st)) {
+        af->file_size = (size_t)st.st_size;
+    }
+    af->sync_ms = _now_ms();
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&af->mutex, NULL);
+    pthread_cond_init(&af->cond_work, &attr);
+    pthread_cond_init(&af->cond_done, &attr);
+    pthread_condattr_destroy(&attr);
+
+    if (0 != pthread_create(&af->thread, NULL, _writer_thread, af)) {
+        pthread_cond_destroy(&af->cond_done);
+        pthread_cond_destroy(&af->cond_work);
+        pthread_mutex_destroy(&af->mutex);
+        close(af->fd);
+        af->fd = -1;
+        _free_bufs(af);
+        return XF_FAIL;
+    }
+
+    xf_log_sink_init(&af->sink, _sink_write, af, level);
+    af->sink.flush = _sink_flush;
+    return XF_OK;
+}
+
+void port_xf_log_async_file_flush(port_xf_log_async_file_t *af)
+{
+    if ((NULL == af) || (af->fd < 0)) {
+        return;
+    }
+    pthread_mutex_lock(&af->mutex);
+    uint64_t req = ++af->flush_req;
+    pthread_cond_signal(&af->cond_work);
+    while (af->flush_done < req) {
+        pthread_cond_wait(&af->cond_done, &af->mutex);
+    }
+    pthread_mutex_unlock(&af->mutex);
+}
+
+void port_xf_log_async_file_close(port_xf_log_async_file_t *af)
+{
+    if ((NULL == af) || (af->fd < 0)) {
+        return;
+    }
+    pthread_mutex_lock(&af->mutex);
+    af->stop = true;
+    af->flush_req++;
+    pthread_cond_signal(&af->cond_work);
+    pthread_mutex_unlock(&af->mutex);
+    pthread_join(af->thread, NULL);
+
+    close(af->fd);
+    af->fd = -1;
+    pthread_cond_destroy(&af->cond_done);
+    pthread_cond_destroy(&af->cond_work);
+    pthread_mutex_destroy(&af->mutex);
+    _free_bufs(af);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief sink 写出回调, 只拷贝到当前缓冲区, 写满时交给后台线程.
+ */
+static void _sink_write(xf_log_sink_t *sink, const char *data, size_t len)
+{
+    port_xf_log_async_file_t *af = (port_xf_log_async_file_t *)sink->user_data;
+
+    pthread_mutex_lock(&af->mutex);
+    while (len > 0) {
+        size_t room = af->cfg.buf_size - af->lens[af->cur];
+        /* 放得进一块缓冲区的数据不跨缓冲区, 保证轮转不会截断一条日志 */
+        if ((0 == room) || ((len > room) && (len <= af->cfg.buf_size))) {
+            while (af->full + 1 >= af->cfg.buf_count) {
+                af->waits++;
+                pthread_cond_wait(&af->cond_done, &af->mutex);
+            }
+            _seal(af);
+            pthread_cond_signal(&af->cond_work);
+            continue;
+        }
+        if (0 == af->lens[af->cur]) {
+            /* 缓冲区由空变为非空, 通知后台线程开始计时 */
+            af->cur_since_ms = _now_ms();
+            pthread_cond_signal(&af->cond_work);
+        }
+        size_t n = (len < room) ? len : room;
+        memcpy(af->bufs[af->cur] + af->lens[af->cur], data, n);
+        af->lens[af->cur] += n;
+        data += n;
+        len -= n;
+        if ((af->lens[af->cur] == af->cfg.buf_size) && (af->full + 1 < af->cfg.buf_count)) {
+            _seal(af);
+            pthread_cond_signal(&af->cond_work);
+        }
+    }
+    pthread_mutex_unlock(&af->mutex);
+}
+
+static void _sink_flush(xf_log_sink_t *sink)
+{
+    port_xf_log_async_file_flush((port_xf_log_async_file_t *)sink->user_data);
+}
+
+static void *_writer_thread(void *arg)
+{
+    port_xf_log_async_file_t *af = (port_xf_log_async_file_t *)arg;
+
+    pthread_mutex_lock(&af->mutex);
+    for (;;) {
+        uint64_t now = _now_ms();
+        bool flush = (af->flush_req != af->flush_done) || af->stop;
+        bool aged = (af->cfg.flush_interval_ms > 0) && (af->lens[af->cur] > 0)
+                    && (now - af->cur_since_ms >= af->cfg.flush_interval_ms);
+
+        if ((flush || aged) && (af->lens[af->cur] > 0)
+                && (af->full + 1 < af->cfg.buf_count)) {
+            _seal(af);
+        }
+
+        if (af->full > 0) {
+            /* 待写出的缓冲区只由本线程访问, 写出期间不持有锁 */
+            uint32_t start = af->tail;
+            uint32_t count = af->full;
+            pthread_mutex_unlock(&af->mutex);
+            _write_bufs(af, start, count);
+            pthread_mutex_lock(&af->mutex);
+            for (uint32_t i = 0; i < count; i++) {
+                af->lens[(start + i) % af->cfg.buf_count] = 0;
+            }
+            af->tail = (start + count) % af->cfg.buf_count;
+            af->full -= count;
+            pthread_cond_broadcast(&af->cond_done);
+            continue;
+        }
+
+        if (flush) {
+            uint64_t req = af->flush_req;
+            if ((af->cfg.fsync_bytes > 0) || (af->cfg.fsync_interval_ms > 0)) {
+                pthread_mutex_unlock(&af->mutex);
+                _sync(af, _now_ms());
+                pthread_mutex_lock(&af->mutex);
+            }
+            af->flush_done = req;
+            pthread_cond_broadcast(&af->cond_done);
+            if (af->stop) {
+                break;
+            }
+            continue;
+        }
+
+        if ((af->cfg.fsync_interval_ms > 0) && (af->unsynced > 0)
+                && (now - af->sync_ms >= af->cfg.fsync_interval_ms)) {
+            pthread_mutex_unlock(&af->mutex);
+            _sync(af, now);
+            pthread_mutex_lock(&af->mutex);
+            continue;
+        }
+
+        /* 等待新数据、刷新请求, 或最近的写出/同步时刻 */
+        uint64_t deadline = UINT64_MAX;
+        if ((af->cfg.flush_interval_ms > 0) && (af->lens[af->cur] > 0)) {
+            deadline = af->cur_since_ms + af->cfg.flush_interval_ms;
+        }
+        if ((af->cfg.fsync_interval_ms > 0) && (af->unsynced > 0)
+                && (af->sync_ms + af->cfg.fsync_interval_ms < deadline)) {
+            deadline = af->sync_ms + af->cfg.fsync_interval_ms;
+        }
+        if (UINT64_MAX == deadline) {
+            pthread_cond_wait(&af->cond_work, &af->mutex);
+        } else {
+            struct timespec ts;
+            ts.tv_sec = (time_t)(deadline / 1000);
+            ts.tv_nsec = (long)(deadline % 1000) * 1000000L;
+            pthread_cond_timedwait(&af->cond_work, &af->mutex, &ts);
+        }
+    }
+    pthread_mutex_unlock(&af->mutex);
+    return NULL;
+}
+
+/**
+ * @brief 一次 writev() 写出 count 块缓冲区, 并按配置组提交、轮转.
+ */
+static void _write_bufs(port_xf_log_async_file_t *af, uint32_t start, uint32_t count)
+{
+    struct iovec iov[PORT_XF_LOG_ASYNC_FILE_BUF_MAX];
+    struct iovec *p_iov = iov;
+    size_t total = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t idx = (start + i) % af->cfg.buf_count;
+        iov[i].iov_base = af->bufs[idx];
+        iov[i].iov_len = af->lens[idx];
+        total += af->lens[idx];
+    }
+
+    int iovcnt = (int)count;
+    size_t left = total;
+    while (left > 0) {
+        ssize_t n = writev(af->fd, p_iov, iovcnt);
+        af->writev_calls++;
+        if (n < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            break;
+        }
+        left -= (size_t)n;
+        /* 部分写入: 跳过已写出的 iovec */
+        while ((n > 0) && ((size_t)n >= p_iov->iov_len)) {
+            n -= (ssize_t)p_iov->iov_len;
+            p_iov++;
+            iovcnt--;
+        }
+        if (n > 0) {
+            p_iov->iov_base = (char *)p_iov->iov_base + n;
+            p_iov->iov_len -= (size_t)n;
+        }
+    }
+    total -= left;
+    af->bytes += total;
+    af->file_size += total;
+    af->unsynced += total;
+
+    uint64_t now = _now_ms();
+    if (((af->cfg.fsync_bytes > 0) && (af->unsynced >= af->cfg.fsync_bytes))
+            || ((af->cfg.fsync_interval_ms > 0)
+                && (now - af->sync_ms >= af->cfg.fsync_interval_ms))) {
+        _sync(af, now);
+    }
+    if ((af->cfg.rotate_bytes > 0) && (af->file_size >= af->cfg.rotate_bytes)) {
+        _rotate(af);
+    }
+}
+
+static void _sync(port_xf_log_async_file_t *af, uint64_t now)
+{
+    if (af->unsynced > 0) {
+        fdatasync(af->fd);
+        af->fsync_calls++;
+        af->unsynced = 0;
+    }
+    af->sync_ms = now;
+}
+
+/**
+ * @brief path.(N-1) -> path.N, ..., path -> path.1, 再重新打开 path.
+ */
+static void _rotate(port_xf_log_async_file_t *af)
+{
+    char from[PORT_XF_LOG_ASYNC_FILE_PATH_MAX + 16];
+    char to[PORT_XF_LOG_ASYNC_FILE_PATH_MAX + 16];
+
+    _sync(af, _now_ms());
+    if (0 == af->cfg.rotate_keep) {
+        if (0 == ftruncate(af->fd, 0)) {
+            af->file_size = 0;
+            af->rotations++;
+        }
+        return;
+    }
+    for (uint32_t i = af->cfg.rotate_keep - 1; i > 0; i--) {
+        snprintf(from, sizeof(from), "%s.%u", af->path, (unsigned)i);
+        snprintf(to, sizeof(to), "%s.%u", af->path, (unsigned)(i + 1));
+        rename(from, to);
+    }
+    snprintf(to, sizeof(to), "%s.1", af->path);
+    if (0 != rename(af->path, to)) {
+        return;
+    }
+    int fd = _open_file(af->path);
+    if (fd < 0) {
+        /* 无法创建新文件时继续写入已重命名的文件 */
+        return;
+    }
+    close(af->fd);
+    af->fd = fd;
+    af->file_size = 0;
+    af->rotations++;
+}
+
+static int _open_file(const char *path)
+{
+    return open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+}
+
+static void _seal(port_xf_log_async_file_t *af)
+{
+    af->full++;
+    af->cur = (af->cur + 1) % af->cfg.buf_count;
+}
+
+static void _free_bufs(port_xf_log_async_file_t *af)
+{
+    for (uint32_t i = 0; i < PORT_XF_LOG_ASYNC_FILE_BUF_MAX; i++) {
+        free(af->bufs[i]);
+        af->bufs[i] = NULL;
+    }
+}
+
+static uint64_t _now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+#endif /* XF_LOG_ROUTER_IS_ENABLE */
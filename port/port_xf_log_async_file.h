@@ -0,0 +1,157 @@
+/**
+ * @file port_xf_log_async_file.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief Linux 下批量异步写文件的日志 sink.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 日志先拷贝到若干块页对齐的大缓冲区, 写满（或超时、刷新）后交给后台线程,
+ * 后台线程一次 writev() 写出所有已满的缓冲区, 因此调用日志的线程不产生系统调用.
+ *
+ * - 组提交: 距上次 fdatasync() 累计写出 fsync_bytes 字节或经过 fsync_interval_ms
+ *   毫秒后同步一次, 多批数据共用一次同步;
+ * - 轮转: 文件大小超过 rotate_bytes 后依次重命名为 path.1 ... path.N,
+ *   判断以一次 writev() 为粒度, 文件可能略超过 rotate_bytes;
+ * - 缓冲区全部写满时日志线程等待后台线程（不丢日志）.
+ *
+ * 用法:
+ * @code{.c}
+ * static port_xf_log_async_file_t s_file;
+ * port_xf_log_async_file_cfg_t cfg = PORT_XF_LOG_ASYNC_FILE_CFG_DEFAULT("app.log");
+ * port_xf_log_async_file_open(&s_file, &cfg, XF_LOG_INFO);
+ * xf_log_router_add(&s_file.sink);
+ * ...
+ * xf_log_router_remove(&s_file.sink);
+ * port_xf_log_async_file_close(&s_file);
+ * @endcode
+ */
+
+#ifndef __PORT_XF_LOG_ASYNC_FILE_H__
+#define __PORT_XF_LOG_ASYNC_FILE_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include <pthread.h>
+#include "xf_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#define PORT_XF_LOG_ASYNC_FILE_PATH_MAX     (256)
+#define PORT_XF_LOG_ASYNC_FILE_BUF_MAX      (64)
+
+/* ==================== [Typedefs] ========================================== */
+
+#if XF_LOG_ROUTER_IS_ENABLE
+
+/**
+ * @brief 异步文件 sink 配置. 大小、间隔为 0 表示关闭对应功能.
+ */
+typedef struct port_xf_log_async_file_cfg_s {
+    const char     *path;               /*!< 文件路径 */
+    size_t          buf_size;           /*!< 每块缓冲区大小, 向上对齐到页大小 */
+    uint32_t        buf_count;          /*!< 缓冲区块数, 2 ~ PORT_XF_LOG_ASYNC_FILE_BUF_MAX */
+    uint32_t        flush_interval_ms;  /*!< 未写满的缓冲区最长停留时间 */
+    uint32_t        fsync_interval_ms;  /*!< 组提交: 距上次同步的最长时间 */
+    size_t          fsync_bytes;        /*!< 组提交: 距上次同步的最大未同步字节数 */
+    size_t          rotate_bytes;       /*!< 文件超过该大小后轮转 */
+    uint32_t        rotate_keep;        /*!< 保留的历史文件个数, 0 时直接截断 */
+} port_xf_log_async_file_cfg_t;
+
+/**
+ * @brief 异步文件 sink. 成员除 sink 与统计值外均为内部使用.
+ */
+typedef struct port_xf_log_async_file_s {
+    xf_log_sink_t   sink;
+    port_xf_log_async_file_cfg_t cfg;
+    char            path[PORT_XF_LOG_ASYNC_FILE_PATH_MAX];
+    int             fd;
+    pthread_t       thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond_work;          /*!< 唤醒后台线程 */
+    pthread_cond_t  cond_done;          /*!< 唤醒等待空闲缓冲区或刷新完成的线程 */
+    char           *bufs[PORT_XF_LOG_ASYNC_FILE_BUF_MAX];
+    size_t          lens[PORT_XF_LOG_ASYNC_FILE_BUF_MAX];
+    uint32_t        cur;                /*!< 正在填充的缓冲区 */
+    uint32_t        tail;               /*!< 最早的待写出缓冲区 */
+    uint32_t        full;               /*!< 待写出缓冲区个数 */
+    bool            stop;
+    uint64_t        flush_req;          /*!< 刷新请求序号 */
+    uint64_t        flush_done;         /*!< 已完成的刷新序号 */
+    uint64_t        cur_since_ms;       /*!< 当前缓冲区开始填充的时间 */
+    uint64_t        sync_ms;            /*!< 上次同步的时间 */
+    size_t          file_size;
+    size_t          unsynced;
+    /* 统计 */
+    uint64_t        bytes;              /*!< 写出字节数 */
+    uint64_t        writev_calls;       /*!< writev() 次数 */
+    uint64_t        fsync_calls;        /*!< fdatasync() 次数 */
+    uint64_t        rotations;          /*!< 轮转次数 */
+    uint64_t        waits;              /*!< 日志线程等待空闲缓冲区的次数 */
+} port_xf_log_async_file_t;
+
+#endif /* XF_LOG_ROUTER_IS_ENABLE */
+
+/* ==================== [Global Prototypes] ================================= */
+
+#if XF_LOG_ROUTER_IS_ENABLE
+
+/**
+ * @brief 打开文件并启动后台写线程, 需要再调用 xf_log_router_add() 加入路由.
+ *
+ * @param af 异步文件 sink.
+ * @param cfg 配置, 可由 PORT_XF_LOG_ASYNC_FILE_CFG_DEFAULT() 得到默认值.
+ * @param level 只接收等级不高于 level 的日志.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         缓冲区分配失败
+ *      - XF_FAIL               打开文件或创建线程失败
+ */
+xf_err_t port_xf_log_async_file_open(port_xf_log_async_file_t *af,
+                                     const port_xf_log_async_file_cfg_t *cfg, uint8_t level);
+
+/**
+ * @brief 写出所有缓冲区, 返回时数据已写入文件.
+ *        开启组提交（fsync_bytes 或 fsync_interval_ms 非 0）时同时同步到磁盘.
+ *
+ * 也作为 sink 的 flush 回调, 由 xf_log_router_flush() 调用.
+ */
+void port_xf_log_async_file_flush(port_xf_log_async_file_t *af);
+
+/**
+ * @brief 写出剩余数据并关闭文件（同 port_xf_log_async_file_flush()）, 调用前应先移出路由.
+ */
+void port_xf_log_async_file_close(port_xf_log_async_file_t *af);
+
+#endif /* XF_LOG_ROUTER_IS_ENABLE */
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 默认配置: 4 块 256 KiB 缓冲区, 100 ms 写出, 1 s 或 4 MiB 同步,
+ *        64 MiB 轮转并保留 4 个历史文件.
+ */
+#define PORT_XF_LOG_ASYNC_FILE_CFG_DEFAULT(_path) { \
+        .path               = (_path), \
+        .buf_size           = 256 * 1024, \
+        .buf_count          = 4, \
+        .flush_interval_ms  = 100, \
+        .fsync_interval_ms  = 1000, \
+        .fsync_bytes        = 4 * 1024 * 1024, \
+        .rotate_bytes       = 64 * 1024 * 1024, \
+        .rotate_keep        = 4, \
+    }
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __PORT_XF_LOG_ASYNC_FILE_H__
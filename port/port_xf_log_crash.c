@@ -0,0 +1,111 @@
+/**
+ * @file port_xf_log_crash.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief Linux 下在致命信号中导出崩溃日志环.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include "xf_utils.h"
+#include "port_xf_log_crash.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 信号处理函数使用的备用栈, 栈溢出导致的 SIGSEGV 也能处理 */
+#define ALT_STACK_SIZE                  (64 * 1024)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+#if XF_LOG_CRASH_IS_ENABLE
+static void _signal_handler(int sig);
+static void _fd_write(const char *data, size_t len, void *user_data);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+#if XF_LOG_CRASH_IS_ENABLE
+static const int s_signals[] = { SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT };
+static char s_alt_stack[ALT_STACK_SIZE];
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void port_xf_log_crash(void)
+{
+#if XF_LOG_CRASH_IS_ENABLE
+    /* 进程内存不会跨进程保留, 只有 exec 同一进程映像等特殊情况下才会恢复 */
+    if (xf_log_crash_init()) {
+        xf_log_crash_print();
+        xf_log_crash_clear();
+    }
+
+    stack_t ss;
+    ss.ss_sp = s_alt_stack;
+    ss.ss_size = sizeof(s_alt_stack);
+    ss.ss_flags = 0;
+    sigaltstack(&ss, NULL);
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = _signal_handler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_ONSTACK | SA_RESETHAND;
+    for (size_t i = 0; i < ARRAY_SIZE(s_signals); i++) {
+        sigaction(s_signals[i], &sa, NULL);
+    }
+#endif
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#if XF_LOG_CRASH_IS_ENABLE
+
+/**
+ * @brief 只使用异步信号安全的函数（write/raise）.
+ */
+static void _signal_handler(int sig)
+{
+    static const char head[] = "\n==== fatal signal, last logs: ====\n";
+    static const char tail[] = "==== end of last logs ====\n";
+    int fd = STDERR_FILENO;
+    int saved_errno = errno;
+
+    _fd_write(head, sizeof(head) - 1, &fd);
+    xf_log_crash_dump(_fd_write, &fd);
+    _fd_write(tail, sizeof(tail) - 1, &fd);
+    errno = saved_errno;
+
+    /* SA_RESETHAND 已恢复默认处理, 重新触发以产生 core dump */
+    raise(sig);
+}
+
+static void _fd_write(const char *data, size_t len, void *user_data)
+{
+    int fd = *(int *)user_data;
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+}
+
+#endif /* XF_LOG_CRASH_IS_ENABLE */
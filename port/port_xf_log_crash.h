@@ -0,0 +1,43 @@
+/**
+ * @file port_xf_log_crash.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __PORT_XF_LOG_CRASH_H__
+#define __PORT_XF_LOG_CRASH_H__
+
+/* ==================== [Includes] ========================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化崩溃日志环, 并安装致命信号的处理函数.
+ *
+ * 收到 SIGSEGV/SIGBUS/SIGILL/SIGFPE/SIGABRT 时将日志环的内容写到标准错误,
+ * 再以默认动作重新触发该信号（保留 core dump 与退出码）.
+ *
+ * 需要在 port_xf_log_sink() 之后调用. 未使能 XF_LOG_CRASH_ENABLE 时为空操作.
+ */
+void port_xf_log_crash(void);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __PORT_XF_LOG_CRASH_H__
@@ -0,0 +1,122 @@
+/**
+ * @file port_xf_log_sink.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief Linux 下的日志 sink.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "port_xf_log_sink.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+#if XF_LOG_ROUTER_IS_ENABLE
+static void _file_write(xf_log_sink_t *sink, const char *data, size_t len);
+static void _stdout_write(xf_log_sink_t *sink, const char *data, size_t len);
+static void _stdout_flush(xf_log_sink_t *sink);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+#if XF_LOG_ROUTER_IS_ENABLE
+/* 标准输出经 stdio 缓冲, 与直接使用 printf 时的行为一致 */
+static xf_log_sink_t s_stdout_sink;
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void port_xf_log_sink(void)
+{
+#if XF_LOG_ROUTER_IS_ENABLE
+    xf_log_router_init();
+    xf_log_sink_init(&s_stdout_sink, _stdout_write, NULL, XF_LOG_VERBOSE);
+    s_stdout_sink.flush = _stdout_flush;
+    xf_log_router_add(&s_stdout_sink);
+#endif
+}
+
+#if XF_LOG_ROUTER_IS_ENABLE
+
+xf_err_t port_xf_log_file_sink_open(port_xf_log_file_sink_t *fs, const char *path, uint8_t level)
+{
+    if ((NULL == fs) || (NULL == path)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    int fd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return XF_FAIL;
+    }
+    xf_log_sink_init(&fs->sink, _file_write, fs, level);
+    fs->fd = fd;
+    fs->owns_fd = true;
+    return XF_OK;
+}
+
+xf_err_t port_xf_log_file_sink_init_fd(port_xf_log_file_sink_t *fs, int fd, uint8_t level)
+{
+    if ((NULL == fs) || (fd < 0)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_log_sink_init(&fs->sink, _file_write, fs, level);
+    fs->fd = fd;
+    fs->owns_fd = false;
+    return XF_OK;
+}
+
+void port_xf_log_file_sink_close(port_xf_log_file_sink_t *fs)
+{
+    if ((NULL == fs) || (fs->fd < 0)) {
+        return;
+    }
+    if (fs->owns_fd) {
+        close(fs->fd);
+    }
+    fs->fd = -1;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _file_write(xf_log_sink_t *sink, const char *data, size_t len)
+{
+    port_xf_log_file_sink_t *fs = (port_xf_log_file_sink_t *)sink->user_data;
+    while (len > 0) {
+        ssize_t n = write(fs->fd, data, len);
+        if (n < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+}
+
+static void _stdout_write(xf_log_sink_t *sink, const char *data, size_t len)
+{
+    UNUSED(sink);
+    fwrite(data, 1, len, stdout);
+}
+
+static void _stdout_flush(xf_log_sink_t *sink)
+{
+    UNUSED(sink);
+    fflush(stdout);
+}
+
+#endif /* XF_LOG_ROUTER_IS_ENABLE */
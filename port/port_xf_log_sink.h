@@ -0,0 +1,68 @@
+/**
+ * @file port_xf_log_sink.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __PORT_XF_LOG_SINK_H__
+#define __PORT_XF_LOG_SINK_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+#if XF_LOG_ROUTER_IS_ENABLE
+/**
+ * @brief 基于文件描述符的 sink.
+ */
+typedef struct port_xf_log_file_sink_s {
+    xf_log_sink_t   sink;
+    int             fd;
+    bool            owns_fd;    /*!< 关闭时是否 close(fd) */
+} port_xf_log_file_sink_t;
+#endif
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化日志路由, 并添加输出到标准输出的 sink.
+ */
+void port_xf_log_sink(void);
+
+#if XF_LOG_ROUTER_IS_ENABLE
+/**
+ * @brief 以追加方式打开文件作为 sink, 需要再调用 xf_log_router_add() 加入路由.
+ */
+xf_err_t port_xf_log_file_sink_open(port_xf_log_file_sink_t *fs, const char *path, uint8_t level);
+
+/**
+ * @brief 以已打开的文件描述符作为 sink（不接管 fd）.
+ */
+xf_err_t port_xf_log_file_sink_init_fd(port_xf_log_file_sink_t *fs, int fd, uint8_t level);
+
+/**
+ * @brief 关闭文件 sink, 调用前应先移出路由.
+ */
+void port_xf_log_file_sink_close(port_xf_log_file_sink_t *fs);
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __PORT_XF_LOG_SINK_H__
@@ -0,0 +1,131 @@
+/**
+ * @file port_xf_thread.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief Linux 下 xf_thread 的对接（pthread）.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#   define _GNU_SOURCE                  /* pthread_setaffinity_np */
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "xf_utils_port.h"
+#include "port_xf_thread.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief xf_thread_t 指向的对象. pthread 入口的签名不同, 需要一层转接.
+ */
+typedef struct {
+    pthread_t           tid;
+    xf_thread_func_t    func;
+    void               *arg;
+} port_thread_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_err_t _thread_create(xf_thread_t *p_thread, xf_thread_func_t func, void *arg);
+static xf_err_t _thread_join(xf_thread_t thread);
+static void _thread_yield(void);
+static xf_err_t _thread_set_affinity(xf_thread_t thread, uint32_t cpu);
+static uint32_t _thread_get_cpu_num(void);
+static void *_entry(void *arg);
+
+/* ==================== [Static Variables] ================================== */
+
+static const xf_thread_ops_t thread_ops = {
+    .create         = _thread_create,
+    .join           = _thread_join,
+    .yield          = _thread_yield,
+    .set_affinity   = _thread_set_affinity,
+    .get_cpu_num    = _thread_get_cpu_num,
+};
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void port_xf_thread(void)
+{
+    xf_thread_register(&thread_ops);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static xf_err_t _thread_create(xf_thread_t *p_thread, xf_thread_func_t func, void *arg)
+{
+    port_thread_t *t = (port_thread_t *)malloc(sizeof(port_thread_t));
+    if (NULL == t) {
+        return XF_FAIL;
+    }
+    t->func = func;
+    t->arg = arg;
+    if (0 != pthread_create(&t->tid, NULL, _entry, t)) {
+        free(t);
+        return XF_FAIL;
+    }
+    *p_thread = (xf_thread_t)t;
+    return XF_OK;
+}
+
+static xf_err_t _thread_join(xf_thread_t thread)
+{
+    port_thread_t *t = (port_thread_t *)thread;
+    if (0 != pthread_join(t->tid, NULL)) {
+        return XF_FAIL;
+    }
+    free(t);
+    return XF_OK;
+}
+
+static void _thread_yield(void)
+{
+    sched_yield();
+}
+
+static xf_err_t _thread_set_affinity(xf_thread_t thread, uint32_t cpu)
+{
+#if defined(__linux__)
+    port_thread_t *t = (port_thread_t *)thread;
+    cpu_set_t set;
+    if (cpu >= CPU_SETSIZE) {
+        return XF_ERR_INVALID_ARG;
+    }
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (0 != pthread_setaffinity_np(t->tid, sizeof(set), &set)) {
+        return XF_FAIL;
+    }
+    return XF_OK;
+#else
+    UNUSED(thread);
+    UNUSED(cpu);
+    return XF_ERR_NOT_SUPPORTED;
+#endif
+}
+
+static uint32_t _thread_get_cpu_num(void)
+{
+    long num = sysconf(_SC_NPROCESSORS_ONLN);
+    return (num > 0) ? (uint32_t)num : 1;
+}
+
+static void *_entry(void *arg)
+{
+    port_thread_t *t = (port_thread_t *)arg;
+    t->func(t->arg);
+    return NULL;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file port_xf_thread.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __PORT_XF_THREAD_H__
+#define __PORT_XF_THREAD_H__
+
+/* ==================== [Includes] ========================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+void port_xf_thread(void);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __PORT_XF_THREAD_H__
@@ -0,0 +1,153 @@
+/**
+ * @file port_xf_time.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief Linux 下 xf_time 的对接.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * - 默认使用 clock_gettime(CLOCK_MONOTONIC), glibc 下通过 vDSO 实现, 不产生系统调用;
+ * - x86_64 且 CPU 支持不变 TSC（invariant TSC）时, 改为读取 TSC,
+ *   并在注册时以 CLOCK_MONOTONIC 为基准校准 TSC 频率, 单次读取只需十几个周期.
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdio.h>
+#include <time.h>
+#include "xf_utils_port.h"
+#include "port_xf_time.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#   include <cpuid.h>
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 是否允许使用 TSC.
+ */
+#ifndef PORT_XF_TIME_TSC_ENABLE
+#   define PORT_XF_TIME_TSC_ENABLE      (1)
+#endif
+
+#if PORT_XF_TIME_TSC_ENABLE && defined(__x86_64__) && defined(__GNUC__)
+#   define PORT_XF_TIME_TSC_IS_ENABLE   (1)
+#else
+#   define PORT_XF_TIME_TSC_IS_ENABLE   (0)
+#endif
+
+/* TSC 校准时长, 单位 ns */
+#define TSC_CALIBRATE_NS                (20 * 1000 * 1000ULL)
+/* ns = (tsc * mult) >> TSC_SHIFT */
+#define TSC_SHIFT                       (32)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static uint64_t _monotonic_get_ns(void);
+#if PORT_XF_TIME_TSC_IS_ENABLE
+static uint64_t _tsc_get_ns(void);
+static int _tsc_calibrate(void);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+static const xf_time_ops_t time_ops_monotonic = {
+    .get_ns     = _monotonic_get_ns,
+};
+
+#if PORT_XF_TIME_TSC_IS_ENABLE
+static const xf_time_ops_t time_ops_tsc = {
+    .get_ns     = _tsc_get_ns,
+};
+
+static uint64_t s_tsc_base = 0;
+static uint64_t s_ns_base = 0;
+static uint64_t s_tsc_mult = 0;
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+void port_xf_time(void)
+{
+#if PORT_XF_TIME_TSC_IS_ENABLE
+    if (0 == _tsc_calibrate()) {
+        xf_time_register(&time_ops_tsc);
+        return;
+    }
+#endif
+    xf_time_register(&time_ops_monotonic);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static uint64_t _monotonic_get_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+#if PORT_XF_TIME_TSC_IS_ENABLE
+
+static inline uint64_t _rdtsc(void)
+{
+    uint32_t lo;
+    uint32_t hi;
+    __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static uint64_t _tsc_get_ns(void)
+{
+    uint64_t delta = _rdtsc() - s_tsc_base;
+    return s_ns_base + (uint64_t)(((unsigned __int128)delta * s_tsc_mult) >> TSC_SHIFT);
+}
+
+/**
+ * @brief 检查不变 TSC 并以 CLOCK_MONOTONIC 为基准校准.
+ *
+ * @return int 0: 成功; -1: 不支持.
+ */
+static int _tsc_calibrate(void)
+{
+    unsigned int eax;
+    unsigned int ebx;
+    unsigned int ecx;
+    unsigned int edx;
+
+    /* CPUID.80000007H:EDX[8] 不变 TSC */
+    if (__get_cpuid_max(0x80000000, NULL) < 0x80000007) {
+        return -1;
+    }
+    __cpuid(0x80000007, eax, ebx, ecx, edx);
+    if (!(edx & (1U << 8))) {
+        return -1;
+    }
+
+    uint64_t ns0 = _monotonic_get_ns();
+    uint64_t tsc0 = _rdtsc();
+    uint64_t ns1;
+    uint64_t tsc1;
+    do {
+        ns1 = _monotonic_get_ns();
+        tsc1 = _rdtsc();
+    } while (ns1 - ns0 < TSC_CALIBRATE_NS);
+
+    if (tsc1 <= tsc0) {
+        return -1;
+    }
+    s_tsc_mult = (uint64_t)((((unsigned __int128)(ns1 - ns0)) << TSC_SHIFT) / (tsc1 - tsc0));
+    s_tsc_base = tsc1;
+    s_ns_base = ns1;
+    return 0;
+}
+
+#endif /* PORT_XF_TIME_TSC_IS_ENABLE */
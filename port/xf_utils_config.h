@@ -27,6 +27,16 @@ extern "C" {
 #define XF_STDLIB_ENABLE                    (1)
 #define XF_STRING_ENABLE                    (1)
 
+/**
+ * @brief xf_memcpy/xf_memset/xf_memcmp/xf_strlen 使用内置实现.
+ */
+#define XF_STRING_BUILTIN_ENABLE            (0)
+
+/**
+ * @brief xf_snprintf/xf_vsnprintf（含日志路由的格式化）使用内置实现.
+ */
+#define XF_STDIO_BUILTIN_PRINTF_ENABLE      (0)
+
 #define XF_CHECK_ENABLE                     (1)
 #define XF_ASSERT_IS_ENABLE                 (1)
 #define XF_ERROR_CHECK_IS_ENABLE            (1)
@@ -42,6 +52,27 @@ extern "C" {
 
 #define XF_LOG_DUMP_ENABLE                      (1)
 
+/**
+ * @brief 日志前缀是否带有时间戳（ms）, 需要对接 xf_time.
+ */
+#define XF_LOG_TIMESTAMP_ENABLE                 (0)
+
+/**
+ * @brief 日志经路由分发到多个 sink, 见 port/port_xf_log_sink.c.
+ *        使能后未注册 sink 时日志被丢弃.
+ */
+#define XF_LOG_ROUTER_ENABLE                    (0)
+
+/**
+ * @brief 日志额外写入崩溃日志环, 见 port/port_xf_log_crash.c.
+ */
+#define XF_LOG_CRASH_ENABLE                     (0)
+
+/**
+ * @brief 是否使能 xf_trace 事件追踪.
+ */
+#define XF_TRACE_ENABLE                         (0)
+
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Global Prototypes] ================================= */
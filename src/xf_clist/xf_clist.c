@@ -0,0 +1,460 @@
+/**
+ * @file xf_clist.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 线程安全的链表（链表头 + 锁 + 计数）, 可选阻塞弹出。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_clist.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_time/xf_time.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 每段占用的字节数, 向上取整到 XF_CLIST_STRIPE_ALIGN */
+#define STRIPE_STRIDE \
+    ((sizeof(xf_clist_t) + XF_CLIST_STRIPE_ALIGN - 1) & ~((size_t)XF_CLIST_STRIPE_ALIGN - 1))
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_err_t _push(xf_clist_t *cl, xf_list_t *node, bool tail);
+static xf_list_t *_pop_locked(xf_clist_t *cl, bool front);
+static uint32_t _remaining_ms(uint64_t start_ms, uint32_t timeout_ms);
+static uint32_t _stripe_index(xf_clist_striped_t *sc, uint32_t hint);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#define _STRIPE(sc, i)                  ((xf_clist_t *)((sc)->stripes + (size_t)(i) * STRIPE_STRIDE))
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_clist_init(xf_clist_t *cl, bool blocking)
+{
+    if (NULL == cl) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_list_init(&cl->head);
+    cl->len = 0;
+    cl->waiters = 0;
+    cl->lock = NULL;
+    cl->cond = NULL;
+    if (XF_OK != xf_lock_init(&cl->lock)) {
+        return XF_FAIL;
+    }
+    if (blocking) {
+        xf_err_t err = xf_cond_init(&cl->cond);
+        if (XF_OK != err) {
+            xf_lock_destroy(cl->lock);
+            cl->lock = NULL;
+            cl->cond = NULL;
+            return err;
+        }
+    }
+    return XF_OK;
+}
+
+void xf_clist_deinit(xf_clist_t *cl)
+{
+    if (NULL == cl) {
+        return;
+    }
+    if (NULL != cl->cond) {
+        xf_cond_destroy(cl->cond);
+        cl->cond = NULL;
+    }
+    if (NULL != cl->lock) {
+        xf_lock_destroy(cl->lock);
+        cl->lock = NULL;
+    }
+    xf_list_init(&cl->head);
+    cl->len = 0;
+}
+
+xf_err_t xf_clist_push_back(xf_clist_t *cl, xf_list_t *node)
+{
+    return _push(cl, node, true);
+}
+
+xf_err_t xf_clist_push_front(xf_clist_t *cl, xf_list_t *node)
+{
+    return _push(cl, node, false);
+}
+
+xf_list_t *xf_clist_pop_front(xf_clist_t *cl)
+{
+    if (NULL == cl) {
+        return NULL;
+    }
+    xf_lock_lock(cl->lock);
+    xf_list_t *node = _pop_locked(cl, true);
+    xf_lock_unlock(cl->lock);
+    return node;
+}
+
+xf_list_t *xf_clist_pop_back(xf_clist_t *cl)
+{
+    if (NULL == cl) {
+        return NULL;
+    }
+    xf_lock_lock(cl->lock);
+    xf_list_t *node = _pop_locked(cl, false);
+    xf_lock_unlock(cl->lock);
+    return node;
+}
+
+xf_err_t xf_clist_pop_wait(xf_clist_t *cl, xf_list_t **p_node, uint32_t timeout_ms)
+{
+    if ((NULL == cl) || (NULL == p_node)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    uint64_t start_ms = xf_time_get_ms();
+    xf_err_t err = XF_OK;
+
+    xf_lock_lock(cl->lock);
+    for (;;) {
+        *p_node = _pop_locked(cl, true);
+        if (NULL != *p_node) {
+            break;
+        }
+        if (NULL == cl->cond) {
+            err = XF_ERR_NOT_SUPPORTED;
+            break;
+        }
+        uint32_t remaining = _remaining_ms(start_ms, timeout_ms);
+        if (0 == remaining) {
+            err = XF_ERR_TIMEOUT;
+            break;
+        }
+        cl->waiters++;
+        int ret = xf_cond_wait(cl->cond, cl->lock, remaining);
+        cl->waiters--;
+        if (XF_LOCK_SUCC != ret) {
+            /* 超时; 返回前最后再检查一次 */
+            *p_node = _pop_locked(cl, true);
+            err = (NULL != *p_node) ? XF_OK : XF_ERR_TIMEOUT;
+            break;
+        }
+    }
+    xf_lock_unlock(cl->lock);
+    return err;
+}
+
+xf_err_t xf_clist_remove(xf_clist_t *cl, xf_list_t *node)
+{
+    if ((NULL == cl) || (NULL == node)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_err_t err = XF_ERR_NOT_FOUND;
+    xf_lock_lock(cl->lock);
+    /* 已被其他线程取出的节点是自环的 */
+    if (!xf_list_empty(node)) {
+        xf_list_del_init(node);
+        xf_atomic_store(&cl->len, cl->len - 1, XF_ATOMIC_RELAXED);
+        err = XF_OK;
+    }
+    xf_lock_unlock(cl->lock);
+    return err;
+}
+
+size_t xf_clist_take_all(xf_clist_t *cl, xf_list_t *dst)
+{
+    if ((NULL == cl) || (NULL == dst)) {
+        return 0;
+    }
+    xf_lock_lock(cl->lock);
+    size_t num = cl->len;
+    xf_list_splice_tail_init(&cl->head, dst);
+    xf_atomic_store(&cl->len, 0, XF_ATOMIC_RELAXED);
+    xf_lock_unlock(cl->lock);
+    return num;
+}
+
+size_t xf_clist_transfer(xf_clist_t *dst, xf_clist_t *src)
+{
+    if ((NULL == dst) || (NULL == src) || (dst == src)) {
+        return 0;
+    }
+    /* 固定按地址从小到大加锁 */
+    xf_clist_t *first = ((uintptr_t)dst < (uintptr_t)src) ? dst : src;
+    xf_clist_t *second = (first == dst) ? src : dst;
+
+    xf_lock_lock(first->lock);
+    xf_lock_lock(second->lock);
+    size_t num = src->len;
+    xf_list_splice_tail_init(&src->head, &dst->head);
+    xf_atomic_store(&src->len, 0, XF_ATOMIC_RELAXED);
+    xf_atomic_store(&dst->len, dst->len + num, XF_ATOMIC_RELAXED);
+    if ((num > 0) && (dst->waiters > 0)) {
+        xf_cond_broadcast(dst->cond);
+    }
+    xf_lock_unlock(second->lock);
+    xf_lock_unlock(first->lock);
+    return num;
+}
+
+size_t xf_clist_push_back_list(xf_clist_t *cl, xf_list_t *list)
+{
+    if ((NULL == cl) || (NULL == list)) {
+        return 0;
+    }
+    /* 在锁外计数 */
+    size_t num = 0;
+    xf_list_t *pos;
+    xf_list_for_each(pos, list) {
+        num++;
+    }
+    if (0 == num) {
+        return 0;
+    }
+    xf_lock_lock(cl->lock);
+    xf_list_splice_tail_init(list, &cl->head);
+    xf_atomic_store(&cl->len, cl->len + num, XF_ATOMIC_RELAXED);
+    if (cl->waiters > 0) {
+        xf_cond_broadcast(cl->cond);
+    }
+    xf_lock_unlock(cl->lock);
+    return num;
+}
+
+size_t xf_clist_pop_front_n(xf_clist_t *cl, xf_list_t *dst, size_t max)
+{
+    if ((NULL == cl) || (NULL == dst)) {
+        return 0;
+    }
+    size_t num = 0;
+    xf_lock_lock(cl->lock);
+    while ((num < max) && !xf_list_empty(&cl->head)) {
+        xf_list_move_tail(cl->head.next, dst);
+        num++;
+    }
+    xf_atomic_store(&cl->len, cl->len - num, XF_ATOMIC_RELAXED);
+    xf_lock_unlock(cl->lock);
+    return num;
+}
+
+xf_err_t xf_clist_striped_init(xf_clist_striped_t *sc, uint32_t num, bool blocking)
+{
+    if ((NULL == sc) || (0 == num)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_err_t err = XF_OK;
+    uint32_t inited = 0;
+
+    sc->mem = NULL;
+    sc->stripes = NULL;
+    sc->num = 0;
+    sc->cursor = 0;
+    sc->len = 0;
+    sc->waiters = 0;
+    sc->wait_lock = NULL;
+    sc->wait_cond = NULL;
+
+    sc->mem = xf_malloc((size_t)num * STRIPE_STRIDE + XF_CLIST_STRIPE_ALIGN - 1);
+    if (NULL == sc->mem) {
+        return XF_ERR_NO_MEM;
+    }
+    sc->stripes = (uint8_t *)(((uintptr_t)sc->mem + XF_CLIST_STRIPE_ALIGN - 1)
+                              & ~((uintptr_t)XF_CLIST_STRIPE_ALIGN - 1));
+    for (inited = 0; inited < num; inited++) {
+        err = xf_clist_init(_STRIPE(sc, inited), false);
+        if (XF_OK != err) {
+            goto l_err;
+        }
+    }
+    sc->num = num;
+    if (blocking) {
+        if (XF_OK != xf_lock_init(&sc->wait_lock)) {
+            sc->wait_lock = NULL;
+            err = XF_FAIL;
+            goto l_err;
+        }
+        err = xf_cond_init(&sc->wait_cond);
+        if (XF_OK != err) {
+            sc->wait_cond = NULL;
+            goto l_err;
+        }
+    }
+    return XF_OK;
+
+l_err:
+    sc->num = inited;
+    xf_clist_striped_deinit(sc);
+    return err;
+}
+
+void xf_clist_striped_deinit(xf_clist_striped_t *sc)
+{
+    if (NULL == sc) {
+        return;
+    }
+    for (uint32_t i = 0; i < sc->num; i++) {
+        xf_clist_deinit(_STRIPE(sc, i));
+    }
+    if (NULL != sc->wait_cond) {
+        xf_cond_destroy(sc->wait_cond);
+        sc->wait_cond = NULL;
+    }
+    if (NULL != sc->wait_lock) {
+        xf_lock_destroy(sc->wait_lock);
+        sc->wait_lock = NULL;
+    }
+    if (NULL != sc->mem) {
+        xf_free(sc->mem);
+    }
+    sc->mem = NULL;
+    sc->stripes = NULL;
+    sc->num = 0;
+    sc->len = 0;
+}
+
+xf_err_t xf_clist_striped_push(xf_clist_striped_t *sc, xf_list_t *node, uint32_t hint)
+{
+    if ((NULL == sc) || (NULL == node) || (0 == sc->num)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    /*
+     * 先增加总数再插入: 消费者看到的总数不会小于实际节点数, 不会在有节点时睡眠.
+     * 与 xf_clist_striped_pop_wait() 中 waiters 的递增与总数的读取构成 Dekker 式配对,
+     * 双方都用 SEQ_CST, 至少一方能看到另一方.
+     */
+    xf_atomic_fetch_add(&sc->len, 1, XF_ATOMIC_SEQ_CST);
+    _push(_STRIPE(sc, _stripe_index(sc, hint)), node, true);
+
+    if ((NULL != sc->wait_cond) && (0 != xf_atomic_load(&sc->waiters, XF_ATOMIC_SEQ_CST))) {
+        xf_lock_lock(sc->wait_lock);
+        xf_cond_signal(sc->wait_cond);
+        xf_lock_unlock(sc->wait_lock);
+    }
+    return XF_OK;
+}
+
+xf_list_t *xf_clist_striped_pop(xf_clist_striped_t *sc, uint32_t hint)
+{
+    if ((NULL == sc) || (0 == sc->num)) {
+        return NULL;
+    }
+    uint32_t start = _stripe_index(sc, hint);
+    xf_list_t *node = NULL;
+
+    /* 第一遍只 trylock, 不与其他线程在同一段上排队 */
+    for (uint32_t n = 0; (n < sc->num) && (NULL == node); n++) {
+        xf_clist_t *cl = _STRIPE(sc, (start + n) % sc->num);
+        if (xf_clist_empty(cl) || (XF_LOCK_SUCC != xf_lock_trylock(cl->lock))) {
+            continue;
+        }
+        node = _pop_locked(cl, true);
+        xf_lock_unlock(cl->lock);
+    }
+    for (uint32_t n = 0; (n < sc->num) && (NULL == node); n++) {
+        xf_clist_t *cl = _STRIPE(sc, (start + n) % sc->num);
+        if (!xf_clist_empty(cl)) {
+            node = xf_clist_pop_front(cl);
+        }
+    }
+    if (NULL != node) {
+        xf_atomic_fetch_sub(&sc->len, 1, XF_ATOMIC_RELAXED);
+    }
+    return node;
+}
+
+xf_err_t xf_clist_striped_pop_wait(
+    xf_clist_striped_t *sc, xf_list_t **p_node, uint32_t hint, uint32_t timeout_ms)
+{
+    if ((NULL == sc) || (NULL == p_node)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    uint64_t start_ms = xf_time_get_ms();
+
+    for (;;) {
+        *p_node = xf_clist_striped_pop(sc, hint);
+        if (NULL != *p_node) {
+            return XF_OK;
+        }
+        if (NULL == sc->wait_cond) {
+            return XF_ERR_NOT_SUPPORTED;
+        }
+        uint32_t remaining = _remaining_ms(start_ms, timeout_ms);
+        if (0 == remaining) {
+            return XF_ERR_TIMEOUT;
+        }
+
+        int ret = XF_LOCK_SUCC;
+        xf_lock_lock(sc->wait_lock);
+        xf_atomic_fetch_add(&sc->waiters, 1, XF_ATOMIC_SEQ_CST);
+        if (0 == xf_atomic_load(&sc->len, XF_ATOMIC_SEQ_CST)) {
+            ret = xf_cond_wait(sc->wait_cond, sc->wait_lock, remaining);
+        }
+        xf_atomic_fetch_sub(&sc->waiters, 1, XF_ATOMIC_RELAXED);
+        xf_lock_unlock(sc->wait_lock);
+
+        if (XF_LOCK_SUCC != ret) {
+            *p_node = xf_clist_striped_pop(sc, hint);
+            return (NULL != *p_node) ? XF_OK : XF_ERR_TIMEOUT;
+        }
+    }
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static xf_err_t _push(xf_clist_t *cl, xf_list_t *node, bool tail)
+{
+    if ((NULL == cl) || (NULL == node)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_lock_lock(cl->lock);
+    if (tail) {
+        xf_list_add_tail(node, &cl->head);
+    } else {
+        xf_list_add(node, &cl->head);
+    }
+    xf_atomic_store(&cl->len, cl->len + 1, XF_ATOMIC_RELAXED);
+    if (cl->waiters > 0) {
+        xf_cond_signal(cl->cond);
+    }
+    xf_lock_unlock(cl->lock);
+    return XF_OK;
+}
+
+/**
+ * @brief 取出第一个或最后一个节点, 需要持锁调用.
+ */
+static xf_list_t *_pop_locked(xf_clist_t *cl, bool front)
+{
+    if (xf_list_empty(&cl->head)) {
+        return NULL;
+    }
+    xf_list_t *node = front ? cl->head.next : cl->head.prev;
+    xf_list_del_init(node);
+    xf_atomic_store(&cl->len, cl->len - 1, XF_ATOMIC_RELAXED);
+    return node;
+}
+
+/**
+ * @brief 剩余的等待时间, 0 表示已超时.
+ */
+static uint32_t _remaining_ms(uint64_t start_ms, uint32_t timeout_ms)
+{
+    if ((XF_CLIST_WAIT_FOREVER == timeout_ms) || (0 == timeout_ms)) {
+        return timeout_ms;
+    }
+    uint64_t elapsed = xf_time_get_ms() - start_ms;
+    return (elapsed >= timeout_ms) ? 0 : (uint32_t)(timeout_ms - elapsed);
+}
+
+static uint32_t _stripe_index(xf_clist_striped_t *sc, uint32_t hint)
+{
+    if (XF_CLIST_HINT_ANY == hint) {
+        hint = xf_atomic_fetch_add(&sc->cursor, 1, XF_ATOMIC_RELAXED);
+    }
+    return hint % sc->num;
+}
@@ -0,0 +1,360 @@
+/**
+ * @file xf_clist.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 线程安全的链表（链表头 + 锁 + 计数）, 可选阻塞弹出。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * xf_clist_t 把 xf_list_t 链表头、xf_lock_t 与节点数绑在一起, 每个操作内部加锁,
+ * 使用者不需要自己配对链表与锁. 节点仍是侵入式的 xf_list_t, 不分配内存.
+ *
+ * - 以 blocking = true 初始化时, xf_clist_pop_wait() 在链表为空时阻塞等待, 直到有节点或超时.
+ *   需要对接的锁实现了条件变量（xf_lock_ops_t::cond_*）;
+ * - 需要同时操作两个链表时使用 xf_clist_transfer(), 内部按固定顺序加锁, 不会死锁;
+ * - xf_clist_striped_t 由 N 段 xf_clist_t 组成, 生产者、消费者按 hint 选段,
+ *   适合多生产者多消费者、不要求严格先进先出的队列.
+ *
+ * @code{.c}
+ * typedef struct {
+ *     xf_list_t   node;
+ *     int         job;
+ * } msg_t;
+ *
+ * // 生产者
+ * xf_clist_push_back(&q, &msg->node);
+ *
+ * // 消费者
+ * xf_list_t *node;
+ * if (XF_OK == xf_clist_pop_wait(&q, &node, 100)) {
+ *     msg_t *msg = xf_list_entry(node, msg_t, node);
+ * }
+ * @endcode
+ */
+
+#ifndef __XF_CLIST_H__
+#define __XF_CLIST_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_clist_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_lock/xf_lock.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_clist xf_clist
+ * @brief 线程安全的链表, 可选阻塞弹出。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 一直等待.
+ */
+#define XF_CLIST_WAIT_FOREVER           ((uint32_t)(~0))
+
+/**
+ * @brief 分段链表的 hint: 不指定段, 由内部轮转选择.
+ */
+#define XF_CLIST_HINT_ANY               ((uint32_t)(~0))
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 线程安全的链表.
+ */
+typedef struct xf_clist_s {
+    xf_list_t           head;           /*!< 链表头, 只能在持锁时访问 */
+    size_t              len;            /*!< 节点数, 持锁修改 */
+    uint32_t            waiters;        /*!< 阻塞在 xf_clist_pop_wait() 中的线程数 */
+    xf_lock_t           lock;           /*!< 保护以上成员 */
+    xf_cond_t           cond;           /*!< 非空通知, 未使能阻塞时为 NULL */
+} xf_clist_t;
+
+/**
+ * @brief 分段链表. 节点分散在 num 段中, 每段一把锁.
+ */
+typedef struct xf_clist_striped_s {
+    void               *mem;            /*!< 分配的内存 */
+    uint8_t            *stripes;        /*!< 按 XF_CLIST_STRIPE_ALIGN 对齐的各段 */
+    uint32_t            num;            /*!< 段数 */
+    uint32_t            cursor;         /*!< hint 为 XF_CLIST_HINT_ANY 时的轮转位置 */
+    size_t              len;            /*!< 总节点数 */
+    uint32_t            waiters;        /*!< 阻塞等待的线程数 */
+    xf_lock_t           wait_lock;      /*!< 只用于阻塞等待 */
+    xf_cond_t           wait_cond;      /*!< 非空通知, 未使能阻塞时为 NULL */
+} xf_clist_striped_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化链表.
+ *
+ * @param cl 链表.
+ * @param blocking 是否支持 xf_clist_pop_wait() 阻塞等待.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_SUPPORTED  blocking 为 true, 但对接的锁没有实现条件变量
+ *      - XF_FAIL               创建锁失败, 需要已通过 xf_lock_register() 对接锁
+ */
+xf_err_t xf_clist_init(xf_clist_t *cl, bool blocking);
+
+/**
+ * @brief 销毁链表. 不释放节点, 调用时不能有线程阻塞在该链表上.
+ *
+ * @param cl 链表.
+ */
+void xf_clist_deinit(xf_clist_t *cl);
+
+/**
+ * @brief 在末尾插入节点, 唤醒一个等待者.
+ *
+ * @param cl 链表.
+ * @param node 节点, 不能已在某个链表中.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_clist_push_back(xf_clist_t *cl, xf_list_t *node);
+
+/**
+ * @brief 在开头插入节点, 唤醒一个等待者.
+ *
+ * @param cl 链表.
+ * @param node 节点, 不能已在某个链表中.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_clist_push_front(xf_clist_t *cl, xf_list_t *node);
+
+/**
+ * @brief 取出第一个节点, 不等待.
+ *
+ * @param cl 链表.
+ * @return xf_list_t* 节点, 链表为空时返回 NULL.
+ */
+xf_list_t *xf_clist_pop_front(xf_clist_t *cl);
+
+/**
+ * @brief 取出最后一个节点, 不等待.
+ *
+ * @param cl 链表.
+ * @return xf_list_t* 节点, 链表为空时返回 NULL.
+ */
+xf_list_t *xf_clist_pop_back(xf_clist_t *cl);
+
+/**
+ * @brief 取出第一个节点, 链表为空时等待直到有节点或超时.
+ *
+ * @param cl 以 blocking = true 初始化的链表.
+ * @param[out] p_node 取出的节点.
+ * @param timeout_ms 超时时间, 单位 ms. 0 表示不等待, XF_CLIST_WAIT_FOREVER 表示一直等待.
+ *      超时按 xf_time 计算, 未对接 xf_time 时虚假唤醒会重新开始计时.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_SUPPORTED  初始化时未使能阻塞, 且链表为空
+ *      - XF_ERR_TIMEOUT        超时
+ */
+xf_err_t xf_clist_pop_wait(xf_clist_t *cl, xf_list_t **p_node, uint32_t timeout_ms);
+
+/**
+ * @brief 从链表中删除指定节点.
+ *
+ * 可以与 pop 并发调用: 节点已被取出时返回 XF_ERR_NOT_FOUND, 长度不变.
+ *
+ * @attention node 必须在 cl 中, 或已从 cl 中弹出（弹出后节点是自环的）.
+ *            xf_clist_take_all() 取出的节点位于 dst 中, 不能再传给本函数.
+ *
+ * @param cl 链表.
+ * @param node 节点.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_FOUND      节点不在链表中（已被取出）
+ */
+xf_err_t xf_clist_remove(xf_clist_t *cl, xf_list_t *node);
+
+/**
+ * @brief 一次取出所有节点, 接到 dst 末尾. 适合消费者批量处理.
+ *
+ * @param cl 链表.
+ * @param dst 不受 cl 的锁保护的普通链表.
+ * @return size_t 取出的节点数.
+ */
+size_t xf_clist_take_all(xf_clist_t *cl, xf_list_t *dst);
+
+/**
+ * @brief 把 src 的所有节点移到 dst 末尾.
+ *
+ * 两把锁按地址顺序获取, 任意两个线程同时反向移动也不会死锁.
+ *
+ * @param dst 目标链表.
+ * @param src 源链表.
+ * @return size_t 移动的节点数.
+ */
+size_t xf_clist_transfer(xf_clist_t *dst, xf_clist_t *src);
+
+/**
+ * @brief 把普通链表 list 的所有节点一次接到末尾, 只加一次锁. 适合生产者批量提交.
+ *
+ * @param cl 链表.
+ * @param list 不受 cl 的锁保护的普通链表, 返回后为空.
+ * @return size_t 插入的节点数.
+ */
+size_t xf_clist_push_back_list(xf_clist_t *cl, xf_list_t *list);
+
+/**
+ * @brief 从开头最多取出 max 个节点, 按原顺序接到 dst 末尾, 不等待.
+ *
+ * @param cl 链表.
+ * @param dst 不受 cl 的锁保护的普通链表.
+ * @param max 最多取出的节点数.
+ * @return size_t 取出的节点数.
+ */
+size_t xf_clist_pop_front_n(xf_clist_t *cl, xf_list_t *dst, size_t max);
+
+/**
+ * @brief 初始化分段链表.
+ *
+ * @param sc 分段链表.
+ * @param num 段数, 通常取线程数左右.
+ * @param blocking 是否支持 xf_clist_striped_pop_wait() 阻塞等待.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足
+ *      - XF_ERR_NOT_SUPPORTED  blocking 为 true, 但对接的锁没有实现条件变量
+ *      - XF_FAIL               创建锁失败
+ */
+xf_err_t xf_clist_striped_init(xf_clist_striped_t *sc, uint32_t num, bool blocking);
+
+/**
+ * @brief 销毁分段链表. 不释放节点, 调用时不能有线程阻塞在该链表上.
+ *
+ * @param sc 分段链表.
+ */
+void xf_clist_striped_deinit(xf_clist_striped_t *sc);
+
+/**
+ * @brief 插入节点到 hint 对应段的末尾, 唤醒一个等待者.
+ *
+ * @param sc 分段链表.
+ * @param node 节点.
+ * @param hint 段的选择, 对段数取余; 通常为生产者的编号, 使不同生产者落在不同段.
+ *      XF_CLIST_HINT_ANY 表示轮转.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_clist_striped_push(xf_clist_striped_t *sc, xf_list_t *node, uint32_t hint);
+
+/**
+ * @brief 从 hint 对应的段开始依次尝试取出一个节点, 不等待.
+ *
+ * 先只用 trylock 扫描一遍, 跳过正被其他线程持有的段, 都失败时再加锁扫描.
+ * 同一段内先进先出, 段之间不保证顺序.
+ *
+ * @param sc 分段链表.
+ * @param hint 起始段, 通常为消费者的编号. XF_CLIST_HINT_ANY 表示轮转.
+ * @return xf_list_t* 节点, 所有段都为空时返回 NULL.
+ */
+xf_list_t *xf_clist_striped_pop(xf_clist_striped_t *sc, uint32_t hint);
+
+/**
+ * @brief 取出一个节点, 所有段都为空时等待直到有节点或超时.
+ *
+ * @param sc 以 blocking = true 初始化的分段链表.
+ * @param[out] p_node 取出的节点.
+ * @param hint 起始段, 见 xf_clist_striped_pop().
+ * @param timeout_ms 超时时间, 单位 ms, 见 xf_clist_pop_wait().
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_SUPPORTED  初始化时未使能阻塞, 且链表为空
+ *      - XF_ERR_TIMEOUT        超时
+ */
+xf_err_t xf_clist_striped_pop_wait(
+    xf_clist_striped_t *sc, xf_list_t **p_node, uint32_t hint, uint32_t timeout_ms);
+
+/**
+ * @brief 节点数. 不加锁, 并发修改时只是近似值.
+ */
+static inline size_t xf_clist_len(const xf_clist_t *cl)
+{
+    return xf_atomic_load(&cl->len, XF_ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 是否为空. 不加锁, 并发修改时只是近似值.
+ */
+static inline bool xf_clist_empty(const xf_clist_t *cl)
+{
+    return 0 == xf_clist_len(cl);
+}
+
+/**
+ * @brief 总节点数. 不加锁, 并发修改时只是近似值.
+ */
+static inline size_t xf_clist_striped_len(const xf_clist_striped_t *sc)
+{
+    return xf_atomic_load(&sc->len, XF_ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 加锁, 之后可以通过 xf_clist_for_each_entry() 遍历.
+ *
+ * @attention 持锁期间只能读取或修改节点所在的对象, 不能增删节点.
+ */
+static inline void xf_clist_lock(xf_clist_t *cl)
+{
+    xf_lock_lock(cl->lock);
+}
+
+/**
+ * @brief 解锁.
+ */
+static inline void xf_clist_unlock(xf_clist_t *cl)
+{
+    xf_lock_unlock(cl->lock);
+}
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 遍历链表. 需要在 xf_clist_lock() 与 xf_clist_unlock() 之间使用.
+ *
+ * @param pos 用作循环游标的结构体指针（类型为参数 type 的指针）.
+ * @param cl 链表.
+ * @param type 含有链表节点的结构体的类型.
+ * @param member 链表节点在结构体中的成员名.
+ */
+#define xf_clist_for_each_entry(pos, cl, type, member) \
+    xf_list_for_each_entry(pos, &(cl)->head, type, member)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_clist
+ * @}
+ */
+
+#endif // __XF_CLIST_H__
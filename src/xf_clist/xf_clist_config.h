@@ -0,0 +1,46 @@
+/**
+ * @file xf_clist_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_clist 配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_CLIST_CONFIG_H__
+#define __XF_CLIST_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 分段链表中每段的对齐字节数, 通常为缓存行大小, 避免相邻段的锁伪共享.
+ */
+#if !defined(XF_CLIST_STRIPE_ALIGN)
+#   define XF_CLIST_STRIPE_ALIGN        (64)
+#endif
+
+#if (XF_CLIST_STRIPE_ALIGN < 8) || ((XF_CLIST_STRIPE_ALIGN & (XF_CLIST_STRIPE_ALIGN - 1)) != 0)
+#   error "xf_clist: XF_CLIST_STRIPE_ALIGN must be a power of 2 and >= 8"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_CLIST_CONFIG_H__
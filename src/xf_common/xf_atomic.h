@@ -0,0 +1,149 @@
+/**
+ * @file xf_atomic.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 原子操作.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * GCC/Clang 下基于 `__atomic` 内建函数实现, 内存序与 C11 相同.
+ * 其余编译器只提供普通读写（无读-改-写操作）, 只适用于单核且不在中断中并发访问的场景.
+ */
+
+#ifndef __XF_ATOMIC_H__
+#define __XF_ATOMIC_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_common_config.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils_common
+ * @defgroup group_xf_utils_common_atomic xf_atomic
+ * @brief 原子操作。用于屏蔽不同编译器原子操作的区别。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#if defined(__GNUC__) || defined(__clang__)
+#   define XF_ATOMIC_IS_SUPPORTED       (1)
+#else
+#   define XF_ATOMIC_IS_SUPPORTED       (0)
+#endif
+
+#if XF_ATOMIC_IS_SUPPORTED
+#   define XF_ATOMIC_RELAXED            __ATOMIC_RELAXED
+#   define XF_ATOMIC_CONSUME            __ATOMIC_CONSUME
+#   define XF_ATOMIC_ACQUIRE            __ATOMIC_ACQUIRE
+#   define XF_ATOMIC_RELEASE            __ATOMIC_RELEASE
+#   define XF_ATOMIC_ACQ_REL            __ATOMIC_ACQ_REL
+#   define XF_ATOMIC_SEQ_CST            __ATOMIC_SEQ_CST
+#else
+#   define XF_ATOMIC_RELAXED            (0)
+#   define XF_ATOMIC_CONSUME            (1)
+#   define XF_ATOMIC_ACQUIRE            (2)
+#   define XF_ATOMIC_RELEASE            (3)
+#   define XF_ATOMIC_ACQ_REL            (4)
+#   define XF_ATOMIC_SEQ_CST            (5)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#if XF_ATOMIC_IS_SUPPORTED
+
+/**
+ * @brief 原子读取 *p.
+ *
+ * @param p 指向变量的指针.
+ * @param mo 内存序, 见 XF_ATOMIC_*.
+ */
+#define xf_atomic_load(p, mo)                   __atomic_load_n((p), (mo))
+
+/**
+ * @brief 原子写入 *p = v.
+ */
+#define xf_atomic_store(p, v, mo)               __atomic_store_n((p), (v), (mo))
+
+/**
+ * @brief 原子交换, 返回旧值.
+ */
+#define xf_atomic_exchange(p, v, mo)            __atomic_exchange_n((p), (v), (mo))
+
+/**
+ * @brief 比较并交换. *p == *p_expected 时写入 desired 并返回 true,
+ *        否则将 *p 的当前值写入 *p_expected 并返回 false.
+ */
+#define xf_atomic_cas(p, p_expected, desired, mo_succ, mo_fail) \
+    __atomic_compare_exchange_n((p), (p_expected), (desired), 0, (mo_succ), (mo_fail))
+
+/**
+ * @brief 同 xf_atomic_cas(), 但允许伪失败, 适合在循环中使用.
+ */
+#define xf_atomic_cas_weak(p, p_expected, desired, mo_succ, mo_fail) \
+    __atomic_compare_exchange_n((p), (p_expected), (desired), 1, (mo_succ), (mo_fail))
+
+/**
+ * @brief 原子加/减/或/与, 返回旧值.
+ */
+#define xf_atomic_fetch_add(p, v, mo)           __atomic_fetch_add((p), (v), (mo))
+#define xf_atomic_fetch_sub(p, v, mo)           __atomic_fetch_sub((p), (v), (mo))
+#define xf_atomic_fetch_or(p, v, mo)            __atomic_fetch_or((p), (v), (mo))
+#define xf_atomic_fetch_and(p, v, mo)           __atomic_fetch_and((p), (v), (mo))
+
+/**
+ * @brief 内存屏障.
+ */
+#define xf_atomic_thread_fence(mo)              __atomic_thread_fence(mo)
+
+/**
+ * @brief 编译器屏障, 只阻止编译器重排.
+ */
+#define xf_atomic_signal_fence(mo)              __atomic_signal_fence(mo)
+
+#else /* !XF_ATOMIC_IS_SUPPORTED */
+
+/* 读-改-写操作依赖编译器支持, 此处只提供普通读写 */
+#define xf_atomic_load(p, mo)                   (*(p))
+#define xf_atomic_store(p, v, mo)               ((void)(*(p) = (v)))
+#define xf_atomic_thread_fence(mo)              ((void)0)
+#define xf_atomic_signal_fence(mo)              ((void)0)
+
+#endif /* XF_ATOMIC_IS_SUPPORTED */
+
+/**
+ * @brief 自旋等待时提示 CPU 降低功耗、让出流水线.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#   define xf_cpu_relax()                       __builtin_ia32_pause()
+#elif defined(__GNUC__) && (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+#   define xf_cpu_relax()                       __asm__ __volatile__("yield" ::: "memory")
+#elif XF_ATOMIC_IS_SUPPORTED
+#   define xf_cpu_relax()                       xf_atomic_signal_fence(XF_ATOMIC_SEQ_CST)
+#else
+#   define xf_cpu_relax()                       ((void)0)
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+/**
+ * End of group_xf_utils_common_atomic
+ * @}
+ */
+
+#endif /* __XF_ATOMIC_H__ */
@@ -130,10 +130,58 @@ extern "C" {
 
 #endif // XF_ATTRIBUTE_IS_ENABLE
 
+/*
+ * 分支预测提示不改变语义, 关闭 XF_ATTRIBUTE_ENABLE 时退化为原表达式.
+ */
+#if !defined(likely)
+#   define likely(x) (x)
+#endif
+
+#if !defined(unlikely)
+#   define unlikely(x) (x)
+#endif
+
 /* ==================== [Global Prototypes] ================================= */
 
 /* ==================== [Macros] ============================================ */
 
+/*
+ * 以下为表达式而非属性, 不受 XF_ATTRIBUTE_ENABLE 控制, 不支持的编译器上为空操作.
+ */
+
+#if defined(__GNUC__)
+/**
+ * @brief 提示 CPU 将 addr 所在的缓存行预取到缓存中, 准备读取.
+ *        addr 可以是任意值（包括无效地址）, 不会引起访问错误.
+ *
+ * @param addr 将要读取的地址.
+ */
+#   define xf_prefetch(addr)            __builtin_prefetch((addr), 0, 3)
+
+/**
+ * @brief 同 xf_prefetch(), 准备写入.
+ *
+ * @param addr 将要写入的地址.
+ */
+#   define xf_prefetch_w(addr)          __builtin_prefetch((addr), 1, 3)
+#else
+#   define xf_prefetch(addr)            ((void)(addr))
+#   define xf_prefetch_w(addr)          ((void)(addr))
+#endif
+
+/**
+ * @brief 线程局部存储说明符. 不受 XF_ATTRIBUTE_ENABLE 控制.
+ *
+ * 编译器不支持时不定义, 依赖线程局部变量的模块应当以 #error 报错.
+ */
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+#   define XF_THREAD_LOCAL              thread_local
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#   define XF_THREAD_LOCAL              _Thread_local
+#elif defined(__GNUC__)
+#   define XF_THREAD_LOCAL              __thread
+#endif
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -435,6 +435,86 @@ extern "C" {
     ((src) = BITS_GET_MODIFY((src), (n), (offset), (value)))
 #endif
 
+/**
+ * @name 位扫描与计数（按字操作）。
+ *
+ * GNU 编译器下直接映射到 `__builtin_*`，通常会被编译为单条指令
+ * （如 x86 的 `tzcnt`/`lzcnt`/`popcnt`，ARM 的 `rbit`+`clz`）。
+ * 其余编译器使用可移植的 C 实现。
+ *
+ * @attention `xf_bit_ctz*` 与 `xf_bit_clz*` 在 x 为 0 时结果未定义。
+ * @{
+ */
+#ifndef __ASSEMBLER__
+#if defined(__GNUC__)
+
+/**
+ * @brief 获取 `unsigned long` 类型 x 从 bit0 起连续 0 的个数。
+ */
+#   define xf_bit_ctzl(x)               __builtin_ctzl(x)
+/**
+ * @brief 获取 `unsigned long long` 类型 x 从 bit0 起连续 0 的个数。
+ */
+#   define xf_bit_ctzll(x)              __builtin_ctzll(x)
+/**
+ * @brief 获取 `unsigned long` 类型 x 从最高位起连续 0 的个数。
+ */
+#   define xf_bit_clzl(x)               __builtin_clzl(x)
+/**
+ * @brief 获取 `unsigned long long` 类型 x 从最高位起连续 0 的个数。
+ */
+#   define xf_bit_clzll(x)              __builtin_clzll(x)
+/**
+ * @brief 获取 `unsigned long` 类型 x 中 1 的个数。
+ */
+#   define xf_bit_popcountl(x)          __builtin_popcountl(x)
+/**
+ * @brief 获取 `unsigned long long` 类型 x 中 1 的个数。
+ */
+#   define xf_bit_popcountll(x)         __builtin_popcountll(x)
+
+#else /* !defined(__GNUC__) */
+
+static inline int xf_bit_ctzll(unsigned long long x)
+{
+    int n = 0;
+    while (!(x & 1ULL)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+}
+
+static inline int xf_bit_clzll(unsigned long long x)
+{
+    int n = (int)(sizeof(x) * 8) - 1;
+    while (!(x >> n)) {
+        n--;
+    }
+    return (int)(sizeof(x) * 8) - 1 - n;
+}
+
+static inline int xf_bit_popcountll(unsigned long long x)
+{
+    /* SWAR 计数，见 "Hacker's Delight" 5-1 */
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+}
+
+#   define xf_bit_ctzl(x)               xf_bit_ctzll((unsigned long)(x))
+#   define xf_bit_clzl(x)               (xf_bit_clzll((unsigned long)(x)) \
+                                            - (int)((sizeof(unsigned long long) - sizeof(unsigned long)) * 8))
+#   define xf_bit_popcountl(x)          xf_bit_popcountll((unsigned long)(x))
+
+#endif /* defined(__GNUC__) */
+#endif /* __ASSEMBLER__ */
+/**
+ * End of 位扫描与计数（按字操作）。
+ * @}
+ */
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -0,0 +1,249 @@
+/**
+ * @file xf_bitmap.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 任意长度位图.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_bitmap.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define BPW                             XF_BITMAP_BITS_PER_WORD
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static size_t _find_next(const xf_bitmap_word_t *map, size_t nbits,
+                         size_t offset, xf_bitmap_word_t invert);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* 从 start 位所在字的 start 位起（含）全为 1 的掩码 */
+#define FIRST_WORD_MASK(start)  (~(xf_bitmap_word_t)0 << ((start) % BPW))
+/* 到 nbits 位所在字的 nbits 位止（不含）全为 1 的掩码, nbits 对齐时为全 1 */
+#define LAST_WORD_MASK(nbits)   (~(xf_bitmap_word_t)0 >> (-(nbits) & (BPW - 1)))
+
+/* ==================== [Global Functions] ================================== */
+
+void xf_bitmap_zero(xf_bitmap_word_t *map, size_t nbits)
+{
+    size_t words = XF_BITMAP_WORDS(nbits);
+    for (size_t i = 0; i < words; i++) {
+        map[i] = 0;
+    }
+}
+
+void xf_bitmap_fill(xf_bitmap_word_t *map, size_t nbits)
+{
+    size_t words = XF_BITMAP_WORDS(nbits);
+    for (size_t i = 0; i < words; i++) {
+        map[i] = ~(xf_bitmap_word_t)0;
+    }
+    if (words) {
+        map[words - 1] = LAST_WORD_MASK(nbits);
+    }
+}
+
+void xf_bitmap_set(xf_bitmap_word_t *map, size_t start, size_t len)
+{
+    xf_bitmap_word_t *p = map + start / BPW;
+    const size_t end = start + len;
+    size_t bits_to_set = BPW - (start % BPW);
+    xf_bitmap_word_t mask = FIRST_WORD_MASK(start);
+
+    while (len >= bits_to_set) {
+        *p++ |= mask;
+        len -= bits_to_set;
+        bits_to_set = BPW;
+        mask = ~(xf_bitmap_word_t)0;
+    }
+    if (len) {
+        mask &= LAST_WORD_MASK(end);
+        *p |= mask;
+    }
+}
+
+void xf_bitmap_clear(xf_bitmap_word_t *map, size_t start, size_t len)
+{
+    xf_bitmap_word_t *p = map + start / BPW;
+    const size_t end = start + len;
+    size_t bits_to_clear = BPW - (start % BPW);
+    xf_bitmap_word_t mask = FIRST_WORD_MASK(start);
+
+    while (len >= bits_to_clear) {
+        *p++ &= ~mask;
+        len -= bits_to_clear;
+        bits_to_clear = BPW;
+        mask = ~(xf_bitmap_word_t)0;
+    }
+    if (len) {
+        mask &= LAST_WORD_MASK(end);
+        *p &= ~mask;
+    }
+}
+
+bool xf_bitmap_is_range_set(const xf_bitmap_word_t *map, size_t start, size_t len)
+{
+    const xf_bitmap_word_t *p = map + start / BPW;
+    const size_t end = start + len;
+    size_t bits_to_check = BPW - (start % BPW);
+    xf_bitmap_word_t mask = FIRST_WORD_MASK(start);
+
+    while (len >= bits_to_check) {
+        if ((*p++ & mask) != mask) {
+            return false;
+        }
+        len -= bits_to_check;
+        bits_to_check = BPW;
+        mask = ~(xf_bitmap_word_t)0;
+    }
+    if (len) {
+        mask &= LAST_WORD_MASK(end);
+        if ((*p & mask) != mask) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool xf_bitmap_is_range_clear(const xf_bitmap_word_t *map, size_t start, size_t len)
+{
+    const xf_bitmap_word_t *p = map + start / BPW;
+    const size_t end = start + len;
+    size_t bits_to_check = BPW - (start % BPW);
+    xf_bitmap_word_t mask = FIRST_WORD_MASK(start);
+
+    while (len >= bits_to_check) {
+        if (*p++ & mask) {
+            return false;
+        }
+        len -= bits_to_check;
+        bits_to_check = BPW;
+        mask = ~(xf_bitmap_word_t)0;
+    }
+    if (len) {
+        mask &= LAST_WORD_MASK(end);
+        if (*p & mask) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t xf_bitmap_find_next_set(const xf_bitmap_word_t *map, size_t nbits, size_t offset)
+{
+    return _find_next(map, nbits, offset, 0);
+}
+
+size_t xf_bitmap_find_next_zero(const xf_bitmap_word_t *map, size_t nbits, size_t offset)
+{
+    return _find_next(map, nbits, offset, ~(xf_bitmap_word_t)0);
+}
+
+size_t xf_bitmap_find_zero_area(
+    const xf_bitmap_word_t *map, size_t nbits, size_t start, size_t len)
+{
+    while (1) {
+        size_t index = xf_bitmap_find_next_zero(map, nbits, start);
+        size_t end = index + len;
+        if ((end > nbits) || (end < index)) {
+            return nbits;
+        }
+        /* 区间内存在 1 则从该位之后重新查找 */
+        size_t i = xf_bitmap_find_next_set(map, end, index);
+        if (i >= end) {
+            return index;
+        }
+        start = i + 1;
+    }
+}
+
+/*
+ * 以下按字运算的循环不含分支, 编译器在 -O2 及以上可自动向量化.
+ * dst 可能与源重叠, 因此不使用 restrict.
+ */
+
+void xf_bitmap_and(xf_bitmap_word_t *dst, const xf_bitmap_word_t *src1,
+                   const xf_bitmap_word_t *src2, size_t nbits)
+{
+    size_t words = XF_BITMAP_WORDS(nbits);
+    for (size_t i = 0; i < words; i++) {
+        dst[i] = src1[i] & src2[i];
+    }
+}
+
+void xf_bitmap_or(xf_bitmap_word_t *dst, const xf_bitmap_word_t *src1,
+                  const xf_bitmap_word_t *src2, size_t nbits)
+{
+    size_t words = XF_BITMAP_WORDS(nbits);
+    for (size_t i = 0; i < words; i++) {
+        dst[i] = src1[i] | src2[i];
+    }
+}
+
+void xf_bitmap_xor(xf_bitmap_word_t *dst, const xf_bitmap_word_t *src1,
+                   const xf_bitmap_word_t *src2, size_t nbits)
+{
+    size_t words = XF_BITMAP_WORDS(nbits);
+    for (size_t i = 0; i < words; i++) {
+        dst[i] = src1[i] ^ src2[i];
+    }
+}
+
+void xf_bitmap_andnot(xf_bitmap_word_t *dst, const xf_bitmap_word_t *src1,
+                      const xf_bitmap_word_t *src2, size_t nbits)
+{
+    size_t words = XF_BITMAP_WORDS(nbits);
+    for (size_t i = 0; i < words; i++) {
+        dst[i] = src1[i] & ~src2[i];
+    }
+}
+
+size_t xf_bitmap_weight(const xf_bitmap_word_t *map, size_t nbits)
+{
+    size_t full = nbits / BPW;
+    size_t w = 0;
+    for (size_t i = 0; i < full; i++) {
+        w += (size_t)xf_bit_popcountl(map[i]);
+    }
+    if (nbits % BPW) {
+        w += (size_t)xf_bit_popcountl(map[full] & LAST_WORD_MASK(nbits));
+    }
+    return w;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 查找下一个 (map ^ invert) 为 1 的位.
+ *
+ * invert 为 0 时查找 1, 为全 1 时查找 0.
+ */
+static size_t _find_next(const xf_bitmap_word_t *map, size_t nbits,
+                         size_t offset, xf_bitmap_word_t invert)
+{
+    if (offset >= nbits) {
+        return nbits;
+    }
+    size_t idx = offset / BPW;
+    xf_bitmap_word_t tmp = (map[idx] ^ invert) & FIRST_WORD_MASK(offset);
+    while (tmp == 0) {
+        idx++;
+        if (idx * BPW >= nbits) {
+            return nbits;
+        }
+        tmp = map[idx] ^ invert;
+    }
+    size_t ret = idx * BPW + (size_t)xf_bit_ctzl(tmp);
+    return (ret < nbits) ? ret : nbits;
+}
@@ -0,0 +1,334 @@
+/**
+ * @file xf_bitmap.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 任意长度位图.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 位图以 `xf_bitmap_word_t`（`unsigned long`）数组存储，bit n 位于
+ * `map[n / XF_BITMAP_BITS_PER_WORD]` 的第 `n % XF_BITMAP_BITS_PER_WORD` 位。
+ *
+ * 所有区间操作及查找操作都按字进行，查找一个空闲位的复杂度为 O(n / 字宽)，
+ * 而不是逐位扫描的 O(n)。
+ *
+ * @note 位图末尾超出 nbits 的位不保证为 0，
+ *       接口内部读取时会屏蔽这些位，调用者无需关心。
+ */
+
+#ifndef __XF_BITMAP_H__
+#define __XF_BITMAP_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_common_config.h"
+#include "xf_bit_defs.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdbool.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils_common
+ * @defgroup group_xf_utils_common_bitmap xf_bitmap
+ * @brief 任意长度位图，按字并行操作。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 每个位图字的位数。
+ */
+#define XF_BITMAP_BITS_PER_WORD         (sizeof(xf_bitmap_word_t) * 8)
+
+/**
+ * @brief 存放 nbits 个位所需的字数。
+ */
+#define XF_BITMAP_WORDS(nbits) \
+    (((nbits) + XF_BITMAP_BITS_PER_WORD - 1) / XF_BITMAP_BITS_PER_WORD)
+
+/**
+ * @brief 定义一个名为 `name`、可容纳 nbits 个位的位图。
+ *
+ * 示例如下：
+ * @code{c}
+ * static XF_BITMAP_DEFINE(s_slot_map, 4096);
+ * xf_bitmap_zero(s_slot_map, 4096);
+ * @endcode
+ */
+#define XF_BITMAP_DEFINE(name, nbits) \
+    xf_bitmap_word_t name[XF_BITMAP_WORDS(nbits)]
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 位图字类型。
+ */
+typedef unsigned long xf_bitmap_word_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 将位图中 bit 位置 1.
+ *
+ * @param map 位图.
+ * @param bit 比特下标, 从 0 开始.
+ */
+static inline void xf_bitmap_set_bit(xf_bitmap_word_t *map, size_t bit)
+{
+    map[bit / XF_BITMAP_BITS_PER_WORD] |=
+        (xf_bitmap_word_t)1 << (bit % XF_BITMAP_BITS_PER_WORD);
+}
+
+/**
+ * @brief 将位图中 bit 位置 0.
+ *
+ * @param map 位图.
+ * @param bit 比特下标, 从 0 开始.
+ */
+static inline void xf_bitmap_clear_bit(xf_bitmap_word_t *map, size_t bit)
+{
+    map[bit / XF_BITMAP_BITS_PER_WORD] &=
+        ~((xf_bitmap_word_t)1 << (bit % XF_BITMAP_BITS_PER_WORD));
+}
+
+/**
+ * @brief 翻转位图中 bit 位.
+ *
+ * @param map 位图.
+ * @param bit 比特下标, 从 0 开始.
+ */
+static inline void xf_bitmap_flip_bit(xf_bitmap_word_t *map, size_t bit)
+{
+    map[bit / XF_BITMAP_BITS_PER_WORD] ^=
+        (xf_bitmap_word_t)1 << (bit % XF_BITMAP_BITS_PER_WORD);
+}
+
+/**
+ * @brief 测试位图中 bit 位.
+ *
+ * @param map 位图.
+ * @param bit 比特下标, 从 0 开始.
+ * @return bool
+ *      - true          该位为 1
+ *      - false         该位为 0
+ */
+static inline bool xf_bitmap_test_bit(const xf_bitmap_word_t *map, size_t bit)
+{
+    return (map[bit / XF_BITMAP_BITS_PER_WORD]
+            >> (bit % XF_BITMAP_BITS_PER_WORD)) & 1;
+}
+
+/**
+ * @brief 将位图前 nbits 位全部置 0.
+ *
+ * @param map 位图.
+ * @param nbits 位图位数.
+ */
+void xf_bitmap_zero(xf_bitmap_word_t *map, size_t nbits);
+
+/**
+ * @brief 将位图前 nbits 位全部置 1.
+ *
+ * @param map 位图.
+ * @param nbits 位图位数.
+ */
+void xf_bitmap_fill(xf_bitmap_word_t *map, size_t nbits);
+
+/**
+ * @brief 将位图中 [start, start + len) 区间内的位置 1.
+ *
+ * @param map 位图.
+ * @param start 起始比特下标.
+ * @param len 位数.
+ */
+void xf_bitmap_set(xf_bitmap_word_t *map, size_t start, size_t len);
+
+/**
+ * @brief 将位图中 [start, start + len) 区间内的位置 0.
+ *
+ * @param map 位图.
+ * @param start 起始比特下标.
+ * @param len 位数.
+ */
+void xf_bitmap_clear(xf_bitmap_word_t *map, size_t start, size_t len);
+
+/**
+ * @brief 测试位图中 [start, start + len) 区间内的位是否全为 1.
+ *
+ * @param map 位图.
+ * @param start 起始比特下标.
+ * @param len 位数. 为 0 时返回 true.
+ * @return bool
+ *      - true          全为 1
+ *      - false         存在 0
+ */
+bool xf_bitmap_is_range_set(const xf_bitmap_word_t *map, size_t start, size_t len);
+
+/**
+ * @brief 测试位图中 [start, start + len) 区间内的位是否全为 0.
+ *
+ * @param map 位图.
+ * @param start 起始比特下标.
+ * @param len 位数. 为 0 时返回 true.
+ * @return bool
+ *      - true          全为 0
+ *      - false         存在 1
+ */
+bool xf_bitmap_is_range_clear(const xf_bitmap_word_t *map, size_t start, size_t len);
+
+/**
+ * @brief 从 offset 位开始（包括 offset）查找下一个为 1 的位.
+ *
+ * @param map 位图.
+ * @param nbits 位图位数.
+ * @param offset 起始查找位置.
+ * @return size_t 找到的比特下标, 未找到时返回 nbits.
+ */
+size_t xf_bitmap_find_next_set(const xf_bitmap_word_t *map, size_t nbits, size_t offset);
+
+/**
+ * @brief 从 offset 位开始（包括 offset）查找下一个为 0 的位.
+ *
+ * @param map 位图.
+ * @param nbits 位图位数.
+ * @param offset 起始查找位置.
+ * @return size_t 找到的比特下标, 未找到时返回 nbits.
+ */
+size_t xf_bitmap_find_next_zero(const xf_bitmap_word_t *map, size_t nbits, size_t offset);
+
+/**
+ * @brief 查找第一个为 1 的位.
+ *
+ * @param map 位图.
+ * @param nbits 位图位数.
+ * @return size_t 找到的比特下标, 未找到时返回 nbits.
+ */
+static inline size_t xf_bitmap_find_first_set(const xf_bitmap_word_t *map, size_t nbits)
+{
+    return xf_bitmap_find_next_set(map, nbits, 0);
+}
+
+/**
+ * @brief 查找第一个为 0 的位.
+ *
+ * @param map 位图.
+ * @param nbits 位图位数.
+ * @return size_t 找到的比特下标, 未找到时返回 nbits.
+ */
+static inline size_t xf_bitmap_find_first_zero(const xf_bitmap_word_t *map, size_t nbits)
+{
+    return xf_bitmap_find_next_zero(map, nbits, 0);
+}
+
+/**
+ * @brief 从 start 位开始查找连续 len 个为 0 的区间.
+ *
+ * 适用于在分配表中查找连续的空闲槽位。
+ *
+ * @param map 位图.
+ * @param nbits 位图位数.
+ * @param start 起始查找位置.
+ * @param len 需要的连续 0 的个数.
+ * @return size_t 区间的起始比特下标, 未找到时返回 nbits.
+ */
+size_t xf_bitmap_find_zero_area(
+    const xf_bitmap_word_t *map, size_t nbits, size_t start, size_t len);
+
+/**
+ * @brief dst = src1 & src2.
+ *
+ * @param dst 结果位图, 可以与 src1 或 src2 相同.
+ * @param src1 源位图 1.
+ * @param src2 源位图 2.
+ * @param nbits 位图位数.
+ */
+void xf_bitmap_and(xf_bitmap_word_t *dst, const xf_bitmap_word_t *src1,
+                   const xf_bitmap_word_t *src2, size_t nbits);
+
+/**
+ * @brief dst = src1 | src2.
+ *
+ * @param dst 结果位图, 可以与 src1 或 src2 相同.
+ * @param src1 源位图 1.
+ * @param src2 源位图 2.
+ * @param nbits 位图位数.
+ */
+void xf_bitmap_or(xf_bitmap_word_t *dst, const xf_bitmap_word_t *src1,
+                  const xf_bitmap_word_t *src2, size_t nbits);
+
+/**
+ * @brief dst = src1 ^ src2.
+ *
+ * @param dst 结果位图, 可以与 src1 或 src2 相同.
+ * @param src1 源位图 1.
+ * @param src2 源位图 2.
+ * @param nbits 位图位数.
+ */
+void xf_bitmap_xor(xf_bitmap_word_t *dst, const xf_bitmap_word_t *src1,
+                   const xf_bitmap_word_t *src2, size_t nbits);
+
+/**
+ * @brief dst = src1 & ~src2.
+ *
+ * @param dst 结果位图, 可以与 src1 或 src2 相同.
+ * @param src1 源位图 1.
+ * @param src2 源位图 2.
+ * @param nbits 位图位数.
+ */
+void xf_bitmap_andnot(xf_bitmap_word_t *dst, const xf_bitmap_word_t *src1,
+                      const xf_bitmap_word_t *src2, size_t nbits);
+
+/**
+ * @brief 计算位图前 nbits 位中 1 的个数.
+ *
+ * @param map 位图.
+ * @param nbits 位图位数.
+ * @return size_t 1 的个数.
+ */
+size_t xf_bitmap_weight(const xf_bitmap_word_t *map, size_t nbits);
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 遍历位图中所有为 1 的位.
+ *
+ * @param bit 迭代游标（size_t）.
+ * @param map 位图.
+ * @param nbits 位图位数.
+ */
+#define xf_bitmap_for_each_set_bit(bit, map, nbits) \
+    for ((bit) = xf_bitmap_find_first_set((map), (nbits)); \
+         (bit) < (nbits); \
+         (bit) = xf_bitmap_find_next_set((map), (nbits), (bit) + 1))
+
+/**
+ * @brief 遍历位图中所有为 0 的位.
+ *
+ * @param bit 迭代游标（size_t）.
+ * @param map 位图.
+ * @param nbits 位图位数.
+ */
+#define xf_bitmap_for_each_zero_bit(bit, map, nbits) \
+    for ((bit) = xf_bitmap_find_first_zero((map), (nbits)); \
+         (bit) < (nbits); \
+         (bit) = xf_bitmap_find_next_zero((map), (nbits), (bit) + 1))
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+/**
+ * End of group_xf_utils_common_bitmap
+ * @}
+ */
+
+#endif /* __XF_BITMAP_H__ */
@@ -30,6 +30,9 @@
 #include "xf_err.h"
 #include "xf_bit_defs.h"
 #include "xf_list.h"
+#include "xf_bitmap.h"
+#include "xf_vec.h"
+#include "xf_atomic.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +41,18 @@ extern "C" {
 #   define XF_ATTRIBUTE_IS_ENABLE (0)
 #endif
 
+/**
+ * @brief xf_list_for_each_*_prefetch() 在游标之前预取的节点数, 1 ~ 16.
+ *
+ * 每个节点的处理耗时越短、内存延迟越长, 需要的距离越大.
+ */
+#if !defined(XF_LIST_PREFETCH_DISTANCE)
+#   define XF_LIST_PREFETCH_DISTANCE    (4)
+#endif
+#if (XF_LIST_PREFETCH_DISTANCE < 1) || (XF_LIST_PREFETCH_DISTANCE > 16)
+#   error "XF_LIST_PREFETCH_DISTANCE must be in [1, 16]"
+#endif
+
 /**
  * @brief 主要版本号 (X.x.x).
  */
@@ -18,6 +18,8 @@
  * 1. 添加 `xf_` 前缀防止冲突. 优先使用类型定义而不是结构体.
  * 2. 添加中文注释.
  * 3. 移除 GNU 特性, 如 `typeof`, 因此需要显式写出类型.
+ * 4. 添加 RCU 变体（*_rcu）, 读者无锁遍历, 配合 xf_epoch 延迟释放.
+ * 5. 添加预取变体（*_prefetch）, 遍历长链表时提前预取之后的节点.
  */
 
 /*
@@ -33,6 +35,8 @@
 /* ==================== [Includes] ========================================== */
 
 #include "xf_predef.h"
+#include "xf_attr.h"
+#include "xf_atomic.h"
 
 /**
  * @cond XFAPI_USER
@@ -573,6 +577,115 @@ static inline void xf_list_splice_tail_init(xf_list_t *list, xf_list_t *head)
     }
 }
 
+/*
+ * 以下 *_rcu 变体用于"读多写少"的链表: 读者不加锁, 用 xf_list_for_each_entry_rcu() 遍历;
+ * 写者之间仍需自行互斥（如 xf_lock）. 写者先填好新节点的指针再以 release 发布,
+ * 删除时保留被删节点的 next, 正在访问它的读者可以继续向后遍历.
+ * 被删节点要等读者离开后才能释放, 见 xf_epoch_retire() / xf_epoch_synchronize().
+ *
+ * 读者只能向后遍历, RCU 链表上不能使用 prev 方向的操作.
+ */
+
+/**
+ * @brief 在已知的前后节点之间插入新节点, 并向无锁读者发布.
+ *
+ * @attention 仅用于内部链表操作.
+ */
+static inline void __xf_list_add_rcu(xf_list_t *new_node, xf_list_t *prev, xf_list_t *next)
+{
+    new_node->next = next;
+    new_node->prev = prev;
+    /* 新节点的内容先于指向它的指针可见 */
+    xf_atomic_store(&prev->next, new_node, XF_ATOMIC_RELEASE);
+    next->prev = new_node;
+}
+
+/**
+ * @brief xf_list_add_rcu - 在 head 之后插入节点, 可与 xf_list_for_each_entry_rcu() 并发.
+ *
+ * @param new_node 要添加的节点, 其所在对象须在调用前初始化完毕.
+ * @param head 在此节点之后插入.
+ */
+static inline void xf_list_add_rcu(xf_list_t *new_node, xf_list_t *head)
+{
+    __xf_list_add_rcu(new_node, head, head->next);
+}
+
+/**
+ * @brief xf_list_add_tail_rcu - 在 head 之前（链表末尾）插入节点,
+ *        可与 xf_list_for_each_entry_rcu() 并发.
+ *
+ * @param new_node 要添加的节点, 其所在对象须在调用前初始化完毕.
+ * @param head 在此节点之前插入.
+ */
+static inline void xf_list_add_tail_rcu(xf_list_t *new_node, xf_list_t *head)
+{
+    __xf_list_add_rcu(new_node, head->prev, head);
+}
+
+/**
+ * @brief xf_list_del_rcu - 从链表中删除节点, 可与 xf_list_for_each_entry_rcu() 并发.
+ *
+ * entry->next 保持不变, 只毒化 entry->prev.
+ * 节点在宽限期结束之前不能释放, 也不能重新插入链表.
+ *
+ * @param entry 要从链表中删除的元素.
+ */
+static inline void xf_list_del_rcu(xf_list_t *entry)
+{
+    xf_list_t *prev = entry->prev;
+    xf_list_t *next = entry->next;
+    next->prev = prev;
+    /* next 虽然已经发布过, 读者经由这次写入到达它时仍需 release 才能与其初始化同步 */
+    xf_atomic_store(&prev->next, next, XF_ATOMIC_RELEASE);
+    entry->prev = (xf_list_t *)XF_LIST_POISON2;
+}
+
+/**
+ * @brief xf_list_replace_rcu - 用 new_node 替换旧节点, 可与 xf_list_for_each_entry_rcu() 并发.
+ *
+ * 读者要么看到 old, 要么看到 new_node, 不会两者都错过.
+ * old 的 next 保持不变, 宽限期结束之前不能释放.
+ *
+ * @param old 被替换的节点.
+ * @param new_node 要插入的节点, 其所在对象须在调用前初始化完毕.
+ */
+static inline void xf_list_replace_rcu(xf_list_t *old, xf_list_t *new_node)
+{
+    new_node->next = old->next;
+    new_node->prev = old->prev;
+    xf_atomic_store(&new_node->prev->next, new_node, XF_ATOMIC_RELEASE);
+    new_node->next->prev = new_node;
+    old->prev = (xf_list_t *)XF_LIST_POISON2;
+}
+
+/**
+ * @brief 读者读取 next 指针. 与写者的 release 发布配对.
+ *
+ * @attention 仅用于内部链表操作.
+ */
+static inline xf_list_t *__xf_list_next_rcu(const xf_list_t *pos)
+{
+    return xf_atomic_load(&pos->next, XF_ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief 预取游标从 pf 向后移动 distance 个节点并逐个预取, 到达 head 后停住.
+ *
+ * @attention 仅用于内部链表操作.
+ *
+ * @return xf_list_t* 移动后的预取游标.
+ */
+static inline xf_list_t *__xf_list_prefetch_ahead(
+    xf_list_t *pf, const xf_list_t *head, unsigned int distance)
+{
+    while ((distance-- > 0) && (pf != head)) {
+        pf = pf->next;
+        xf_prefetch(pf);
+    }
+    return pf;
+}
+
 /* ==================== [Macros] ============================================ */
 
 /*
@@ -999,6 +1112,103 @@ static inline void xf_list_splice_tail_init(xf_list_t *list, xf_list_t *head)
 #define xf_list_safe_reset_next(pos, n, type, member) \
     (n) = xf_list_entry((pos)->member.next, type, member)
 
+/**
+ * @brief xf_list_for_each_prefetch - 遍历链表, 同时预取之后的节点.
+ *
+ * 与 xf_list_for_each() 相同, 但另有一个预取游标保持在 pos 之前
+ * XF_LIST_PREFETCH_DISTANCE 个节点, 使访问 pos 时它已在缓存中.
+ * 适合节点分散在内存中、远大于缓存的长链表; 短链表或节点连续分配时没有收益.
+ *
+ * @attention 循环体内不能删除 pos 之后的节点.
+ *
+ * @param pos 用作循环游标的 &xf_list_t.
+ * @param head 链表头.
+ */
+#define xf_list_for_each_prefetch(pos, head) \
+    for (xf_list_t *__xf_pf = ((pos) = (head)->next, \
+                __xf_list_prefetch_ahead((pos), (head), XF_LIST_PREFETCH_DISTANCE)); \
+            (pos) != (head); \
+            (pos) = (pos)->next, __xf_pf = __xf_list_prefetch_ahead(__xf_pf, (head), 1))
+
+/**
+ * @brief xf_list_for_each_entry_prefetch_n - 遍历给定类型的链表, 同时预取之后 distance 个节点.
+ *
+ * @attention 循环体内不能删除 pos 之后的节点.
+ *
+ * @param pos 用作循环游标的结构体指针（类型为参数 type 的指针）.
+ * @param head 链表头.
+ * @param type 含有链表节点的结构体的类型.
+ * @param member 链表节点在结构体中的成员名.
+ * @param distance 预取距离（节点数）, 至少为 1.
+ */
+#define xf_list_for_each_entry_prefetch_n(pos, head, type, member, distance) \
+    for (xf_list_t *__xf_pf = ((pos) = xf_list_entry((head)->next, type, member), \
+                __xf_list_prefetch_ahead(&(pos)->member, (head), (distance))); \
+            &(pos)->member != (head); \
+            (pos) = xf_list_entry((pos)->member.next, type, member), \
+            __xf_pf = __xf_list_prefetch_ahead(__xf_pf, (head), 1))
+
+/**
+ * @brief xf_list_for_each_entry_prefetch - 遍历给定类型的链表, 同时预取之后的节点.
+ *
+ * 预取距离为 XF_LIST_PREFETCH_DISTANCE, 见 xf_list_for_each_prefetch().
+ *
+ * @param pos 用作循环游标的结构体指针（类型为参数 type 的指针）.
+ * @param head 链表头.
+ * @param type 含有链表节点的结构体的类型.
+ * @param member 链表节点在结构体中的成员名.
+ */
+#define xf_list_for_each_entry_prefetch(pos, head, type, member) \
+    xf_list_for_each_entry_prefetch_n(pos, head, type, member, XF_LIST_PREFETCH_DISTANCE)
+
+/**
+ * @brief xf_list_for_each_entry_safe_prefetch - 遍历给定类型的链表, 可以删除 pos,
+ *        同时预取之后的节点.
+ *
+ * @attention 循环体内只能删除 pos, 不能删除之后的节点.
+ *
+ * @param pos 用作循环游标的结构体指针（类型为参数 type 的指针）.
+ * @param n 用作临时存储的结构体指针（类型为参数 type 的指针）.
+ * @param head 链表头.
+ * @param type 含有链表节点的结构体的类型.
+ * @param member 链表节点在结构体中的成员名.
+ */
+#define xf_list_for_each_entry_safe_prefetch(pos, n, head, type, member) \
+    for (xf_list_t *__xf_pf = ((pos) = xf_list_entry((head)->next, type, member), \
+                (n) = xf_list_entry((pos)->member.next, type, member), \
+                __xf_list_prefetch_ahead(&(pos)->member, (head), XF_LIST_PREFETCH_DISTANCE)); \
+            &(pos)->member != (head); \
+            (pos) = (n), (n) = xf_list_entry((n)->member.next, type, member), \
+            __xf_pf = __xf_list_prefetch_ahead(__xf_pf, (head), 1))
+
+/**
+ * @brief xf_list_for_each_rcu - 无锁遍历链表, 可与 *_rcu 写操作并发.
+ *
+ * 需要在读者临界区（xf_epoch_enter() / xf_epoch_exit()）内调用.
+ *
+ * @param pos 用作循环游标的 &xf_list_t.
+ * @param head 链表头.
+ */
+#define xf_list_for_each_rcu(pos, head) \
+    for (pos = __xf_list_next_rcu(head); pos != (head); \
+            pos = __xf_list_next_rcu(pos))
+
+/**
+ * @brief xf_list_for_each_entry_rcu - 无锁遍历给定类型的链表, 可与 *_rcu 写操作并发.
+ *
+ * 需要在读者临界区（xf_epoch_enter() / xf_epoch_exit()）内调用,
+ * pos 只在临界区内有效.
+ *
+ * @param pos 用作循环游标的结构体指针（类型为参数 type 的指针）.
+ * @param head 链表头.
+ * @param type 含有链表节点的结构体的类型.
+ * @param member 链表节点在结构体中的成员名.
+ */
+#define xf_list_for_each_entry_rcu(pos, head, type, member) \
+    for (pos = xf_list_entry(__xf_list_next_rcu(head), type, member); \
+            &pos->member != (head); \
+            pos = xf_list_entry(__xf_list_next_rcu(&pos->member), type, member))
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
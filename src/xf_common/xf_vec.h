@@ -0,0 +1,448 @@
+/**
+ * @file xf_vec.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 按元素类型由宏生成的动态数组.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 与 xf_list 不同, 元素连续存放, 遍历时对缓存友好.
+ * 由于不使用 `typeof` 等 GNU 特性, 需要先用 XF_VEC_DEFINE() 为每种元素类型
+ * 生成一组类型安全的 static inline 函数, 例如:
+ *
+ * @code{.c}
+ * XF_VEC_DEFINE(u32_vec, uint32_t)
+ *
+ * u32_vec_t v;
+ * u32_vec_init(&v);
+ * u32_vec_push(&v, 3);
+ * u32_vec_push(&v, 1);
+ * u32_vec_sort(&v, u32_cmp);
+ * uint32_t *it;
+ * xf_vec_for_each(it, &v) {
+ *     ...
+ * }
+ * u32_vec_deinit(&v);
+ * @endcode
+ *
+ * - 内存通过 xf_malloc/xf_free 分配, 容量按 2 倍增长, push 均摊 O(1);
+ * - 元素按值复制（赋值）, 扩容后元素地址会改变, 不要长期保存元素指针;
+ * - 排序为原地内省排序（快速排序 + 堆排序兜底 + 插入排序）, 不分配内存,
+ *   最坏 O(n log n), 不稳定.
+ */
+
+#ifndef __XF_VEC_H__
+#define __XF_VEC_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_common_config.h"
+#include "xf_err.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_std/xf_string.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils_common
+ * @defgroup group_xf_utils_common_vec xf_vec
+ * @brief 按元素类型由宏生成的动态数组。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 首次分配时的最小元素个数.
+ */
+#if !defined(XF_VEC_MIN_CAP)
+#   define XF_VEC_MIN_CAP               (8)
+#endif
+
+/**
+ * @brief 排序时不超过该长度的区间使用插入排序.
+ */
+#if !defined(XF_VEC_SORT_INSERTION_THRESHOLD)
+#   define XF_VEC_SORT_INSERTION_THRESHOLD  (16)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 计算扩容后的容量: 不小于 need, 且至少为原来的 2 倍.
+ *
+ * @attention 内部函数.
+ *
+ * @param cap 当前容量.
+ * @param need 需要的容量.
+ * @return size_t 新容量.
+ */
+static inline size_t __xf_vec_next_cap(size_t cap, size_t need)
+{
+    size_t new_cap = (cap < XF_VEC_MIN_CAP) ? XF_VEC_MIN_CAP : cap;
+    while (new_cap < need) {
+        if (new_cap > ((size_t)-1) / 2) {
+            return need;
+        }
+        new_cap *= 2;
+    }
+    return new_cap;
+}
+
+/**
+ * @brief 重新分配数组: 分配 new_cap 个元素, 复制前 len 个, 释放旧数组.
+ *
+ * @attention 内部函数.
+ *
+ * @param data 旧数组, 可为 NULL.
+ * @param len 需要保留的元素个数.
+ * @param new_cap 新容量（元素个数）, 不小于 len.
+ * @param elem_size 元素大小.
+ * @return void* 新数组, 内存不足时返回 NULL 且旧数组不变.
+ */
+static inline void *__xf_vec_realloc(void *data, size_t len, size_t new_cap, size_t elem_size)
+{
+    if (new_cap > ((size_t)-1) / elem_size) {
+        return NULL;
+    }
+    void *p = xf_malloc(new_cap * elem_size);
+    if (NULL == p) {
+        return NULL;
+    }
+    if (len > 0) {
+        xf_memcpy(p, data, len * elem_size);
+    }
+    if (NULL != data) {
+        xf_free(data);
+    }
+    return p;
+}
+
+/**
+ * @brief 内省排序的递归深度上限 2 * floor(log2(n)).
+ *
+ * @attention 内部函数.
+ */
+static inline size_t __xf_vec_sort_depth(size_t n)
+{
+    size_t depth = 0;
+    while (n > 1) {
+        n >>= 1;
+        depth += 2;
+    }
+    return depth;
+}
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 为元素类型 type 生成动态数组类型 `name##_t` 及其操作函数.
+ *
+ * 生成的函数（v 为 `name##_t *`）:
+ * - `void name##_init(v)`: 初始化为空数组, 不分配内存.
+ * - `void name##_deinit(v)`: 释放内存并重置为空数组.
+ * - `xf_err_t name##_reserve(v, cap)`: 保证容量不小于 cap 个元素.
+ * - `xf_err_t name##_push(v, value)`: 追加到末尾, 均摊 O(1).
+ * - `type *name##_emplace(v)`: 在末尾追加一个未初始化元素并返回其地址, 内存不足时返回 NULL.
+ * - `bool name##_pop(v, out)`: 取出末尾元素到 out（可为 NULL）, 空数组返回 false.
+ * - `xf_err_t name##_insert(v, index, value)`: 插入到 index（<= len）处, 后续元素后移.
+ * - `xf_err_t name##_erase(v, index)`: 删除 index 处元素, 后续元素前移, 保持顺序.
+ * - `xf_err_t name##_swap_remove(v, index)`: 用末尾元素覆盖 index 处元素, O(1), 不保持顺序.
+ * - `void name##_clear(v)`: 清空, 保留容量.
+ * - `xf_err_t name##_shrink(v)`: 释放多余容量.
+ * - `void name##_sort(v, cmp)`: 原地排序, cmp 同 qsort 的比较函数, 但参数为 `const type *`.
+ *
+ * 返回 xf_err_t 的函数:
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    下标越界
+ *      - XF_ERR_NO_MEM         内存不足, 数组不变
+ *
+ * @param name 生成的类型与函数名前缀.
+ * @param type 元素类型.
+ */
+#define XF_VEC_DEFINE(name, type) \
+    typedef struct name##_s { \
+        type   *data;                   /*!< 元素数组, 容量为 0 时为 NULL */ \
+        size_t  len;                    /*!< 元素个数 */ \
+        size_t  cap;                    /*!< 容量（元素个数） */ \
+    } name##_t; \
+    \
+    typedef int (*name##_cmp_t)(const type *a, const type *b); \
+    \
+    static inline void name##_init(name##_t *v) \
+    { \
+        v->data = NULL; \
+        v->len = 0; \
+        v->cap = 0; \
+    } \
+    \
+    static inline void name##_deinit(name##_t *v) \
+    { \
+        if (NULL != v->data) { \
+            xf_free(v->data); \
+        } \
+        name##_init(v); \
+    } \
+    \
+    static inline xf_err_t name##__resize(name##_t *v, size_t cap) \
+    { \
+        type *p = (type *)__xf_vec_realloc(v->data, v->len, cap, sizeof(type)); \
+        if (NULL == p) { \
+            return XF_ERR_NO_MEM; \
+        } \
+        v->data = p; \
+        v->cap = cap; \
+        return XF_OK; \
+    } \
+    \
+    static inline xf_err_t name##__grow(name##_t *v, size_t extra) \
+    { \
+        if (extra > ((size_t)-1) - v->len) { \
+            return XF_ERR_NO_MEM; \
+        } \
+        return name##__resize(v, __xf_vec_next_cap(v->cap, v->len + extra)); \
+    } \
+    \
+    static inline xf_err_t name##_reserve(name##_t *v, size_t cap) \
+    { \
+        if (cap <= v->cap) { \
+            return XF_OK; \
+        } \
+        return name##__resize(v, cap); \
+    } \
+    \
+    static inline xf_err_t name##_push(name##_t *v, type value) \
+    { \
+        if ((v->len == v->cap) && (XF_OK != name##__grow(v, 1))) { \
+            return XF_ERR_NO_MEM; \
+        } \
+        v->data[v->len++] = value; \
+        return XF_OK; \
+    } \
+    \
+    static inline type *name##_emplace(name##_t *v) \
+    { \
+        if ((v->len == v->cap) && (XF_OK != name##__grow(v, 1))) { \
+            return NULL; \
+        } \
+        return &v->data[v->len++]; \
+    } \
+    \
+    static inline bool name##_pop(name##_t *v, type *out) \
+    { \
+        if (0 == v->len) { \
+            return false; \
+        } \
+        v->len--; \
+        if (NULL != out) { \
+            *out = v->data[v->len]; \
+        } \
+        return true; \
+    } \
+    \
+    static inline xf_err_t name##_insert(name##_t *v, size_t index, type value) \
+    { \
+        if (index > v->len) { \
+            return XF_ERR_INVALID_ARG; \
+        } \
+        if ((v->len == v->cap) && (XF_OK != name##__grow(v, 1))) { \
+            return XF_ERR_NO_MEM; \
+        } \
+        for (size_t i = v->len; i > index; i--) { \
+            v->data[i] = v->data[i - 1]; \
+        } \
+        v->data[index] = value; \
+        v->len++; \
+        return XF_OK; \
+    } \
+    \
+    static inline xf_err_t name##_erase(name##_t *v, size_t index) \
+    { \
+        if (index >= v->len) { \
+            return XF_ERR_INVALID_ARG; \
+        } \
+        v->len--; \
+        for (size_t i = index; i < v->len; i++) { \
+            v->data[i] = v->data[i + 1]; \
+        } \
+        return XF_OK; \
+    } \
+    \
+    static inline xf_err_t name##_swap_remove(name##_t *v, size_t index) \
+    { \
+        if (index >= v->len) { \
+            return XF_ERR_INVALID_ARG; \
+        } \
+        v->len--; \
+        if (index != v->len) { \
+            v->data[index] = v->data[v->len]; \
+        } \
+        return XF_OK; \
+    } \
+    \
+    static inline void name##_clear(name##_t *v) \
+    { \
+        v->len = 0; \
+    } \
+    \
+    static inline xf_err_t name##_shrink(name##_t *v) \
+    { \
+        if (v->len == v->cap) { \
+            return XF_OK; \
+        } \
+        if (0 == v->len) { \
+            name##_deinit(v); \
+            return XF_OK; \
+        } \
+        return name##__resize(v, v->len); \
+    } \
+    \
+    static inline void name##__insertion_sort(type *a, size_t n, name##_cmp_t cmp) \
+    { \
+        for (size_t i = 1; i < n; i++) { \
+            type tmp = a[i]; \
+            size_t j = i; \
+            while ((j > 0) && (cmp(&tmp, &a[j - 1]) < 0)) { \
+                a[j] = a[j - 1]; \
+                j--; \
+            } \
+            a[j] = tmp; \
+        } \
+    } \
+    \
+    static inline void name##__sift_down(type *a, size_t root, size_t n, name##_cmp_t cmp) \
+    { \
+        type tmp = a[root]; \
+        size_t child; \
+        while ((child = root * 2 + 1) < n) { \
+            if ((child + 1 < n) && (cmp(&a[child], &a[child + 1]) < 0)) { \
+                child++; \
+            } \
+            if (cmp(&tmp, &a[child]) >= 0) { \
+                break; \
+            } \
+            a[root] = a[child]; \
+            root = child; \
+        } \
+        a[root] = tmp; \
+    } \
+    \
+    static inline void name##__heap_sort(type *a, size_t n, name##_cmp_t cmp) \
+    { \
+        for (size_t i = n / 2; i > 0; i--) { \
+            name##__sift_down(a, i - 1, n, cmp); \
+        } \
+        for (size_t i = n - 1; i > 0; i--) { \
+            type tmp = a[0]; \
+            a[0] = a[i]; \
+            a[i] = tmp; \
+            name##__sift_down(a, 0, i, cmp); \
+        } \
+    } \
+    \
+    static inline void name##__intro_sort(type *a, size_t n, size_t depth, name##_cmp_t cmp) \
+    { \
+        while (n > XF_VEC_SORT_INSERTION_THRESHOLD) { \
+            if (0 == depth--) { \
+                name##__heap_sort(a, n, cmp); \
+                return; \
+            } \
+            /* 三数取中, 把中值放到 a[0] 作为枢轴 */ \
+            size_t mid = n / 2; \
+            type tmp; \
+            if (cmp(&a[mid], &a[0]) < 0) { \
+                tmp = a[mid]; a[mid] = a[0]; a[0] = tmp; \
+            } \
+            if (cmp(&a[n - 1], &a[mid]) < 0) { \
+                tmp = a[n - 1]; a[n - 1] = a[mid]; a[mid] = tmp; \
+                if (cmp(&a[mid], &a[0]) < 0) { \
+                    tmp = a[mid]; a[mid] = a[0]; a[0] = tmp; \
+                } \
+            } \
+            tmp = a[mid]; a[mid] = a[0]; a[0] = tmp; \
+            /* Hoare 划分, 与枢轴相等的元素分到两侧, 大量重复值时仍然平衡 */ \
+            size_t i = 0; \
+            size_t j = n; \
+            for (;;) { \
+                do { \
+                    i++; \
+                } while ((i < n) && (cmp(&a[i], &a[0]) < 0)); \
+                do { \
+                    j--; \
+                } while (cmp(&a[0], &a[j]) < 0); \
+                if (i >= j) { \
+                    break; \
+                } \
+                tmp = a[i]; a[i] = a[j]; a[j] = tmp; \
+            } \
+            tmp = a[0]; a[0] = a[j]; a[j] = tmp; \
+            /* 递归处理较短的一侧, 循环处理较长的一侧, 栈深度 O(log n) */ \
+            if (j < n - j - 1) { \
+                name##__intro_sort(a, j, depth, cmp); \
+                a += j + 1; \
+                n -= j + 1; \
+            } else { \
+                name##__intro_sort(a + j + 1, n - j - 1, depth, cmp); \
+                n = j; \
+            } \
+        } \
+        name##__insertion_sort(a, n, cmp); \
+    } \
+    \
+    static inline void name##_sort(name##_t *v, name##_cmp_t cmp) \
+    { \
+        if (v->len > 1) { \
+            name##__intro_sort(v->data, v->len, __xf_vec_sort_depth(v->len), cmp); \
+        } \
+    }
+
+/**
+ * @brief 元素个数.
+ */
+#define xf_vec_len(v)                   ((v)->len)
+
+/**
+ * @brief 是否为空.
+ */
+#define xf_vec_empty(v)                 (0 == (v)->len)
+
+/**
+ * @brief 第 i 个元素（左值）, 不检查下标.
+ */
+#define xf_vec_at(v, i)                 ((v)->data[(i)])
+
+/**
+ * @brief 最后一个元素（左值）, 数组不能为空.
+ */
+#define xf_vec_back(v)                  ((v)->data[(v)->len - 1])
+
+/**
+ * @brief 按顺序遍历元素.
+ *
+ * @param it 元素指针（`type *`）, 由调用者定义.
+ * @param v 动态数组.
+ */
+#define xf_vec_for_each(it, v) \
+    for ((it) = (v)->data; (it) < (v)->data + (v)->len; (it)++)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_common_vec
+ * @}
+ */
+
+#endif // __XF_VEC_H__
@@ -0,0 +1,115 @@
+/**
+ * @file xf_crc.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief CRC 校验。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * | 函数          | 算法              | 多项式    | 初值      | 输入/输出反转 | 结果异或   | "123456789" |
+ * | ------------- | ----------------- | --------- | --------- | ------------- | ---------- | ----------- |
+ * | xf_crc32()    | CRC-32 (zlib)     | 0x04c11db7| 0xffffffff| 是            | 0xffffffff | 0xcbf43926  |
+ * | xf_crc32c()   | CRC-32C           | 0x1edc6f41| 0xffffffff| 是            | 0xffffffff | 0xe3069283  |
+ * | xf_crc16()    | CRC-16/CCITT-FALSE| 0x1021    | 0xffff    | 否            | 0          | 0x29b1      |
+ * | xf_crc8()     | CRC-8/SMBUS       | 0x07      | 0         | 否            | 0          | 0xf4        |
+ *
+ * 均可分段计算: 第一段传入 XF_CRCxx_INIT, 之后传入上一段的结果.
+ *
+ * 软件实现使用 slicing-by-8 查表（见 XF_CRC_SLICE_BY_8_ENABLE）;
+ * CRC32C 在 x86 SSE4.2 和 ARMv8 上使用硬件指令, CRC32 在 ARMv8 上使用硬件指令.
+ */
+
+#ifndef __XF_CRC_H__
+#define __XF_CRC_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_crc_config.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_crc xf_crc
+ * @brief CRC 校验。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#define XF_CRC32_INIT                   ((uint32_t)0)
+#define XF_CRC32C_INIT                  ((uint32_t)0)
+#define XF_CRC16_INIT                   ((uint16_t)0xffff)
+#define XF_CRC8_INIT                    ((uint8_t)0)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 计算 CRC-32（与 zlib crc32() 相同）.
+ *
+ * @param crc 上一段的结果, 第一段为 XF_CRC32_INIT.
+ * @param data 数据.
+ * @param len 字节数.
+ * @return uint32_t CRC 值.
+ */
+uint32_t xf_crc32(uint32_t crc, const void *data, size_t len);
+
+/**
+ * @brief 计算 CRC-32C（Castagnoli, iSCSI / ext4 / SCTP 使用）.
+ *
+ * @param crc 上一段的结果, 第一段为 XF_CRC32C_INIT.
+ * @param data 数据.
+ * @param len 字节数.
+ * @return uint32_t CRC 值.
+ */
+uint32_t xf_crc32c(uint32_t crc, const void *data, size_t len);
+
+/**
+ * @brief 计算 CRC-16/CCITT-FALSE.
+ *
+ * @param crc 上一段的结果, 第一段为 XF_CRC16_INIT.
+ * @param data 数据.
+ * @param len 字节数.
+ * @return uint16_t CRC 值.
+ */
+uint16_t xf_crc16(uint16_t crc, const void *data, size_t len);
+
+/**
+ * @brief 计算 CRC-8/SMBUS.
+ *
+ * @param crc 上一段的结果, 第一段为 XF_CRC8_INIT.
+ * @param data 数据.
+ * @param len 字节数.
+ * @return uint8_t CRC 值.
+ */
+uint8_t xf_crc8(uint8_t crc, const void *data, size_t len);
+
+/**
+ * @brief xf_crc32c() 当前是否使用硬件指令.
+ */
+bool xf_crc32c_is_hw(void);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_crc
+ * @}
+ */
+
+#endif // __XF_CRC_H__
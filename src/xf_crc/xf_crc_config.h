@@ -0,0 +1,59 @@
+/**
+ * @file xf_crc_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief CRC 校验配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_CRC_CONFIG_H__
+#define __XF_CRC_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 是否使用 slicing-by-8 查表（每次处理 8 字节）.
+ *
+ * 每种 CRC 的表为 8 x 256 项（CRC32 为 8 KiB）; 关闭后只使用 1 x 256 项的表,
+ * 逐字节查表, ROM 占用为 1/8.
+ */
+#if !defined(XF_CRC_SLICE_BY_8_ENABLE) || (XF_CRC_SLICE_BY_8_ENABLE)
+#   define XF_CRC_SLICE_BY_8_IS_ENABLE  (1)
+#else
+#   define XF_CRC_SLICE_BY_8_IS_ENABLE  (0)
+#endif
+
+/**
+ * @brief 是否使用硬件 CRC 指令.
+ *
+ * - x86: SSE4.2 crc32 指令（CRC32C）, 运行时检测 CPU 是否支持;
+ * - ARMv8: 编译时定义了 __ARM_FEATURE_CRC32 时使用（CRC32 和 CRC32C）.
+ */
+#if !defined(XF_CRC_HW_ENABLE) || (XF_CRC_HW_ENABLE)
+#   define XF_CRC_HW_IS_ENABLE          (1)
+#else
+#   define XF_CRC_HW_IS_ENABLE          (0)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_CRC_CONFIG_H__
@@ -0,0 +1,230 @@
+/**
+ * @file xf_epoch.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 基于 epoch 的内存回收（EBR）。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_epoch.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define ACTIVE                          (1u)
+#define EPOCH_STEP                      (2u)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static bool _try_advance(xf_epoch_t *ep, xf_epoch_entry_t **p_freed);
+static size_t _free_all(xf_epoch_entry_t *entry);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#define _LOCK(ep) \
+    do { if ((ep)->use_lock) { xf_lock_lock((ep)->lock); } } while (0)
+#define _UNLOCK(ep) \
+    do { if ((ep)->use_lock) { xf_lock_unlock((ep)->lock); } } while (0)
+
+#define _LIMBO_INDEX(epoch)             (((epoch) / EPOCH_STEP) % XF_EPOCH_LIMBO_NUM)
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_epoch_init(xf_epoch_t *ep, bool thread_safe)
+{
+    if (NULL == ep) {
+        return XF_ERR_INVALID_ARG;
+    }
+    ep->global = 0;
+    xf_list_init(&ep->records);
+    for (uint32_t i = 0; i < XF_EPOCH_LIMBO_NUM; i++) {
+        ep->limbo[i] = NULL;
+    }
+    ep->pending = 0;
+    ep->use_lock = thread_safe;
+    ep->lock = NULL;
+    if (thread_safe) {
+        if (XF_OK != xf_lock_init(&ep->lock)) {
+            return XF_FAIL;
+        }
+    }
+    return XF_OK;
+}
+
+void xf_epoch_deinit(xf_epoch_t *ep)
+{
+    if (NULL == ep) {
+        return;
+    }
+    for (uint32_t i = 0; i < XF_EPOCH_LIMBO_NUM; i++) {
+        _free_all(ep->limbo[i]);
+        ep->limbo[i] = NULL;
+    }
+    ep->pending = 0;
+    xf_list_init(&ep->records);
+    if (ep->use_lock) {
+        xf_lock_destroy(ep->lock);
+        ep->lock = NULL;
+        ep->use_lock = false;
+    }
+}
+
+xf_err_t xf_epoch_register(xf_epoch_t *ep, xf_epoch_record_t *rec)
+{
+    if ((NULL == ep) || (NULL == rec)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    rec->state = 0;
+    rec->nest = 0;
+    _LOCK(ep);
+    xf_list_add_tail(&rec->node, &ep->records);
+    _UNLOCK(ep);
+    return XF_OK;
+}
+
+void xf_epoch_unregister(xf_epoch_t *ep, xf_epoch_record_t *rec)
+{
+    if ((NULL == ep) || (NULL == rec)) {
+        return;
+    }
+    _LOCK(ep);
+    xf_list_del_init(&rec->node);
+    _UNLOCK(ep);
+}
+
+void xf_epoch_retire(xf_epoch_t *ep, xf_epoch_entry_t *entry, xf_epoch_free_cb_t free_cb)
+{
+    if ((NULL == ep) || (NULL == entry) || (NULL == free_cb)) {
+        return;
+    }
+    entry->free_cb = free_cb;
+
+    _LOCK(ep);
+    /* global 只在持锁时修改, 这里读到的就是当前 epoch */
+    uint32_t i = _LIMBO_INDEX(ep->global);
+    entry->next = ep->limbo[i];
+    ep->limbo[i] = entry;
+    ep->pending++;
+    bool reclaim = (ep->pending >= XF_EPOCH_RECLAIM_THRESHOLD);
+    _UNLOCK(ep);
+
+    if (reclaim) {
+        xf_epoch_reclaim(ep);
+    }
+}
+
+size_t xf_epoch_reclaim(xf_epoch_t *ep)
+{
+    if (NULL == ep) {
+        return 0;
+    }
+    size_t freed = 0;
+
+    /* 每次推进只能释放一组, 三组都释放需要连续推进三次 */
+    for (uint32_t n = 0; n < XF_EPOCH_LIMBO_NUM; n++) {
+        xf_epoch_entry_t *list = NULL;
+
+        _LOCK(ep);
+        bool advanced = (ep->pending > 0) && _try_advance(ep, &list);
+        _UNLOCK(ep);
+
+        /* 回调在锁外执行, 回调中可以再次调用 xf_epoch_retire() */
+        size_t num = _free_all(list);
+        if (num > 0) {
+            _LOCK(ep);
+            ep->pending -= num;
+            _UNLOCK(ep);
+        }
+        freed += num;
+        if (!advanced) {
+            break;
+        }
+    }
+    return freed;
+}
+
+void xf_epoch_synchronize(xf_epoch_t *ep)
+{
+    if (NULL == ep) {
+        return;
+    }
+    /*
+     * 调用前进入的读者记录的 epoch 不晚于当前的 global,
+     * 再推进两次（第二次要求所有活跃读者都已进入 global + EPOCH_STEP）说明它们都已离开.
+     */
+    _LOCK(ep);
+    uint32_t target = ep->global + 2 * EPOCH_STEP;
+    _UNLOCK(ep);
+
+    for (;;) {
+        xf_epoch_entry_t *list = NULL;
+
+        _LOCK(ep);
+        /* global 可能被其他线程推进, 按回绕后的差值判断是否已到达 */
+        bool done = ((int32_t)(ep->global - target) >= 0);
+        bool advanced = !done && _try_advance(ep, &list);
+        _UNLOCK(ep);
+
+        size_t num = _free_all(list);
+        if (num > 0) {
+            _LOCK(ep);
+            ep->pending -= num;
+            _UNLOCK(ep);
+        }
+        if (done) {
+            break;
+        }
+        if (!advanced) {
+            xf_cpu_relax();
+        }
+    }
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 所有活跃读者都已进入当前 epoch 时推进一次, 取出两个 epoch 之前退休的对象.
+ *        需要持锁调用.
+ */
+static bool _try_advance(xf_epoch_t *ep, xf_epoch_entry_t **p_freed)
+{
+    xf_epoch_record_t *rec;
+    uint32_t global = ep->global;
+
+    /* 与 xf_epoch_enter() 中的屏障配对: 之前的摘除操作先于读取读者状态 */
+    xf_atomic_thread_fence(XF_ATOMIC_SEQ_CST);
+    xf_list_for_each_entry(rec, &ep->records, xf_epoch_record_t, node) {
+        uint32_t state = xf_atomic_load(&rec->state, XF_ATOMIC_ACQUIRE);
+        if ((0 != (state & ACTIVE)) && ((state & ~ACTIVE) != global)) {
+            return false;
+        }
+    }
+
+    global += EPOCH_STEP;
+    /* 新 epoch 的链表与 global - 2 * EPOCH_STEP 时的链表是同一个 */
+    uint32_t i = _LIMBO_INDEX(global);
+    *p_freed = ep->limbo[i];
+    ep->limbo[i] = NULL;
+    xf_atomic_store(&ep->global, global, XF_ATOMIC_RELEASE);
+    return true;
+}
+
+static size_t _free_all(xf_epoch_entry_t *entry)
+{
+    size_t num = 0;
+    while (NULL != entry) {
+        xf_epoch_entry_t *next = entry->next;
+        entry->free_cb(entry);
+        entry = next;
+        num++;
+    }
+    return num;
+}
@@ -0,0 +1,262 @@
+/**
+ * @file xf_epoch.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 基于 epoch 的内存回收（EBR）。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 无锁读者可能仍在访问刚被写者摘下的节点, 因此节点不能立即释放.
+ * 读者在访问共享结构前后调用 xf_epoch_enter() / xf_epoch_exit()（不加锁, 只写自己的记录）;
+ * 写者摘下节点后调用 xf_epoch_retire(), 节点在所有读者都离开当时的临界区后才被释放.
+ *
+ * 实现为经典的三 epoch 方案: 全局 epoch 只在所有活跃读者都已进入当前 epoch 时才能推进,
+ * 推进到 e 时, e - 2 期间退休的节点已不可能被任何读者引用, 可以释放.
+ *
+ * 每个访问共享结构的线程需要一个 xf_epoch_record_t, 通过 xf_epoch_register() 登记.
+ *
+ * @code{.c}
+ * // 读者
+ * xf_epoch_enter(&ep, &rec);
+ * node = xf_skiplist_find(&sl, &key);
+ * ...                                      // node 在 exit 之前一直有效
+ * xf_epoch_exit(&rec);
+ *
+ * // 写者
+ * xf_skiplist_remove(&sl, &item->node, &item->key);
+ * xf_epoch_retire(&ep, &item->retire, item_free_cb);
+ * @endcode
+ *
+ * 写者也可以调用 xf_epoch_synchronize() 同步等待一个宽限期, 之后直接释放（同 synchronize_rcu）.
+ *
+ * 读者在每次访问前后进出临界区的开销仍有一个屏障. 长期在线、循环处理的读者线程
+ * 可以改用静止状态（QSBR）方式: 启动时 xf_epoch_enter() 一次,
+ * 每处理完一批、不再持有任何共享指针时调用 xf_epoch_quiescent(), 访问路径上没有任何额外开销;
+ * 阻塞或退出前 xf_epoch_exit().
+ *
+ * @code{.c}
+ * xf_epoch_enter(&ep, &rec);               // 上线
+ * while (running) {
+ *     xf_list_for_each_entry_rcu(pos, &head, item_t, node) { ... }
+ *     xf_epoch_quiescent(&ep, &rec);       // 不再引用之前读到的节点
+ * }
+ * xf_epoch_exit(&rec);                     // 下线
+ * @endcode
+ *
+ * @attention 读者长时间停留在临界区内（或长时间不调用 xf_epoch_quiescent()）会阻止回收,
+ *            内存随之增长.
+ */
+
+#ifndef __XF_EPOCH_H__
+#define __XF_EPOCH_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_epoch_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_lock/xf_lock.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_epoch xf_epoch
+ * @brief 基于 epoch 的内存回收（EBR）。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 退休链表的个数, 即当前 epoch 与之前两个 epoch.
+ */
+#define XF_EPOCH_LIMBO_NUM              (3)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct xf_epoch_entry_s xf_epoch_entry_t;
+
+/**
+ * @brief 释放回调, 通常通过 xf_container_of() 取得对象后释放.
+ */
+typedef void (*xf_epoch_free_cb_t)(xf_epoch_entry_t *entry);
+
+/**
+ * @brief 退休节点, 嵌入到需要延迟释放的对象中.
+ *
+ * 不能复用对象中的链表节点: 退休时读者可能仍在沿着它们遍历.
+ */
+struct xf_epoch_entry_s {
+    xf_epoch_entry_t   *next;           /*!< 同一个 epoch 内的下一个退休节点 */
+    xf_epoch_free_cb_t  free_cb;        /*!< 释放回调 */
+};
+
+/**
+ * @brief 读者记录, 每个线程一个.
+ *
+ * 读者只写自己的记录, 多个线程的记录最好不在同一个缓存行.
+ */
+typedef struct xf_epoch_record_s {
+    xf_list_t           node;           /*!< 挂在 xf_epoch_t::records 上 */
+    uint32_t            state;          /*!< 进入时的全局 epoch | 活跃标志（最低位） */
+    uint32_t            nest;           /*!< 嵌套深度, 只由所属线程访问 */
+} xf_epoch_record_t;
+
+/**
+ * @brief 回收域. 通常一个共享结构（或一组一起更新的结构）一个.
+ */
+typedef struct xf_epoch_s {
+    uint32_t            global;         /*!< 全局 epoch, 每次推进加 2, 最低位恒为 0 */
+    xf_list_t           records;        /*!< 已登记的读者记录 */
+    xf_epoch_entry_t   *limbo[XF_EPOCH_LIMBO_NUM]; /*!< 按退休时的 epoch 分组的退休节点 */
+    size_t              pending;        /*!< 尚未释放的退休节点数 */
+    bool                use_lock;       /*!< 是否使用 lock */
+    xf_lock_t           lock;           /*!< 保护 records、limbo 与 epoch 推进 */
+} xf_epoch_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化回收域.
+ *
+ * @param ep 回收域.
+ * @param thread_safe 是否通过 xf_lock 保护登记、退休与回收.
+ *      有多个写者或读者线程时应为 true, 需要已通过 xf_lock_register() 对接锁.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_FAIL               创建锁失败
+ */
+xf_err_t xf_epoch_init(xf_epoch_t *ep, bool thread_safe);
+
+/**
+ * @brief 释放所有退休节点并销毁回收域.
+ *
+ * @attention 调用时不能有读者处于临界区内.
+ *
+ * @param ep 回收域.
+ */
+void xf_epoch_deinit(xf_epoch_t *ep);
+
+/**
+ * @brief 登记读者记录.
+ *
+ * @param ep 回收域.
+ * @param rec 读者记录, 在注销之前必须保持有效.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_epoch_register(xf_epoch_t *ep, xf_epoch_record_t *rec);
+
+/**
+ * @brief 注销读者记录. 调用时该记录不能处于临界区内.
+ *
+ * @param ep 回收域.
+ * @param rec 读者记录.
+ */
+void xf_epoch_unregister(xf_epoch_t *ep, xf_epoch_record_t *rec);
+
+/**
+ * @brief 延迟释放一个已经从共享结构中摘下的对象.
+ *
+ * 待回收对象达到 XF_EPOCH_RECLAIM_THRESHOLD 个时自动调用 xf_epoch_reclaim().
+ * 可以在读者临界区内调用.
+ *
+ * @param ep 回收域.
+ * @param entry 对象中的退休节点.
+ * @param free_cb 释放回调.
+ */
+void xf_epoch_retire(xf_epoch_t *ep, xf_epoch_entry_t *entry, xf_epoch_free_cb_t free_cb);
+
+/**
+ * @brief 尝试推进 epoch, 释放已经安全的退休对象.
+ *
+ * 没有读者阻止时连续推进, 直到所有退休对象都被释放.
+ *
+ * @param ep 回收域.
+ * @return size_t 本次释放的对象数.
+ */
+size_t xf_epoch_reclaim(xf_epoch_t *ep);
+
+/**
+ * @brief 等待一个宽限期: 返回时, 调用之前进入临界区的读者都已离开.
+ *
+ * 之前摘下的对象此后可以直接释放. 等待期间顺带释放已经安全的退休对象.
+ * 等待方式为自旋, 适合写操作很少的场合; 否则应使用 xf_epoch_retire().
+ *
+ * @attention 不能在读者临界区内调用, 否则永远等不到自己离开.
+ *
+ * @param ep 回收域.
+ */
+void xf_epoch_synchronize(xf_epoch_t *ep);
+
+/**
+ * @brief 进入读者临界区, 可以嵌套.
+ *
+ * @param ep 回收域.
+ * @param rec 当前线程的读者记录.
+ */
+static inline void xf_epoch_enter(xf_epoch_t *ep, xf_epoch_record_t *rec)
+{
+    if (0 == rec->nest++) {
+        uint32_t e = xf_atomic_load(&ep->global, XF_ATOMIC_RELAXED);
+        xf_atomic_store(&rec->state, e | 1u, XF_ATOMIC_RELAXED);
+        /* 活跃状态必须在读取任何共享指针之前对回收者可见（store-load 顺序） */
+        xf_atomic_thread_fence(XF_ATOMIC_SEQ_CST);
+    }
+}
+
+/**
+ * @brief 离开读者临界区.
+ *
+ * @param rec 当前线程的读者记录.
+ */
+static inline void xf_epoch_exit(xf_epoch_record_t *rec)
+{
+    if (0 == --rec->nest) {
+        xf_atomic_store(&rec->state, 0u, XF_ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * @brief 报告静止状态（QSBR）: 当前线程不再引用之前读到的任何共享对象.
+ *
+ * 效果相当于 xf_epoch_exit() 后立即 xf_epoch_enter(), 但全局 epoch 未变化时只有一次读取.
+ * 只能在最外层临界区内调用.
+ *
+ * @param ep 回收域.
+ * @param rec 当前线程的读者记录.
+ */
+static inline void xf_epoch_quiescent(xf_epoch_t *ep, xf_epoch_record_t *rec)
+{
+    uint32_t e = xf_atomic_load(&ep->global, XF_ATOMIC_RELAXED) | 1u;
+    if (xf_atomic_load(&rec->state, XF_ATOMIC_RELAXED) != e) {
+        /* release: 之前对共享对象的访问先于新状态可见 */
+        xf_atomic_store(&rec->state, e, XF_ATOMIC_RELEASE);
+        xf_atomic_thread_fence(XF_ATOMIC_SEQ_CST);
+    }
+}
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_epoch
+ * @}
+ */
+
+#endif // __XF_EPOCH_H__
@@ -0,0 +1,46 @@
+/**
+ * @file xf_epoch_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 基于 epoch 的内存回收配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_EPOCH_CONFIG_H__
+#define __XF_EPOCH_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 待回收对象达到该数量时, xf_epoch_retire() 自动尝试推进 epoch 并回收.
+ */
+#if !defined(XF_EPOCH_RECLAIM_THRESHOLD)
+#   define XF_EPOCH_RECLAIM_THRESHOLD   (64)
+#endif
+
+#if (XF_EPOCH_RECLAIM_THRESHOLD < 1)
+#   error "xf_epoch: XF_EPOCH_RECLAIM_THRESHOLD must be >= 1"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_EPOCH_CONFIG_H__
@@ -0,0 +1,187 @@
+/**
+ * @file xf_hash.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 快速非加密哈希。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_hash.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define SECRET0                         XF_HASH_SECRET0
+#define SECRET1                         XF_HASH_SECRET1
+#define SECRET2                         (0x8ebc6af09c88c6e3ULL)
+#define SECRET3                         (0x589965cc75374cc3ULL)
+
+#define SECRET32_0                      (0x53c5ca59U)
+#define SECRET32_1                      (0x74743c1bU)
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#   define IS_BIG_ENDIAN                (1)
+#else
+#   define IS_BIG_ENDIAN                (0)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static inline uint64_t _mix(uint64_t a, uint64_t b);
+static inline uint64_t _r8(const uint8_t *p);
+static inline uint64_t _r4(const uint8_t *p);
+static inline uint64_t _r3(const uint8_t *p, size_t len);
+static inline void _mix32(uint32_t *a, uint32_t *b);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+uint64_t xf_hash64(const void *data, size_t len, uint64_t seed)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint64_t a;
+    uint64_t b;
+
+    seed ^= _mix(seed ^ SECRET0, SECRET1);
+    if (len <= 16) {
+        if (len >= 4) {
+            /* 4~16 字节: 首尾各取两个可能重叠的 32 位字 */
+            size_t off = (len >> 3) << 2;
+            a = (_r4(p) << 32) | _r4(p + off);
+            b = (_r4(p + len - 4) << 32) | _r4(p + len - 4 - off);
+        } else if (len > 0) {
+            a = _r3(p, len);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i > 48) {
+            /* 三条相互独立的乘法链, 可以并行执行 */
+            uint64_t see1 = seed;
+            uint64_t see2 = seed;
+            do {
+                seed = _mix(_r8(p) ^ SECRET1, _r8(p + 8) ^ seed);
+                see1 = _mix(_r8(p + 16) ^ SECRET2, _r8(p + 24) ^ see1);
+                see2 = _mix(_r8(p + 32) ^ SECRET3, _r8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = _mix(_r8(p) ^ SECRET1, _r8(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        a = _r8(p + i - 16);
+        b = _r8(p + i - 8);
+    }
+    a ^= SECRET1;
+    b ^= seed;
+    xf_hash_mum(&a, &b);
+    return _mix(a ^ SECRET0 ^ (uint64_t)len, b ^ SECRET1);
+}
+
+uint32_t xf_hash32(const void *data, size_t len, uint32_t seed)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    size_t i = len;
+    uint32_t see1 = (uint32_t)len;
+
+    seed ^= (uint32_t)((uint64_t)len >> 32);
+    _mix32(&seed, &see1);
+    while (i > 8) {
+        seed ^= (uint32_t)_r4(p);
+        see1 ^= (uint32_t)_r4(p + 4);
+        _mix32(&seed, &see1);
+        p += 8;
+        i -= 8;
+    }
+    if (i >= 4) {
+        seed ^= (uint32_t)_r4(p);
+        see1 ^= (uint32_t)_r4(p + i - 4);
+    } else if (i > 0) {
+        seed ^= (uint32_t)_r3(p, i);
+    }
+    _mix32(&seed, &see1);
+    _mix32(&seed, &see1);
+    return seed ^ see1;
+}
+
+uint32_t xf_hash_u32(uint32_t value)
+{
+    uint32_t a = value;
+    uint32_t b = 4;
+    _mix32(&a, &b);
+    _mix32(&a, &b);
+    return a ^ b;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static inline uint64_t _mix(uint64_t a, uint64_t b)
+{
+    xf_hash_mum(&a, &b);
+    return a ^ b;
+}
+
+static inline uint64_t _r8(const uint8_t *p)
+{
+#if defined(__GNUC__)
+    uint64_t v;
+    __builtin_memcpy(&v, p, 8);
+#   if IS_BIG_ENDIAN
+    v = __builtin_bswap64(v);
+#   endif
+    return v;
+#else
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16)
+           | ((uint64_t)p[3] << 24) | ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40)
+           | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+#endif
+}
+
+static inline uint64_t _r4(const uint8_t *p)
+{
+#if defined(__GNUC__)
+    uint32_t v;
+    __builtin_memcpy(&v, p, 4);
+#   if IS_BIG_ENDIAN
+    v = __builtin_bswap32(v);
+#   endif
+    return v;
+#else
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16)
+           | ((uint64_t)p[3] << 24);
+#endif
+}
+
+/**
+ * @brief 1~3 字节: 首字节、中间字节、末字节.
+ */
+static inline uint64_t _r3(const uint8_t *p, size_t len)
+{
+    return ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+}
+
+/**
+ * @brief 32x32->64 位乘积的低 32 位写回 a, 高 32 位写回 b.
+ */
+static inline void _mix32(uint32_t *a, uint32_t *b)
+{
+    uint64_t c = (uint64_t)(*a ^ SECRET32_0) * (*b ^ SECRET32_1);
+    *a = (uint32_t)c;
+    *b = (uint32_t)(c >> 32);
+}
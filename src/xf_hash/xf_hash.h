@@ -0,0 +1,131 @@
+/**
+ * @file xf_hash.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 快速非加密哈希。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * xf_hash64() 的结构与 wyhash 相同: 以 64x64->128 位乘法为核心, 短键（<= 16 字节）
+ * 只需一两次乘法. xf_hash32() 只用 32x32->64 位乘法, 适合没有 64 位乘法器的 MCU.
+ * 数据按小端读取, 不同平台结果一致.
+ *
+ * @attention 不能用于密码学用途, 也不能抵抗针对性构造的碰撞（需要时使用随机 seed）.
+ */
+
+#ifndef __XF_HASH_H__
+#define __XF_HASH_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_hash xf_hash
+ * @brief 快速非加密哈希。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#define XF_HASH_SECRET0                 (0xa0761d6478bd642fULL)
+#define XF_HASH_SECRET1                 (0xe7037ed1a0b428dbULL)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 计算任意字节串的 64 位哈希.
+ *
+ * @param data 数据, len 为 0 时可为 NULL.
+ * @param len 字节数.
+ * @param seed 种子.
+ * @return uint64_t 哈希值.
+ */
+uint64_t xf_hash64(const void *data, size_t len, uint64_t seed);
+
+/**
+ * @brief 计算任意字节串的 32 位哈希.
+ *
+ * @param data 数据, len 为 0 时可为 NULL.
+ * @param len 字节数.
+ * @param seed 种子.
+ * @return uint32_t 哈希值.
+ */
+uint32_t xf_hash32(const void *data, size_t len, uint32_t seed);
+
+/**
+ * @brief 计算 32 位整数的哈希.
+ *
+ * @param value 整数.
+ * @return uint32_t 哈希值.
+ */
+uint32_t xf_hash_u32(uint32_t value);
+
+/**
+ * @brief 64x64 位乘法, 128 位乘积的低 64 位写回 a, 高 64 位写回 b.
+ */
+static inline void xf_hash_mum(uint64_t *a, uint64_t *b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)*a * *b;
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+#else
+    uint64_t ha = *a >> 32;
+    uint64_t hb = *b >> 32;
+    uint64_t la = (uint32_t)*a;
+    uint64_t lb = (uint32_t)*b;
+    uint64_t rh = ha * hb;
+    uint64_t rm0 = ha * lb;
+    uint64_t rm1 = hb * la;
+    uint64_t rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t c = (t < rl);
+    uint64_t lo = t + (rm1 << 32);
+    c += (lo < t);
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+/**
+ * @brief 计算 64 位整数的哈希, 所有输出位都与所有输入位相关.
+ *
+ * 只有一次乘法, 内联以便哈希表等热路径省去函数调用.
+ *
+ * @param value 整数.
+ * @return uint64_t 哈希值.
+ */
+static inline uint64_t xf_hash_u64(uint64_t value)
+{
+    uint64_t a = value ^ XF_HASH_SECRET0;
+    uint64_t b = XF_HASH_SECRET1;
+    xf_hash_mum(&a, &b);
+    return a ^ b;
+}
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_hash
+ * @}
+ */
+
+#endif // __XF_HASH_H__
@@ -0,0 +1,603 @@
+/**
+ * @file xf_hashmap.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief Swiss table 风格的开放寻址哈希表。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_hashmap.h"
+#include "../xf_hash/xf_hash.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_std/xf_string.h"
+
+#if XF_HASHMAP_SIMD_IS_ENABLE && defined(__SSE2__)
+#   include <emmintrin.h>
+#   define USE_SSE2                     (1)
+#elif XF_HASHMAP_SIMD_IS_ENABLE && defined(__ARM_NEON) && defined(__aarch64__)
+#   include <arm_neon.h>
+#   define USE_NEON                     (1)
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/*
+ * 控制字节: 最高位为 0 表示已占用, 低 7 位为 H2;
+ * 最高位为 1 表示空闲, 其中 EMPTY 结束探测, DELETED（墓碑）不结束.
+ */
+#define CTRL_EMPTY                      ((uint8_t)0x80)
+#define CTRL_DELETED                    ((uint8_t)0xfe)
+
+/*
+ * 组宽度与掩码格式. 掩码中每个槽对应 1 << MASK_SHIFT 位, 只使用其中一位:
+ * SSE2 为 movemask 的第 i 位, NEON 为第 4i+3 位, 按字处理时为第 8i+7 位.
+ */
+#if defined(USE_SSE2)
+#   define GROUP_WIDTH                  (16)
+#   define MASK_SHIFT                   (0)
+#elif defined(USE_NEON)
+#   define GROUP_WIDTH                  (16)
+#   define MASK_SHIFT                   (2)
+#else
+#   define GROUP_WIDTH                  (8)
+#   define MASK_SHIFT                   (3)
+#endif
+#define MASK_BITS                       (GROUP_WIDTH << MASK_SHIFT)
+
+#define SWAR_ONES                       (0x0101010101010101ULL)
+#define SWAR_HIGHS                      (0x8080808080808080ULL)
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#   define IS_BIG_ENDIAN                (1)
+#else
+#   define IS_BIG_ENDIAN                (0)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef uint64_t mask_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+#if defined(USE_NEON)
+static inline mask_t _neon_mask(uint8x16_t eq);
+#elif !defined(USE_SSE2)
+static inline uint64_t _load_group(const uint8_t *ctrl);
+#endif
+static inline mask_t _group_match(const uint8_t *ctrl, uint8_t h2);
+static inline mask_t _group_empty(const uint8_t *ctrl);
+static inline mask_t _group_free(const uint8_t *ctrl);
+static inline uint64_t _hash(const xf_hashmap_t *map, const void *key);
+static inline bool _key_eq(const xf_hashmap_t *map, const void *a, const void *b);
+static inline void _copy(void *dst, const void *src, size_t size);
+static inline void _set_ctrl(xf_hashmap_t *map, size_t i, uint8_t c);
+static size_t _find(const xf_hashmap_t *map, const void *key, uint64_t hash);
+static inline size_t _find_u64(const xf_hashmap_t *map, uint64_t key);
+static size_t _find_free(const xf_hashmap_t *map, uint64_t hash);
+static xf_err_t _rebuild(xf_hashmap_t *map, size_t cap);
+static size_t _max_load(size_t cap);
+static size_t _size_align(size_t size);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#define _H1(hash)                       ((size_t)((hash) >> 7))
+#define _H2(hash)                       ((uint8_t)((hash) & 0x7f))
+#define _SLOT(map, i)                   ((map)->slots + (i) * (map)->slot_size)
+#define _IS_FULL(c)                     (0 == ((c) & 0x80))
+#define _IS_U64(map)                    ((NULL == (map)->hash) && (NULL == (map)->eq) \
+                                         && (8 == (map)->key_size))
+
+#define _MASK_FIRST(m)                  ((size_t)xf_bit_ctzll(m) >> MASK_SHIFT)
+#define _MASK_LAST_GAP(m)               ((size_t)(xf_bit_clzll(m) - (64 - MASK_BITS)) >> MASK_SHIFT)
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_hashmap_init(xf_hashmap_t *map, size_t key_size, size_t value_size,
+                         xf_hashmap_hash_t hash, xf_hashmap_eq_t eq)
+{
+    if ((NULL == map) || (0 == key_size)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    size_t key_align = _size_align(key_size);
+    size_t value_align = (value_size > 0) ? _size_align(value_size) : 1;
+    size_t align = (key_align > value_align) ? key_align : value_align;
+
+    map->ctrl = NULL;
+    map->slots = NULL;
+    map->cap = 0;
+    map->len = 0;
+    map->growth_left = 0;
+    map->key_size = key_size;
+    map->value_size = value_size;
+    map->value_offset = (key_size + value_align - 1) & ~(value_align - 1);
+    map->slot_size = (map->value_offset + value_size + align - 1) & ~(align - 1);
+    /* 为 NULL 时在查找路径中内联默认实现, 省去间接调用 */
+    map->hash = hash;
+    map->eq = eq;
+    return XF_OK;
+}
+
+void xf_hashmap_deinit(xf_hashmap_t *map)
+{
+    if (NULL == map) {
+        return;
+    }
+    if (NULL != map->slots) {
+        xf_free(map->slots);
+    }
+    map->ctrl = NULL;
+    map->slots = NULL;
+    map->cap = 0;
+    map->len = 0;
+    map->growth_left = 0;
+}
+
+void xf_hashmap_clear(xf_hashmap_t *map)
+{
+    if ((NULL == map) || (0 == map->cap)) {
+        return;
+    }
+    xf_memset(map->ctrl, CTRL_EMPTY, map->cap + GROUP_WIDTH);
+    map->len = 0;
+    map->growth_left = _max_load(map->cap);
+}
+
+xf_err_t xf_hashmap_reserve(xf_hashmap_t *map, size_t count)
+{
+    if (NULL == map) {
+        return XF_ERR_INVALID_ARG;
+    }
+    size_t cap = (map->cap > 0) ? map->cap : GROUP_WIDTH;
+    while (_max_load(cap) < count) {
+        if (cap > ((size_t)-1) / 2) {
+            return XF_ERR_NO_MEM;
+        }
+        cap *= 2;
+    }
+    if (cap == map->cap) {
+        return XF_OK;
+    }
+    return _rebuild(map, cap);
+}
+
+void *xf_hashmap_get(const xf_hashmap_t *map, const void *key)
+{
+    if ((NULL == map) || (NULL == key) || (0 == map->len)) {
+        return NULL;
+    }
+    size_t i;
+    if (_IS_U64(map)) {
+        uint64_t k;
+        _copy(&k, key, 8);
+        i = _find_u64(map, k);
+    } else {
+        i = _find(map, key, _hash(map, key));
+    }
+    if (i >= map->cap) {
+        return NULL;
+    }
+    return _SLOT(map, i) + ((map->value_size > 0) ? map->value_offset : 0);
+}
+
+void *xf_hashmap_emplace(xf_hashmap_t *map, const void *key, bool *inserted)
+{
+    if ((NULL == map) || (NULL == key)) {
+        return NULL;
+    }
+    uint64_t hash = _hash(map, key);
+    size_t i = (map->len > 0) ? _find(map, key, hash) : map->cap;
+    bool is_new = (i >= map->cap);
+
+    if (is_new) {
+        if (0 == map->cap) {
+            if (XF_OK != _rebuild(map, GROUP_WIDTH)) {
+                return NULL;
+            }
+        }
+        i = _find_free(map, hash);
+        if ((0 == map->growth_left) && (CTRL_EMPTY == map->ctrl[i])) {
+            /* 墓碑占了一半以上的可用槽时按原容量重建, 否则容量加倍 */
+            size_t cap = (map->len < _max_load(map->cap) / 2) ? map->cap : map->cap * 2;
+            if ((cap < map->cap) || (XF_OK != _rebuild(map, cap))) {
+                return NULL;
+            }
+            i = _find_free(map, hash);
+        }
+        map->growth_left -= (CTRL_EMPTY == map->ctrl[i]);
+        _set_ctrl(map, i, _H2(hash));
+        _copy(_SLOT(map, i), key, map->key_size);
+        map->len++;
+    }
+    if (NULL != inserted) {
+        *inserted = is_new;
+    }
+    return _SLOT(map, i) + ((map->value_size > 0) ? map->value_offset : 0);
+}
+
+xf_err_t xf_hashmap_put(xf_hashmap_t *map, const void *key, const void *value)
+{
+    if ((NULL == map) || (NULL == key) || ((NULL == value) && (map->value_size > 0))) {
+        return XF_ERR_INVALID_ARG;
+    }
+    void *slot_value = xf_hashmap_emplace(map, key, NULL);
+    if (NULL == slot_value) {
+        return XF_ERR_NO_MEM;
+    }
+    if (map->value_size > 0) {
+        _copy(slot_value, value, map->value_size);
+    }
+    return XF_OK;
+}
+
+xf_err_t xf_hashmap_remove(xf_hashmap_t *map, const void *key, void *value)
+{
+    if ((NULL == map) || (NULL == key)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (0 == map->len) {
+        return XF_ERR_NOT_FOUND;
+    }
+    size_t i = _find(map, key, _hash(map, key));
+    if (i >= map->cap) {
+        return XF_ERR_NOT_FOUND;
+    }
+    if ((NULL != value) && (map->value_size > 0)) {
+        _copy(value, _SLOT(map, i) + map->value_offset, map->value_size);
+    }
+
+    /*
+     * 如果包含 i 的任意一个组宽窗口内都有空槽, 就不会有探测序列因为这里满了
+     * 而越过它继续查找, 可以直接置空而不留墓碑.
+     */
+    size_t mask = map->cap - 1;
+    mask_t empty_before = _group_empty(map->ctrl + ((i - GROUP_WIDTH) & mask));
+    mask_t empty_after = _group_empty(map->ctrl + i);
+    if ((0 != empty_before) && (0 != empty_after)
+            && (_MASK_LAST_GAP(empty_before) + _MASK_FIRST(empty_after) < GROUP_WIDTH)) {
+        _set_ctrl(map, i, CTRL_EMPTY);
+        map->growth_left++;
+    } else {
+        _set_ctrl(map, i, CTRL_DELETED);
+    }
+    map->len--;
+    return XF_OK;
+}
+
+bool xf_hashmap_next(const xf_hashmap_t *map, size_t *iter, void **key, void **value)
+{
+    if ((NULL == map) || (NULL == iter)) {
+        return false;
+    }
+    for (size_t i = *iter; i < map->cap; i++) {
+        if (_IS_FULL(map->ctrl[i])) {
+            uint8_t *slot = _SLOT(map, i);
+            if (NULL != key) {
+                *key = slot;
+            }
+            if (NULL != value) {
+                *value = slot + ((map->value_size > 0) ? map->value_offset : 0);
+            }
+            *iter = i + 1;
+            return true;
+        }
+    }
+    *iter = map->cap;
+    return false;
+}
+
+uint64_t xf_hashmap_hash_bytes(const void *key, size_t key_size)
+{
+    if (8 == key_size) {
+        uint64_t v;
+        _copy(&v, key, 8);
+        return xf_hash_u64(v);
+    }
+    if (4 == key_size) {
+        uint32_t v;
+        _copy(&v, key, 4);
+        return xf_hash_u64(v);
+    }
+    return xf_hash64(key, key_size, 0);
+}
+
+uint64_t xf_hashmap_hash_str(const void *key, size_t key_size)
+{
+    UNUSED(key_size);
+    const char *str = *(const char *const *)key;
+    return xf_hash64(str, xf_strlen(str), 0);
+}
+
+bool xf_hashmap_eq_str(const void *a, const void *b, size_t key_size)
+{
+    UNUSED(key_size);
+    const char *sa = *(const char *const *)a;
+    const char *sb = *(const char *const *)b;
+    return (sa == sb) || (0 == xf_strcmp(sa, sb));
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#if defined(USE_SSE2)
+
+static inline mask_t _group_match(const uint8_t *ctrl, uint8_t h2)
+{
+    __m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+    return (mask_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)h2)));
+}
+
+static inline mask_t _group_empty(const uint8_t *ctrl)
+{
+    __m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+    return (mask_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)CTRL_EMPTY)));
+}
+
+static inline mask_t _group_free(const uint8_t *ctrl)
+{
+    __m128i g = _mm_loadu_si128((const __m128i *)ctrl);
+    return (mask_t)(uint32_t)_mm_movemask_epi8(g);
+}
+
+#elif defined(USE_NEON)
+
+/**
+ * @brief 把逐字节的比较结果（0x00/0xff）压缩为每字节 4 位的 64 位掩码.
+ */
+static inline mask_t _neon_mask(uint8x16_t eq)
+{
+    uint8x8_t n = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(n), 0) & 0x8888888888888888ULL;
+}
+
+static inline mask_t _group_match(const uint8_t *ctrl, uint8_t h2)
+{
+    return _neon_mask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(h2)));
+}
+
+static inline mask_t _group_empty(const uint8_t *ctrl)
+{
+    return _neon_mask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(CTRL_EMPTY)));
+}
+
+static inline mask_t _group_free(const uint8_t *ctrl)
+{
+    return _neon_mask(vtstq_u8(vld1q_u8(ctrl), vdupq_n_u8(0x80)));
+}
+
+#else
+
+static inline uint64_t _load_group(const uint8_t *ctrl)
+{
+    uint64_t g;
+    xf_memcpy(&g, ctrl, sizeof(g));
+#if IS_BIG_ENDIAN
+    g = ((g & 0x00000000ffffffffULL) << 32) | (g >> 32);
+    g = ((g & 0x0000ffff0000ffffULL) << 16) | ((g >> 16) & 0x0000ffff0000ffffULL);
+    g = ((g & 0x00ff00ff00ff00ffULL) << 8) | ((g >> 8) & 0x00ff00ff00ff00ffULL);
+#endif
+    return g;
+}
+
+/**
+ * @brief 按字查找等于 h2 的字节. 真正匹配的字节之后可能有误报, 由键比较排除.
+ */
+static inline mask_t _group_match(const uint8_t *ctrl, uint8_t h2)
+{
+    uint64_t x = _load_group(ctrl) ^ (SWAR_ONES * h2);
+    return (x - SWAR_ONES) & ~x & SWAR_HIGHS;
+}
+
+static inline mask_t _group_empty(const uint8_t *ctrl)
+{
+    /* 只有 EMPTY 最高位为 1 且第 1 位为 0 */
+    uint64_t g = _load_group(ctrl);
+    return g & ~(g << 6) & SWAR_HIGHS;
+}
+
+static inline mask_t _group_free(const uint8_t *ctrl)
+{
+    return _load_group(ctrl) & SWAR_HIGHS;
+}
+
+#endif
+
+static inline uint64_t _hash(const xf_hashmap_t *map, const void *key)
+{
+    if (NULL != map->hash) {
+        return map->hash(key, map->key_size);
+    }
+    return xf_hashmap_hash_bytes(key, map->key_size);
+}
+
+static inline bool _key_eq(const xf_hashmap_t *map, const void *a, const void *b)
+{
+    if (NULL != map->eq) {
+        return map->eq(a, b, map->key_size);
+    }
+#if defined(__GNUC__)
+    switch (map->key_size) {
+    case 4:
+        return 0 == __builtin_memcmp(a, b, 4);
+    case 8:
+        return 0 == __builtin_memcmp(a, b, 8);
+    case 16:
+        return 0 == __builtin_memcmp(a, b, 16);
+    default:
+        break;
+    }
+#endif
+    return 0 == xf_memcmp(a, b, map->key_size);
+}
+
+/**
+ * @brief 复制键或值. 常见大小使用定长复制, 由编译器内联.
+ */
+static inline void _copy(void *dst, const void *src, size_t size)
+{
+#if defined(__GNUC__)
+    switch (size) {
+    case 4:
+        __builtin_memcpy(dst, src, 4);
+        return;
+    case 8:
+        __builtin_memcpy(dst, src, 8);
+        return;
+    case 16:
+        __builtin_memcpy(dst, src, 16);
+        return;
+    default:
+        break;
+    }
+#endif
+    xf_memcpy(dst, src, size);
+}
+
+/**
+ * @brief 设置控制字节. 开头一组同时写入末尾的镜像, 使任意位置都能整组读取.
+ */
+static inline void _set_ctrl(xf_hashmap_t *map, size_t i, uint8_t c)
+{
+    map->ctrl[i] = c;
+    if (i < GROUP_WIDTH) {
+        map->ctrl[map->cap + i] = c;
+    }
+}
+
+/**
+ * @brief 查找键, 返回槽下标, 不存在时返回 cap.
+ */
+static size_t _find(const xf_hashmap_t *map, const void *key, uint64_t hash)
+{
+    size_t mask = map->cap - 1;
+    size_t pos = _H1(hash) & mask;
+    size_t stride = 0;
+    uint8_t h2 = _H2(hash);
+
+    for (;;) {
+        const uint8_t *g = map->ctrl + pos;
+        mask_t m = _group_match(g, h2);
+        while (0 != m) {
+            size_t i = (pos + _MASK_FIRST(m)) & mask;
+            if (_key_eq(map, _SLOT(map, i), key)) {
+                return i;
+            }
+            m &= m - 1;
+        }
+        if (0 != _group_empty(g)) {
+            return map->cap;
+        }
+        /* 三角数探测: 槽数为组宽的 2 的幂倍时可以遍历所有组 */
+        stride += GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/**
+ * @brief 默认哈希和比较下 8 字节键的 _find(), 哈希内联, 键按整数比较.
+ */
+static inline size_t _find_u64(const xf_hashmap_t *map, uint64_t key)
+{
+    uint64_t hash = xf_hash_u64(key);
+    size_t mask = map->cap - 1;
+    size_t pos = _H1(hash) & mask;
+    size_t stride = 0;
+    uint8_t h2 = _H2(hash);
+
+    for (;;) {
+        const uint8_t *g = map->ctrl + pos;
+        mask_t m = _group_match(g, h2);
+        while (0 != m) {
+            size_t i = (pos + _MASK_FIRST(m)) & mask;
+            uint64_t k;
+            _copy(&k, _SLOT(map, i), 8);
+            if (k == key) {
+                return i;
+            }
+            m &= m - 1;
+        }
+        if (0 != _group_empty(g)) {
+            return map->cap;
+        }
+        stride += GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/**
+ * @brief 在探测序列上找第一个空槽或墓碑.
+ */
+static size_t _find_free(const xf_hashmap_t *map, uint64_t hash)
+{
+    size_t mask = map->cap - 1;
+    size_t pos = _H1(hash) & mask;
+    size_t stride = 0;
+
+    for (;;) {
+        mask_t m = _group_free(map->ctrl + pos);
+        if (0 != m) {
+            return (pos + _MASK_FIRST(m)) & mask;
+        }
+        stride += GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/**
+ * @brief 按新容量重新分配, 把所有元素重新插入, 同时清除墓碑.
+ */
+static xf_err_t _rebuild(xf_hashmap_t *map, size_t cap)
+{
+    if (cap > (((size_t)-1) - GROUP_WIDTH) / (map->slot_size + 1)) {
+        return XF_ERR_NO_MEM;
+    }
+    /* 槽数组在前保证对齐, 控制字节紧随其后 */
+    uint8_t *slots = (uint8_t *)xf_malloc(cap * map->slot_size + cap + GROUP_WIDTH);
+    if (NULL == slots) {
+        return XF_ERR_NO_MEM;
+    }
+    xf_hashmap_t old = *map;
+
+    map->slots = slots;
+    map->ctrl = slots + cap * map->slot_size;
+    map->cap = cap;
+    map->growth_left = _max_load(cap) - old.len;
+    xf_memset(map->ctrl, CTRL_EMPTY, cap + GROUP_WIDTH);
+
+    for (size_t i = 0; i < old.cap; i++) {
+        if (!_IS_FULL(old.ctrl[i])) {
+            continue;
+        }
+        const uint8_t *src = old.slots + i * old.slot_size;
+        uint64_t hash = _hash(map, src);
+        size_t j = _find_free(map, hash);
+        _set_ctrl(map, j, _H2(hash));
+        xf_memcpy(_SLOT(map, j), src, map->slot_size);
+    }
+    if (NULL != old.slots) {
+        xf_free(old.slots);
+    }
+    return XF_OK;
+}
+
+static size_t _max_load(size_t cap)
+{
+    return cap / 8 * XF_HASHMAP_MAX_LOAD_NUM;
+}
+
+/**
+ * @brief 由大小推断对齐: 能整除大小的最大 2 的幂, 不超过 8.
+ */
+static size_t _size_align(size_t size)
+{
+    size_t align = 1;
+    while ((align < 8) && (0 == (size & (align * 2 - 1)))) {
+        align *= 2;
+    }
+    return align;
+}
@@ -0,0 +1,242 @@
+/**
+ * @file xf_hashmap.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief Swiss table 风格的开放寻址哈希表。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 键和值按固定大小直接存放在连续的槽数组中, 另有一个控制字节数组,
+ * 每个槽一个字节: 空、已删除, 或哈希值的低 7 位（H2）.
+ *
+ * - 查找时按哈希值的高位（H1）定位到一组槽, 用 SIMD 一次比较 16 个控制字节
+ *   （无 SIMD 时按 64 位字比较 8 个）, 只有 H2 相同的槽才比较键;
+ * - 组内有空槽即可结束查找, 组之间按三角数序列探测;
+ * - 删除时如果该槽所在的连续非空区间不足一组, 说明没有探测序列经过它,
+ *   直接标记为空, 否则才留下墓碑（已删除）;
+ * - 负载因子上限为 XF_HASHMAP_MAX_LOAD_NUM / 8, 超过时容量加倍;
+ *   墓碑较多时按原容量重建.
+ *
+ * 键可以是任意定长数据. 键为字符串时, 可以存放 `const char *` 并使用
+ * xf_hashmap_hash_str / xf_hashmap_eq_str（字符串本身由调用者管理）.
+ *
+ * 使用默认哈希和比较时, 8 字节键的查找走专门路径: 哈希内联, 键按整数比较.
+ * bench_hashmap（x86-64, SSE2）实测的权衡: u64 键命中时仍慢于负载因子 1 的
+ * 链式表（1000 个键约 6.6 ns 对 3.8 ns, 1M 个键约 57 ns 对 40 ns, 后者的节点
+ * 按查找顺序连续分配）, 1M 个键未命中时快约一倍（26 ns 对 56 ns）;
+ * 换来的是元素不需要嵌入链表节点, 每个元素少两个指针.
+ *
+ * @attention 插入和重建会移动槽, 之前返回的值指针随之失效. 不是线程安全的.
+ */
+
+#ifndef __XF_HASHMAP_H__
+#define __XF_HASHMAP_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_hashmap_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_hashmap xf_hashmap
+ * @brief Swiss table 风格的开放寻址哈希表。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief xf_hashmap_next() 的起始迭代位置.
+ */
+#define XF_HASHMAP_ITER_INIT            ((size_t)0)
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 键哈希函数.
+ *
+ * @param key 键.
+ * @param key_size 键大小.
+ * @return uint64_t 哈希值, 高位和低 7 位都应充分混合.
+ */
+typedef uint64_t (*xf_hashmap_hash_t)(const void *key, size_t key_size);
+
+/**
+ * @brief 键比较函数.
+ *
+ * @return bool 两个键是否相等.
+ */
+typedef bool (*xf_hashmap_eq_t)(const void *a, const void *b, size_t key_size);
+
+/**
+ * @brief 哈希表.
+ */
+typedef struct xf_hashmap_s {
+    uint8_t            *ctrl;           /*!< 控制字节, cap + 组宽度个, 末尾镜像开头一组 */
+    uint8_t            *slots;          /*!< 槽数组, 每个槽为键 + 值 */
+    size_t              cap;            /*!< 槽数, 为 0 或 2 的幂 */
+    size_t              len;            /*!< 元素个数 */
+    size_t              growth_left;    /*!< 无需重建还能占用的空槽数 */
+    size_t              key_size;       /*!< 键大小 */
+    size_t              value_size;     /*!< 值大小, 可为 0（集合） */
+    size_t              value_offset;   /*!< 值在槽中的偏移 */
+    size_t              slot_size;      /*!< 槽大小 */
+    xf_hashmap_hash_t   hash;           /*!< 哈希函数 */
+    xf_hashmap_eq_t     eq;             /*!< 比较函数 */
+} xf_hashmap_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化哈希表, 不分配内存.
+ *
+ * @param map 哈希表.
+ * @param key_size 键大小.
+ * @param value_size 值大小, 可为 0.
+ * @param hash 哈希函数, 为 NULL 时使用 xf_hashmap_hash_bytes.
+ * @param eq 比较函数, 为 NULL 时按字节比较.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_hashmap_init(xf_hashmap_t *map, size_t key_size, size_t value_size,
+                         xf_hashmap_hash_t hash, xf_hashmap_eq_t eq);
+
+/**
+ * @brief 释放内存并清空.
+ *
+ * @param map 哈希表.
+ */
+void xf_hashmap_deinit(xf_hashmap_t *map);
+
+/**
+ * @brief 删除所有元素, 保留容量.
+ *
+ * @param map 哈希表.
+ */
+void xf_hashmap_clear(xf_hashmap_t *map);
+
+/**
+ * @brief 预留空间, 使插入 count 个元素之前不再重建.
+ *
+ * @param map 哈希表.
+ * @param count 元素个数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足
+ */
+xf_err_t xf_hashmap_reserve(xf_hashmap_t *map, size_t count);
+
+/**
+ * @brief 查找键.
+ *
+ * @param map 哈希表.
+ * @param key 键.
+ * @return void* 值的地址（value_size 为 0 时为槽地址）, 不存在时返回 NULL.
+ */
+void *xf_hashmap_get(const xf_hashmap_t *map, const void *key);
+
+/**
+ * @brief 查找键, 不存在时插入（值未初始化）.
+ *
+ * @param map 哈希表.
+ * @param key 键.
+ * @param[out] inserted 是否新插入, 可为 NULL.
+ * @return void* 值的地址, 内存不足时返回 NULL.
+ */
+void *xf_hashmap_emplace(xf_hashmap_t *map, const void *key, bool *inserted);
+
+/**
+ * @brief 插入键值, 键已存在时覆盖值.
+ *
+ * @param map 哈希表.
+ * @param key 键.
+ * @param value 值, value_size 为 0 时可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足
+ */
+xf_err_t xf_hashmap_put(xf_hashmap_t *map, const void *key, const void *value);
+
+/**
+ * @brief 删除键.
+ *
+ * @param map 哈希表.
+ * @param key 键.
+ * @param[out] value 被删除的值, 可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_FOUND      键不存在
+ */
+xf_err_t xf_hashmap_remove(xf_hashmap_t *map, const void *key, void *value);
+
+/**
+ * @brief 遍历所有元素, 顺序不确定. 遍历期间不能插入, 可以删除当前元素.
+ *
+ * @code{.c}
+ * size_t iter = XF_HASHMAP_ITER_INIT;
+ * void *key, *value;
+ * while (xf_hashmap_next(&map, &iter, &key, &value)) {
+ *     ...
+ * }
+ * @endcode
+ *
+ * @param map 哈希表.
+ * @param[in,out] iter 迭代位置.
+ * @param[out] key 键的地址, 可为 NULL.
+ * @param[out] value 值的地址, 可为 NULL.
+ * @return bool 是否取到元素.
+ */
+bool xf_hashmap_next(const xf_hashmap_t *map, size_t *iter, void **key, void **value);
+
+/**
+ * @brief 默认哈希函数: 键大小为 4 或 8 时按整数哈希, 否则按字节串哈希.
+ */
+uint64_t xf_hashmap_hash_bytes(const void *key, size_t key_size);
+
+/**
+ * @brief 键为 `const char *` 时的哈希函数, 按字符串内容计算.
+ */
+uint64_t xf_hashmap_hash_str(const void *key, size_t key_size);
+
+/**
+ * @brief 键为 `const char *` 时的比较函数, 按字符串内容比较.
+ */
+bool xf_hashmap_eq_str(const void *a, const void *b, size_t key_size);
+
+/**
+ * @brief 元素个数.
+ */
+static inline size_t xf_hashmap_len(const xf_hashmap_t *map)
+{
+    return map->len;
+}
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_hashmap
+ * @}
+ */
+
+#endif // __XF_HASHMAP_H__
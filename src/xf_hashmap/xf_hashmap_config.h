@@ -0,0 +1,56 @@
+/**
+ * @file xf_hashmap_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 开放寻址哈希表配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_HASHMAP_CONFIG_H__
+#define __XF_HASHMAP_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 控制字节是否使用 SIMD（x86 SSE2, AArch64 NEON）一次探测 16 个槽,
+ *        其余平台按 64 位字一次探测 8 个槽.
+ */
+#if !defined(XF_HASHMAP_SIMD_ENABLE) || (XF_HASHMAP_SIMD_ENABLE)
+#   define XF_HASHMAP_SIMD_IS_ENABLE    (1)
+#else
+#   define XF_HASHMAP_SIMD_IS_ENABLE    (0)
+#endif
+
+/**
+ * @brief 最大负载因子 = XF_HASHMAP_MAX_LOAD_NUM / 8.
+ */
+#if !defined(XF_HASHMAP_MAX_LOAD_NUM)
+#   define XF_HASHMAP_MAX_LOAD_NUM      (7)
+#endif
+
+#if (XF_HASHMAP_MAX_LOAD_NUM < 1) || (XF_HASHMAP_MAX_LOAD_NUM > 7)
+#   error "xf_hashmap: XF_HASHMAP_MAX_LOAD_NUM must be in [1, 7]"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_HASHMAP_CONFIG_H__
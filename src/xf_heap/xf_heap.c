@@ -0,0 +1,301 @@
+/**
+ * @file xf_heap.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 数组二叉堆。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_heap.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_std/xf_string.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 首次分配时的最小容量 */
+#define MIN_CAP                         (8)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_err_t _resize(xf_heap_t *heap, size_t cap);
+static inline size_t _sift_up(xf_heap_t *heap, size_t i);
+static inline size_t _sift_down(xf_heap_t *heap, size_t i);
+static inline size_t _hole_to_leaf(xf_heap_t *heap, size_t i);
+static inline void _move(xf_heap_t *heap, size_t dst, size_t src);
+static inline void _place(xf_heap_t *heap, size_t i);
+static inline void _copy(void *dst, const void *src, size_t size);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#define _AT(heap, i)                    ((heap)->data + (i) * (heap)->elem_size)
+
+/* 临时空间位于数组末尾, 上浮/下沉时待放置的元素保存在这里, 其余元素只移动不交换 */
+#define _TMP(heap)                      _AT((heap), (heap)->cap)
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_heap_init(xf_heap_t *heap, size_t elem_size, xf_heap_cmp_t cmp)
+{
+    if ((NULL == heap) || (0 == elem_size) || (NULL == cmp)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    heap->data = NULL;
+    heap->len = 0;
+    heap->cap = 0;
+    heap->elem_size = elem_size;
+    heap->cmp = cmp;
+    heap->index_cb = NULL;
+    heap->is_static = false;
+    return XF_OK;
+}
+
+xf_err_t xf_heap_init_static(
+    xf_heap_t *heap, void *buf, size_t cap, size_t elem_size, xf_heap_cmp_t cmp)
+{
+    if ((NULL == heap) || (NULL == buf) || (0 == elem_size) || (NULL == cmp)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    heap->data = (uint8_t *)buf;
+    heap->len = 0;
+    heap->cap = cap;
+    heap->elem_size = elem_size;
+    heap->cmp = cmp;
+    heap->index_cb = NULL;
+    heap->is_static = true;
+    return XF_OK;
+}
+
+void xf_heap_deinit(xf_heap_t *heap)
+{
+    if (NULL == heap) {
+        return;
+    }
+    if (!heap->is_static) {
+        if (NULL != heap->data) {
+            xf_free(heap->data);
+        }
+        heap->data = NULL;
+        heap->cap = 0;
+    }
+    heap->len = 0;
+}
+
+void xf_heap_set_index_cb(xf_heap_t *heap, xf_heap_index_cb_t cb)
+{
+    if (NULL == heap) {
+        return;
+    }
+    heap->index_cb = cb;
+}
+
+xf_err_t xf_heap_reserve(xf_heap_t *heap, size_t cap)
+{
+    if (NULL == heap) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (cap <= heap->cap) {
+        return XF_OK;
+    }
+    if (heap->is_static) {
+        return XF_ERR_NO_MEM;
+    }
+    return _resize(heap, cap);
+}
+
+xf_err_t xf_heap_push(xf_heap_t *heap, const void *elem)
+{
+    if ((NULL == heap) || (NULL == elem)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (heap->len == heap->cap) {
+        if (heap->is_static) {
+            return XF_ERR_NO_MEM;
+        }
+        size_t cap = (heap->cap < MIN_CAP) ? MIN_CAP : heap->cap * 2;
+        if ((cap < heap->cap) || (XF_OK != _resize(heap, cap))) {
+            return XF_ERR_NO_MEM;
+        }
+    }
+    _copy(_TMP(heap), elem, heap->elem_size);
+    _place(heap, _sift_up(heap, heap->len++));
+    return XF_OK;
+}
+
+xf_err_t xf_heap_pop(xf_heap_t *heap, void *out)
+{
+    if (NULL == heap) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (0 == heap->len) {
+        return XF_ERR_NOT_FOUND;
+    }
+    return xf_heap_remove(heap, 0, out);
+}
+
+xf_err_t xf_heap_remove(xf_heap_t *heap, size_t index, void *out)
+{
+    if ((NULL == heap) || (index >= heap->len)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (NULL != out) {
+        _copy(out, _AT(heap, index), heap->elem_size);
+    }
+    heap->len--;
+    if (index == heap->len) {
+        return XF_OK;
+    }
+    /*
+     * 用最后一个元素填补空位. 先把空位沿较小的子节点移到叶子（每层一次比较）,
+     * 再让最后一个元素从叶子上浮; 它通常本来就接近底部, 上浮很短.
+     */
+    _copy(_TMP(heap), _AT(heap, heap->len), heap->elem_size);
+    _place(heap, _sift_up(heap, _hole_to_leaf(heap, index)));
+    return XF_OK;
+}
+
+xf_err_t xf_heap_update(xf_heap_t *heap, size_t index)
+{
+    if ((NULL == heap) || (index >= heap->len)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    _copy(_TMP(heap), _AT(heap, index), heap->elem_size);
+    size_t i = _sift_up(heap, index);
+    if (i == index) {
+        i = _sift_down(heap, index);
+    }
+    _place(heap, i);
+    return XF_OK;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static xf_err_t _resize(xf_heap_t *heap, size_t cap)
+{
+    /* 多分配一个元素作为临时空间 */
+    if (cap >= ((size_t)-1) / heap->elem_size) {
+        return XF_ERR_NO_MEM;
+    }
+    uint8_t *data = (uint8_t *)xf_malloc((cap + 1) * heap->elem_size);
+    if (NULL == data) {
+        return XF_ERR_NO_MEM;
+    }
+    if (heap->len > 0) {
+        xf_memcpy(data, heap->data, heap->len * heap->elem_size);
+    }
+    if (NULL != heap->data) {
+        xf_free(heap->data);
+    }
+    heap->data = data;
+    heap->cap = cap;
+    return XF_OK;
+}
+
+/**
+ * @brief 从空位 i 开始, 为临时空间中的元素向上寻找位置, 返回最终空位.
+ */
+static inline size_t _sift_up(xf_heap_t *heap, size_t i)
+{
+    const uint8_t *tmp = _TMP(heap);
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (heap->cmp(tmp, _AT(heap, parent)) >= 0) {
+            break;
+        }
+        _move(heap, i, parent);
+        i = parent;
+    }
+    return i;
+}
+
+/**
+ * @brief 从空位 i 开始, 为临时空间中的元素向下寻找位置, 返回最终空位.
+ */
+static inline size_t _sift_down(xf_heap_t *heap, size_t i)
+{
+    const uint8_t *tmp = _TMP(heap);
+    for (;;) {
+        size_t child = i * 2 + 1;
+        if (child >= heap->len) {
+            break;
+        }
+        if ((child + 1 < heap->len)
+                && (heap->cmp(_AT(heap, child + 1), _AT(heap, child)) < 0)) {
+            child++;
+        }
+        if (heap->cmp(_AT(heap, child), tmp) >= 0) {
+            break;
+        }
+        _move(heap, i, child);
+        i = child;
+    }
+    return i;
+}
+
+/**
+ * @brief 把空位 i 沿较小的子节点一直移到叶子, 返回最终空位.
+ */
+static inline size_t _hole_to_leaf(xf_heap_t *heap, size_t i)
+{
+    for (;;) {
+        size_t child = i * 2 + 1;
+        if (child >= heap->len) {
+            break;
+        }
+        if ((child + 1 < heap->len)
+                && (heap->cmp(_AT(heap, child + 1), _AT(heap, child)) < 0)) {
+            child++;
+        }
+        _move(heap, i, child);
+        i = child;
+    }
+    return i;
+}
+
+static inline void _move(xf_heap_t *heap, size_t dst, size_t src)
+{
+    _copy(_AT(heap, dst), _AT(heap, src), heap->elem_size);
+    if (NULL != heap->index_cb) {
+        heap->index_cb(_AT(heap, dst), dst);
+    }
+}
+
+static inline void _place(xf_heap_t *heap, size_t i)
+{
+    _copy(_AT(heap, i), _TMP(heap), heap->elem_size);
+    if (NULL != heap->index_cb) {
+        heap->index_cb(_AT(heap, i), i);
+    }
+}
+
+/**
+ * @brief 复制一个元素. 常见的元素大小（整数、指针、键值对）使用定长复制,
+ *        由编译器内联为一两条读写指令, 避免每次移动都调用 memcpy.
+ */
+static inline void _copy(void *dst, const void *src, size_t size)
+{
+#if defined(__GNUC__)
+    switch (size) {
+    case 4:
+        __builtin_memcpy(dst, src, 4);
+        return;
+    case 8:
+        __builtin_memcpy(dst, src, 8);
+        return;
+    case 16:
+        __builtin_memcpy(dst, src, 16);
+        return;
+    default:
+        break;
+    }
+#endif
+    xf_memcpy(dst, src, size);
+}
@@ -0,0 +1,317 @@
+/**
+ * @file xf_heap.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 优先队列: 数组二叉堆（xf_heap）与侵入式配对堆（xf_pheap）。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 两者都是最小堆, "最小"由比较函数决定（cmp(a, b) < 0 表示 a 先出队）.
+ *
+ * - xf_heap: 元素按值存放在连续数组中, push/pop/update O(log n).
+ *   数组可由 xf_malloc 按 2 倍增长, 也可以使用调用者提供的定长缓冲区.
+ *   需要 decrease-key 时, 通过 xf_heap_set_index_cb() 跟踪元素下标,
+ *   修改键值后调用 xf_heap_update().
+ * - xf_pheap: 节点嵌入用户结构体, 不分配内存. insert/decrease O(1),
+ *   pop/remove 均摊 O(log n). 适合定时器等节点本身已存在的场景.
+ *
+ * 两者都不是线程安全的.
+ */
+
+#ifndef __XF_HEAP_H__
+#define __XF_HEAP_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_common/xf_common.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_heap xf_heap
+ * @brief 数组二叉堆与侵入式配对堆。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief xf_heap 元素比较函数, 同 qsort.
+ *
+ * @return int < 0 表示 a 比 b 先出队.
+ */
+typedef int (*xf_heap_cmp_t)(const void *a, const void *b);
+
+/**
+ * @brief xf_heap 元素被放到新下标时的回调, 用于跟踪元素位置.
+ *
+ * @param elem 元素在堆数组中的地址.
+ * @param index 新下标.
+ */
+typedef void (*xf_heap_index_cb_t)(void *elem, size_t index);
+
+/**
+ * @brief 数组二叉堆.
+ */
+typedef struct xf_heap_s {
+    uint8_t            *data;           /*!< 元素数组, 末尾多一个元素作为临时空间 */
+    size_t              len;            /*!< 元素个数 */
+    size_t              cap;            /*!< 容量（不含临时空间） */
+    size_t              elem_size;      /*!< 元素大小 */
+    xf_heap_cmp_t       cmp;            /*!< 比较函数 */
+    xf_heap_index_cb_t  index_cb;       /*!< 下标回调, 可为 NULL */
+    bool                is_static;      /*!< 是否使用调用者提供的缓冲区 */
+} xf_heap_t;
+
+typedef struct xf_pheap_node_s xf_pheap_node_t;
+
+/**
+ * @brief 配对堆节点. 通常嵌入到用户结构体中.
+ */
+struct xf_pheap_node_s {
+    xf_pheap_node_t    *child;          /*!< 第一个子节点 */
+    xf_pheap_node_t    *next;           /*!< 下一个兄弟节点 */
+    xf_pheap_node_t    *prev;           /*!< 第一个子节点指向父节点, 其余指向上一个兄弟 */
+};
+
+/**
+ * @brief 配对堆节点比较函数. 通过 xf_container_of 取得用户结构体.
+ *
+ * @return int < 0 表示 a 比 b 先出队.
+ */
+typedef int (*xf_pheap_cmp_t)(const xf_pheap_node_t *a, const xf_pheap_node_t *b);
+
+/**
+ * @brief 侵入式配对堆.
+ */
+typedef struct xf_pheap_s {
+    xf_pheap_node_t    *root;           /*!< 堆顶 */
+    size_t              size;           /*!< 节点个数 */
+    xf_pheap_cmp_t      cmp;            /*!< 比较函数 */
+} xf_pheap_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化数组堆, 内存由 xf_malloc 按需分配.
+ *
+ * @param heap 堆.
+ * @param elem_size 元素大小.
+ * @param cmp 比较函数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_heap_init(xf_heap_t *heap, size_t elem_size, xf_heap_cmp_t cmp);
+
+/**
+ * @brief 使用调用者提供的缓冲区初始化数组堆, 不分配内存.
+ *
+ * @param heap 堆.
+ * @param buf 缓冲区, 大小为 (cap + 1) * elem_size 字节, 需按元素类型对齐.
+ * @param cap 容量（元素个数）. 堆满时 push 返回 XF_ERR_NO_MEM.
+ * @param elem_size 元素大小.
+ * @param cmp 比较函数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_heap_init_static(
+    xf_heap_t *heap, void *buf, size_t cap, size_t elem_size, xf_heap_cmp_t cmp);
+
+/**
+ * @brief 释放数组堆的内存（xf_heap_init 时）, 并清空.
+ *
+ * @param heap 堆.
+ */
+void xf_heap_deinit(xf_heap_t *heap);
+
+/**
+ * @brief 设置下标回调. 元素每次移动到新下标时调用, 用于 decrease-key.
+ *
+ * @param heap 堆.
+ * @param cb 回调, 为 NULL 时取消.
+ */
+void xf_heap_set_index_cb(xf_heap_t *heap, xf_heap_index_cb_t cb);
+
+/**
+ * @brief 保证容量不小于 cap 个元素.
+ *
+ * @param heap 堆.
+ * @param cap 容量.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足, 或定长缓冲区不够
+ */
+xf_err_t xf_heap_reserve(xf_heap_t *heap, size_t cap);
+
+/**
+ * @brief 压入元素（按值复制）. O(log n).
+ *
+ * @param heap 堆.
+ * @param elem 元素.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足, 或定长缓冲区已满
+ */
+xf_err_t xf_heap_push(xf_heap_t *heap, const void *elem);
+
+/**
+ * @brief 弹出堆顶元素. O(log n).
+ *
+ * @param heap 堆.
+ * @param[out] out 堆顶元素, 可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_FOUND      堆为空
+ */
+xf_err_t xf_heap_pop(xf_heap_t *heap, void *out);
+
+/**
+ * @brief 删除下标 index 处的元素. O(log n).
+ *
+ * @param heap 堆.
+ * @param index 下标.
+ * @param[out] out 被删除的元素, 可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误或下标越界
+ */
+xf_err_t xf_heap_remove(xf_heap_t *heap, size_t index, void *out);
+
+/**
+ * @brief 下标 index 处元素的键值被修改后, 恢复堆序. O(log n).
+ *
+ * 键值变小（decrease-key）时上浮, 变大时下沉.
+ *
+ * @param heap 堆.
+ * @param index 下标.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误或下标越界
+ */
+xf_err_t xf_heap_update(xf_heap_t *heap, size_t index);
+
+/**
+ * @brief 获取堆顶元素, 不弹出.
+ *
+ * @param heap 堆.
+ * @return void* 堆顶元素地址, 堆为空时返回 NULL. 下一次修改前有效.
+ */
+static inline void *xf_heap_peek(const xf_heap_t *heap)
+{
+    return (heap->len > 0) ? heap->data : NULL;
+}
+
+/**
+ * @brief 获取下标 index 处元素的地址, 不检查下标.
+ */
+static inline void *xf_heap_at(const xf_heap_t *heap, size_t index)
+{
+    return heap->data + index * heap->elem_size;
+}
+
+/**
+ * @brief 元素个数.
+ */
+static inline size_t xf_heap_len(const xf_heap_t *heap)
+{
+    return heap->len;
+}
+
+/**
+ * @brief 初始化配对堆.
+ *
+ * @param heap 堆.
+ * @param cmp 比较函数.
+ */
+void xf_pheap_init(xf_pheap_t *heap, xf_pheap_cmp_t cmp);
+
+/**
+ * @brief 插入节点. O(1).
+ *
+ * @param heap 堆.
+ * @param node 节点, 不能已在堆中.
+ */
+void xf_pheap_insert(xf_pheap_t *heap, xf_pheap_node_t *node);
+
+/**
+ * @brief 弹出堆顶节点. 均摊 O(log n).
+ *
+ * @param heap 堆.
+ * @return xf_pheap_node_t* 堆顶节点, 堆为空时返回 NULL.
+ */
+xf_pheap_node_t *xf_pheap_pop(xf_pheap_t *heap);
+
+/**
+ * @brief 节点的键值变小后调用, 调整其位置. O(1).
+ *
+ * @param heap 堆.
+ * @param node 堆中的节点.
+ */
+void xf_pheap_decrease(xf_pheap_t *heap, xf_pheap_node_t *node);
+
+/**
+ * @brief 从堆中删除任意节点. 均摊 O(log n).
+ *
+ * @param heap 堆.
+ * @param node 堆中的节点.
+ */
+void xf_pheap_remove(xf_pheap_t *heap, xf_pheap_node_t *node);
+
+/**
+ * @brief 获取堆顶节点, 不弹出.
+ *
+ * @param heap 堆.
+ * @return xf_pheap_node_t* 堆顶节点, 堆为空时返回 NULL.
+ */
+static inline xf_pheap_node_t *xf_pheap_peek(const xf_pheap_t *heap)
+{
+    return heap->root;
+}
+
+/**
+ * @brief 节点个数.
+ */
+static inline size_t xf_pheap_size(const xf_pheap_t *heap)
+{
+    return heap->size;
+}
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 数组堆是否为空.
+ */
+#define xf_heap_is_empty(heap)          (0 == (heap)->len)
+
+/**
+ * @brief 配对堆是否为空.
+ */
+#define xf_pheap_is_empty(heap)         (NULL == (heap)->root)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_heap
+ * @}
+ */
+
+#endif // __XF_HEAP_H__
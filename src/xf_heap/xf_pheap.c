@@ -0,0 +1,168 @@
+/**
+ * @file xf_pheap.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 侵入式配对堆。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_heap.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_pheap_node_t *_meld(xf_pheap_cmp_t cmp, xf_pheap_node_t *a, xf_pheap_node_t *b);
+static xf_pheap_node_t *_merge_pairs(xf_pheap_cmp_t cmp, xf_pheap_node_t *first);
+static void _detach(xf_pheap_node_t *node);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#define _NODE_CLEAR(node) do { \
+        (node)->child = NULL; \
+        (node)->next = NULL; \
+        (node)->prev = NULL; \
+    } while (0)
+
+/* ==================== [Global Functions] ================================== */
+
+void xf_pheap_init(xf_pheap_t *heap, xf_pheap_cmp_t cmp)
+{
+    heap->root = NULL;
+    heap->size = 0;
+    heap->cmp = cmp;
+}
+
+void xf_pheap_insert(xf_pheap_t *heap, xf_pheap_node_t *node)
+{
+    _NODE_CLEAR(node);
+    heap->root = (NULL == heap->root) ? node : _meld(heap->cmp, heap->root, node);
+    heap->size++;
+}
+
+xf_pheap_node_t *xf_pheap_pop(xf_pheap_t *heap)
+{
+    xf_pheap_node_t *top = heap->root;
+    if (NULL == top) {
+        return NULL;
+    }
+    heap->root = _merge_pairs(heap->cmp, top->child);
+    heap->size--;
+    _NODE_CLEAR(top);
+    return top;
+}
+
+void xf_pheap_decrease(xf_pheap_t *heap, xf_pheap_node_t *node)
+{
+    if (node == heap->root) {
+        return;
+    }
+    /* 连同子树一起摘下, 子树仍满足堆序, 再与根合并 */
+    _detach(node);
+    heap->root = _meld(heap->cmp, heap->root, node);
+}
+
+void xf_pheap_remove(xf_pheap_t *heap, xf_pheap_node_t *node)
+{
+    if (node == heap->root) {
+        xf_pheap_pop(heap);
+        return;
+    }
+    _detach(node);
+    xf_pheap_node_t *sub = _merge_pairs(heap->cmp, node->child);
+    if (NULL != sub) {
+        heap->root = _meld(heap->cmp, heap->root, sub);
+    }
+    heap->size--;
+    _NODE_CLEAR(node);
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 合并两棵树（a, b 都是没有兄弟的根）, 较大者成为较小者的第一个子节点.
+ */
+static xf_pheap_node_t *_meld(xf_pheap_cmp_t cmp, xf_pheap_node_t *a, xf_pheap_node_t *b)
+{
+    if (cmp(b, a) < 0) {
+        xf_pheap_node_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    b->prev = a;
+    b->next = a->child;
+    if (NULL != a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    return a;
+}
+
+/**
+ * @brief 两趟合并兄弟链表: 从左到右两两合并, 再从右到左依次合并. 非递归.
+ */
+static xf_pheap_node_t *_merge_pairs(xf_pheap_cmp_t cmp, xf_pheap_node_t *first)
+{
+    xf_pheap_node_t *stack = NULL;
+
+    /* 第一趟: 两两合并, 结果通过 next 逆序串起来 */
+    while (NULL != first) {
+        xf_pheap_node_t *a = first;
+        xf_pheap_node_t *b = a->next;
+        a->prev = NULL;
+        if (NULL == b) {
+            a->next = stack;
+            stack = a;
+            break;
+        }
+        first = b->next;
+        a->next = NULL;
+        b->next = NULL;
+        b->prev = NULL;
+        xf_pheap_node_t *m = _meld(cmp, a, b);
+        m->next = stack;
+        stack = m;
+    }
+    if (NULL == stack) {
+        return NULL;
+    }
+
+    /* 第二趟: 从最右侧开始依次合并 */
+    xf_pheap_node_t *root = stack;
+    stack = stack->next;
+    root->next = NULL;
+    while (NULL != stack) {
+        xf_pheap_node_t *n = stack;
+        stack = stack->next;
+        n->next = NULL;
+        root = _meld(cmp, root, n);
+    }
+    root->prev = NULL;
+    return root;
+}
+
+/**
+ * @brief 把非根节点（连同其子树）从父节点或兄弟链表中摘下.
+ */
+static void _detach(xf_pheap_node_t *node)
+{
+    if (node->prev->child == node) {
+        node->prev->child = node->next;
+    } else {
+        node->prev->next = node->next;
+    }
+    if (NULL != node->next) {
+        node->next->prev = node->prev;
+    }
+    node->next = NULL;
+    node->prev = NULL;
+}
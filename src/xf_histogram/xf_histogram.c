@@ -0,0 +1,284 @@
+/**
+ * @file xf_histogram.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 对数-线性分桶的延时直方图（HDR 风格）。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_histogram.h"
+#include "../xf_utils_log/xf_utils_log.h"
+#include "../xf_std/xf_stddef.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define SUB_BITS                        XF_HISTOGRAM_SUB_BUCKET_BITS
+#define SUB_BUCKETS                     XF_HISTOGRAM_SUB_BUCKETS
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static uint64_t _bucket_upper(uint32_t index);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#if XF_HISTOGRAM_IS_LOCK_FREE
+#define _LOAD(p)                        xf_atomic_load((p), XF_ATOMIC_RELAXED)
+#define _STORE(p, v)                    xf_atomic_store((p), (v), XF_ATOMIC_RELAXED)
+#define _LOCK(hist)                     ((void)0)
+#define _UNLOCK(hist)                   ((void)0)
+#else
+#define _LOAD(p)                        (*(p))
+#define _STORE(p, v)                    ((void)(*(p) = (v)))
+#define _LOCK(hist)                     ((void)xf_lock_lock((hist)->lock))
+#define _UNLOCK(hist)                   ((void)xf_lock_unlock((hist)->lock))
+#endif
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_histogram_init(xf_histogram_t *hist)
+{
+    if (NULL == hist) {
+        return XF_ERR_INVALID_ARG;
+    }
+    hist->next = NULL;
+#if !XF_HISTOGRAM_IS_LOCK_FREE
+    if (XF_OK != xf_lock_init(&hist->lock)) {
+        return XF_FAIL;
+    }
+#endif
+    return xf_histogram_reset(hist);
+}
+
+xf_err_t xf_histogram_deinit(xf_histogram_t *hist)
+{
+    if (NULL == hist) {
+        return XF_ERR_INVALID_ARG;
+    }
+#if !XF_HISTOGRAM_IS_LOCK_FREE
+    xf_lock_destroy(hist->lock);
+    hist->lock = NULL;
+#endif
+    return XF_OK;
+}
+
+xf_err_t xf_histogram_reset(xf_histogram_t *hist)
+{
+    if (NULL == hist) {
+        return XF_ERR_INVALID_ARG;
+    }
+    _LOCK(hist);
+    _STORE(&hist->count, 0);
+    for (uint32_t i = 0; i < XF_HISTOGRAM_BUCKETS; i++) {
+        _STORE(&hist->buckets[i], 0);
+    }
+    _STORE(&hist->sum, 0);
+    _STORE(&hist->min, UINT64_MAX);
+    _STORE(&hist->max, 0);
+    _UNLOCK(hist);
+    return XF_OK;
+}
+
+void xf_histogram_record_atomic(xf_histogram_t *hist, uint64_t value)
+{
+#if XF_HISTOGRAM_IS_LOCK_FREE
+    uint64_t cur;
+
+    xf_atomic_fetch_add(&hist->buckets[xf_histogram_bucket_index(value)], 1, XF_ATOMIC_RELAXED);
+    xf_atomic_fetch_add(&hist->sum, value, XF_ATOMIC_RELAXED);
+    cur = _LOAD(&hist->min);
+    while ((value < cur)
+            && !xf_atomic_cas_weak(&hist->min, &cur, value, XF_ATOMIC_RELAXED, XF_ATOMIC_RELAXED)) {
+    }
+    cur = _LOAD(&hist->max);
+    while ((value > cur)
+            && !xf_atomic_cas_weak(&hist->max, &cur, value, XF_ATOMIC_RELAXED, XF_ATOMIC_RELAXED)) {
+    }
+    xf_atomic_fetch_add(&hist->count, 1, XF_ATOMIC_RELEASE);
+#else
+    _LOCK(hist);
+    hist->buckets[xf_histogram_bucket_index(value)]++;
+    hist->sum += value;
+    if (value < hist->min) {
+        hist->min = value;
+    }
+    if (value > hist->max) {
+        hist->max = value;
+    }
+    hist->count++;
+    _UNLOCK(hist);
+#endif
+}
+
+#if !XF_HISTOGRAM_IS_LOCK_FREE
+uint64_t xf_histogram_load_locked(const xf_histogram_t *hist, const uint64_t *p)
+{
+    _LOCK(hist);
+    uint64_t v = *p;
+    _UNLOCK(hist);
+    return v;
+}
+#endif
+
+xf_err_t xf_histogram_merge(xf_histogram_t *dst, const xf_histogram_t *src)
+{
+    if ((NULL == dst) || (NULL == src) || (dst == src)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    /**
+     * 以桶的和作为样本数, 保证合并结果自洽（count 与桶一致）;
+     * 源正被写入时, count 可能比桶的和少几个.
+     */
+    uint64_t count = 0;
+    _LOCK(src);
+    for (uint32_t i = 0; i < XF_HISTOGRAM_BUCKETS; i++) {
+        uint64_t n = _LOAD(&src->buckets[i]);
+        dst->buckets[i] += n;
+        count += n;
+    }
+    uint64_t sum = _LOAD(&src->sum);
+    uint64_t min = _LOAD(&src->min);
+    uint64_t max = _LOAD(&src->max);
+    _UNLOCK(src);
+    if (0 == count) {
+        return XF_OK;
+    }
+    _LOCK(dst);
+    dst->count += count;
+    dst->sum += sum;
+    if (min < dst->min) {
+        dst->min = min;
+    }
+    if (max > dst->max) {
+        dst->max = max;
+    }
+    _UNLOCK(dst);
+    return XF_OK;
+}
+
+uint64_t xf_histogram_percentile(const xf_histogram_t *hist, double percentile)
+{
+    if (NULL == hist) {
+        return 0;
+    }
+    if (percentile < 0.0) {
+        percentile = 0.0;
+    } else if (percentile > 100.0) {
+        percentile = 100.0;
+    }
+    uint64_t total = 0;
+    _LOCK(hist);
+    for (uint32_t i = 0; i < XF_HISTOGRAM_BUCKETS; i++) {
+        total += _LOAD(&hist->buckets[i]);
+    }
+    if (0 == total) {
+        _UNLOCK(hist);
+        return 0;
+    }
+
+    /* 第 rank 个样本（从 1 计）所在的桶 */
+    uint64_t rank = (uint64_t)(percentile / 100.0 * (double)total + 0.5);
+    if (rank < 1) {
+        rank = 1;
+    } else if (rank > total) {
+        rank = total;
+    }
+    uint64_t acc = 0;
+    uint32_t index = XF_HISTOGRAM_BUCKETS - 1;
+    for (uint32_t i = 0; i < XF_HISTOGRAM_BUCKETS; i++) {
+        acc += _LOAD(&hist->buckets[i]);
+        if (acc >= rank) {
+            index = i;
+            break;
+        }
+    }
+
+    uint64_t value = _bucket_upper(index);
+    uint64_t min = _LOAD(&hist->min);
+    uint64_t max = _LOAD(&hist->max);
+    _UNLOCK(hist);
+    if (value > max) {
+        value = max;
+    }
+    if (value < min) {
+        value = min;
+    }
+    return value;
+}
+
+xf_err_t xf_histogram_dump(const xf_histogram_t *hist, const char *tag, const char *name)
+{
+    if ((NULL == hist) || (NULL == tag)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    XF_LOGI(tag, "%s: n=%llu min=%llu mean=%llu p50=%llu p90=%llu p99=%llu p999=%llu max=%llu",
+            name ? name : "",
+            (unsigned long long)xf_histogram_get_count(hist),
+            (unsigned long long)xf_histogram_get_min(hist),
+            (unsigned long long)xf_histogram_get_mean(hist),
+            (unsigned long long)xf_histogram_percentile(hist, 50.0),
+            (unsigned long long)xf_histogram_percentile(hist, 90.0),
+            (unsigned long long)xf_histogram_percentile(hist, 99.0),
+            (unsigned long long)xf_histogram_percentile(hist, 99.9),
+            (unsigned long long)xf_histogram_get_max(hist));
+    return XF_OK;
+}
+
+xf_err_t xf_histogram_group_add(xf_histogram_group_t *group, xf_histogram_t *hist)
+{
+    if ((NULL == group) || (NULL == hist)) {
+        return XF_ERR_INVALID_ARG;
+    }
+#if XF_ATOMIC_IS_SUPPORTED
+    xf_histogram_t *head = xf_atomic_load(&group->head, XF_ATOMIC_RELAXED);
+    do {
+        hist->next = head;
+    } while (!xf_atomic_cas_weak(&group->head, &head, hist,
+                                 XF_ATOMIC_RELEASE, XF_ATOMIC_RELAXED));
+#else
+    hist->next = group->head;
+    group->head = hist;
+#endif
+    return XF_OK;
+}
+
+xf_err_t xf_histogram_group_merge(xf_histogram_group_t *group, xf_histogram_t *dst)
+{
+    if ((NULL == group) || (NULL == dst)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_histogram_t *pos = xf_atomic_load(&group->head, XF_ATOMIC_ACQUIRE);
+    while (pos) {
+        if (pos != dst) {
+            xf_histogram_merge(dst, pos);
+        }
+        pos = pos->next;
+    }
+    return XF_OK;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 桶内的最大值（含）.
+ */
+static uint64_t _bucket_upper(uint32_t index)
+{
+    if (index < SUB_BUCKETS) {
+        return index;
+    }
+    if (index >= XF_HISTOGRAM_BUCKETS - 1) {
+        return UINT64_MAX;
+    }
+    uint32_t shift = index / SUB_BUCKETS - 1;
+    uint64_t lower = (uint64_t)(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+    return lower + (((uint64_t)1 << shift) - 1);
+}
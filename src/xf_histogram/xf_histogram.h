@@ -0,0 +1,369 @@
+/**
+ * @file xf_histogram.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 对数-线性分桶的延时直方图（HDR 风格）。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 小于 2^SUB_BUCKET_BITS 的值每个值一个桶; 其余值按最高位所在的 2 的幂区间分组,
+ * 每组再线性划分为 2^SUB_BUCKET_BITS 个子桶, 因此相对误差恒定,
+ * 记录只需一次 clz 和一次自增.
+ *
+ * 并发模型:
+ * - xf_histogram_record() 只允许单个线程写入（通常每个线程一个直方图）,
+ *   不使用锁和原子读-改-写指令, 其他线程可以随时读取（合并、查询）;
+ * - 多线程写同一个直方图时使用 xf_histogram_record_atomic();
+ * - 目标不支持无锁的 64 位原子读写时（如 32 位 Cortex-M, 见 XF_HISTOGRAM_IS_LOCK_FREE）,
+ *   读写改为在每个直方图各自的锁下进行, 需要先对接 xf_lock;
+ * - 每个线程的直方图可以通过 xf_histogram_group_add() 挂到同一个组,
+ *   再用 xf_histogram_group_merge() 汇总.
+ *
+ * 用法:
+ * @code{.c}
+ * static xf_histogram_t s_hist;
+ * xf_histogram_init(&s_hist);
+ * void foo(void)
+ * {
+ *     XF_HISTOGRAM_SCOPE(&s_hist);    // 记录本作用域的耗时（ns）
+ *     ...
+ * }
+ * xf_histogram_dump(&s_hist, TAG, "foo");
+ * @endcode
+ */
+
+#ifndef __XF_HISTOGRAM_H__
+#define __XF_HISTOGRAM_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_histogram_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_time/xf_time.h"
+#include "../xf_std/xf_stdint.h"
+#include "../xf_lock/xf_lock.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_histogram xf_histogram
+ * @brief 延时直方图, 百分位统计。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#define XF_HISTOGRAM_SUB_BUCKETS        (1U << XF_HISTOGRAM_SUB_BUCKET_BITS)
+
+/**
+ * @brief 桶的总数.
+ */
+#define XF_HISTOGRAM_BUCKETS \
+    ((XF_HISTOGRAM_MAX_VALUE_BITS - XF_HISTOGRAM_SUB_BUCKET_BITS + 1) * XF_HISTOGRAM_SUB_BUCKETS)
+
+/**
+ * @brief 目标是否支持无锁的 64 位原子读写.
+ *
+ * 为 0 时（32 位目标或编译器不支持原子操作）, 64 位的 load/store 可能撕裂或依赖 libatomic,
+ * 直方图改为在锁下读写.
+ */
+#if !defined(XF_HISTOGRAM_IS_LOCK_FREE)
+#   if XF_ATOMIC_IS_SUPPORTED && defined(__GCC_ATOMIC_LLONG_LOCK_FREE) \
+        && (__GCC_ATOMIC_LLONG_LOCK_FREE == 2)
+#       define XF_HISTOGRAM_IS_LOCK_FREE    (1)
+#   else
+#       define XF_HISTOGRAM_IS_LOCK_FREE    (0)
+#   endif
+#endif
+
+#if XF_HISTOGRAM_IS_LOCK_FREE
+#   define XF_HISTOGRAM_LOAD(hist, member, mo)  xf_atomic_load(&(hist)->member, (mo))
+#else
+#   define XF_HISTOGRAM_LOAD(hist, member, mo)  xf_histogram_load_locked((hist), &(hist)->member)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 直方图.
+ *
+ * @attention 使用前必须调用 xf_histogram_init() 初始化.
+ */
+typedef struct xf_histogram_s {
+    uint64_t                count;      /*!< 样本数 */
+    uint64_t                sum;        /*!< 样本和 */
+    uint64_t                min;        /*!< 最小值, 无样本时为 UINT64_MAX */
+    uint64_t                max;        /*!< 最大值 */
+    struct xf_histogram_s  *next;       /*!< 组内链表 */
+#if !XF_HISTOGRAM_IS_LOCK_FREE
+    xf_lock_t               lock;       /*!< 保护以上统计值和桶 */
+#endif
+    uint64_t                buckets[XF_HISTOGRAM_BUCKETS];
+} xf_histogram_t;
+
+/**
+ * @brief 直方图组, 用于汇总每个线程各自的直方图.
+ */
+typedef struct xf_histogram_group_s {
+    xf_histogram_t         *head;
+} xf_histogram_group_t;
+
+/**
+ * @brief 作用域计时状态, 见 XF_HISTOGRAM_SCOPE().
+ */
+typedef struct xf_histogram_scope_s {
+    xf_histogram_t         *hist;
+    uint64_t                start;
+} xf_histogram_scope_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化（清空）直方图.
+ *
+ * @attention XF_HISTOGRAM_IS_LOCK_FREE 为 0 时会创建锁, 禁止重复初始化,
+ *      不再使用时调用 xf_histogram_deinit().
+ *
+ * @param hist 直方图.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_FAIL               创建锁失败
+ */
+xf_err_t xf_histogram_init(xf_histogram_t *hist);
+
+/**
+ * @brief 反初始化直方图, 释放 xf_histogram_init() 创建的锁.
+ *
+ * @param hist 直方图, 不能在组中.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_histogram_deinit(xf_histogram_t *hist);
+
+/**
+ * @brief 清空直方图的样本, 不影响其所属的组.
+ *
+ * @note 应由写入该直方图的线程调用.
+ *
+ * @param hist 直方图.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_histogram_reset(xf_histogram_t *hist);
+
+/**
+ * @brief 将 src 的样本累加到 dst.
+ *
+ * src 可以正被其他线程写入, 结果为某一时刻附近的近似快照.
+ *
+ * @param dst 目标直方图, 只能由调用者写入.
+ * @param src 源直方图.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_histogram_merge(xf_histogram_t *dst, const xf_histogram_t *src);
+
+/**
+ * @brief 查询百分位数.
+ *
+ * @param hist 直方图.
+ * @param percentile 百分位, [0, 100], 如 99.9.
+ * @return uint64_t 不小于 percentile% 样本的值（所在桶的上界, 不超过最大值）.
+ *      无样本时返回 0.
+ */
+uint64_t xf_histogram_percentile(const xf_histogram_t *hist, double percentile);
+
+/**
+ * @brief 通过 XF_LOGI 输出样本数、最小值、平均值、p50/p90/p99/p999 和最大值.
+ *
+ * @param hist 直方图.
+ * @param tag 日志标签.
+ * @param name 直方图名称.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_histogram_dump(const xf_histogram_t *hist, const char *tag, const char *name);
+
+/**
+ * @brief 将直方图加入组. 组内直方图不能被移除, 生命周期需不短于组.
+ *
+ * 可在多个线程中并发调用.
+ *
+ * @param group 直方图组.
+ * @param hist 已初始化的直方图.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_histogram_group_add(xf_histogram_group_t *group, xf_histogram_t *hist);
+
+/**
+ * @brief 将组内所有直方图累加到 dst.
+ *
+ * @param group 直方图组.
+ * @param dst 目标直方图（不要放在 group 中）.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_histogram_group_merge(xf_histogram_group_t *group, xf_histogram_t *dst);
+
+/**
+ * @brief 计算 value 所在桶的下标.
+ *
+ * @param value 样本值.
+ * @return uint32_t 桶下标.
+ */
+static inline uint32_t xf_histogram_bucket_index(uint64_t value)
+{
+    if (value < XF_HISTOGRAM_SUB_BUCKETS) {
+        return (uint32_t)value;
+    }
+    uint32_t msb = 63U - (uint32_t)xf_bit_clzll(value);
+    if (msb >= XF_HISTOGRAM_MAX_VALUE_BITS) {
+        return XF_HISTOGRAM_BUCKETS - 1;
+    }
+    uint32_t shift = msb - XF_HISTOGRAM_SUB_BUCKET_BITS;
+    return (shift + 1) * XF_HISTOGRAM_SUB_BUCKETS
+           + (uint32_t)(value >> shift) - XF_HISTOGRAM_SUB_BUCKETS;
+}
+
+/**
+ * @brief 记录一个样本, 允许多个线程并发写同一直方图.
+ *
+ * @param hist 直方图.
+ * @param value 样本值.
+ */
+void xf_histogram_record_atomic(xf_histogram_t *hist, uint64_t value);
+
+/**
+ * @brief 记录一个样本. 同一直方图只允许一个线程调用.
+ *
+ * @param hist 直方图.
+ * @param value 样本值.
+ */
+static inline void xf_histogram_record(xf_histogram_t *hist, uint64_t value)
+{
+#if XF_HISTOGRAM_IS_LOCK_FREE
+    /* 单写者: 普通的读-改-写, 但读写本身是原子的, 以免读者看到撕裂的值 */
+    uint64_t *p_bucket = &hist->buckets[xf_histogram_bucket_index(value)];
+    xf_atomic_store(p_bucket, xf_atomic_load(p_bucket, XF_ATOMIC_RELAXED) + 1, XF_ATOMIC_RELAXED);
+    xf_atomic_store(&hist->sum, xf_atomic_load(&hist->sum, XF_ATOMIC_RELAXED) + value, XF_ATOMIC_RELAXED);
+    if (unlikely(value < xf_atomic_load(&hist->min, XF_ATOMIC_RELAXED))) {
+        xf_atomic_store(&hist->min, value, XF_ATOMIC_RELAXED);
+    }
+    if (unlikely(value > xf_atomic_load(&hist->max, XF_ATOMIC_RELAXED))) {
+        xf_atomic_store(&hist->max, value, XF_ATOMIC_RELAXED);
+    }
+    xf_atomic_store(&hist->count, xf_atomic_load(&hist->count, XF_ATOMIC_RELAXED) + 1, XF_ATOMIC_RELEASE);
+#else
+    xf_histogram_record_atomic(hist, value);
+#endif
+}
+
+#if !XF_HISTOGRAM_IS_LOCK_FREE
+/**
+ * @brief 在直方图的锁下读取 64 位统计值, 供 XF_HISTOGRAM_LOAD() 使用.
+ */
+uint64_t xf_histogram_load_locked(const xf_histogram_t *hist, const uint64_t *p);
+#endif
+
+/**
+ * @brief 获取样本数.
+ */
+static inline uint64_t xf_histogram_get_count(const xf_histogram_t *hist)
+{
+    return XF_HISTOGRAM_LOAD(hist, count, XF_ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief 获取最小值, 无样本时返回 0.
+ */
+static inline uint64_t xf_histogram_get_min(const xf_histogram_t *hist)
+{
+    return xf_histogram_get_count(hist) ? XF_HISTOGRAM_LOAD(hist, min, XF_ATOMIC_RELAXED) : 0;
+}
+
+/**
+ * @brief 获取最大值.
+ */
+static inline uint64_t xf_histogram_get_max(const xf_histogram_t *hist)
+{
+    return XF_HISTOGRAM_LOAD(hist, max, XF_ATOMIC_RELAXED);
+}
+
+/**
+ * @brief 获取平均值（向下取整）, 无样本时返回 0.
+ */
+static inline uint64_t xf_histogram_get_mean(const xf_histogram_t *hist)
+{
+    uint64_t count = xf_histogram_get_count(hist);
+    return count ? XF_HISTOGRAM_LOAD(hist, sum, XF_ATOMIC_RELAXED) / count : 0;
+}
+
+/**
+ * @brief 开始作用域计时.
+ */
+static inline xf_histogram_scope_t xf_histogram_scope_begin(xf_histogram_t *hist)
+{
+    xf_histogram_scope_t scope = { hist, xf_time_get_ns() };
+    return scope;
+}
+
+/**
+ * @brief 结束作用域计时并记录耗时（ns）.
+ */
+static inline void xf_histogram_scope_end(xf_histogram_scope_t *scope)
+{
+    xf_histogram_record(scope->hist, xf_time_get_ns() - scope->start);
+}
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 手动标记计时区间, 适用于不支持 cleanup 属性的编译器或非作用域区间.
+ *
+ * @param name 计时变量名.
+ * @param hist 直方图指针.
+ */
+#define XF_HISTOGRAM_SCOPE_BEGIN(name, hist) \
+    xf_histogram_scope_t name = xf_histogram_scope_begin(hist)
+#define XF_HISTOGRAM_SCOPE_END(name)        xf_histogram_scope_end(&(name))
+
+#if defined(__GNUC__)
+/**
+ * @brief 记录从此处到所在作用域结束的耗时（ns）.
+ *
+ * 基于 GNU cleanup 属性, return/break 等方式离开作用域时同样会记录.
+ * 同一作用域只能使用一次.
+ *
+ * @param hist 直方图指针.
+ */
+#   define XF_HISTOGRAM_SCOPE(hist) \
+    xf_histogram_scope_t XCONCAT(_xf_hist_scope_, __LINE__) \
+        __attribute__((cleanup(xf_histogram_scope_end))) = xf_histogram_scope_begin(hist)
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_histogram
+ * @}
+ */
+
+#endif /* __XF_HISTOGRAM_H__ */
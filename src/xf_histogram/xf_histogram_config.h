@@ -0,0 +1,59 @@
+/**
+ * @file xf_histogram_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_histogram 配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_HISTOGRAM_CONFIG_H__
+#define __XF_HISTOGRAM_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 每个 2 的幂区间内线性子桶数的位数。
+ *
+ * 相对误差不超过 1 / 2^SUB_BUCKET_BITS, 默认 4 即 6.25%.
+ */
+#if !defined(XF_HISTOGRAM_SUB_BUCKET_BITS)
+#   define XF_HISTOGRAM_SUB_BUCKET_BITS (4)
+#endif
+
+/**
+ * @brief 可区分的最大值的位数, 不小于 2^MAX_VALUE_BITS 的值计入最后一个桶。
+ *
+ * 默认 40, 以 ns 为单位时约 18 分钟。
+ */
+#if !defined(XF_HISTOGRAM_MAX_VALUE_BITS)
+#   define XF_HISTOGRAM_MAX_VALUE_BITS  (40)
+#endif
+
+#if (XF_HISTOGRAM_SUB_BUCKET_BITS < 1) \
+        || (XF_HISTOGRAM_MAX_VALUE_BITS <= XF_HISTOGRAM_SUB_BUCKET_BITS) \
+        || (XF_HISTOGRAM_MAX_VALUE_BITS > 64)
+#   error "xf_histogram: require 1 <= SUB_BUCKET_BITS < MAX_VALUE_BITS <= 64"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_HISTOGRAM_CONFIG_H__
@@ -93,5 +93,48 @@ int xf_lock_unlock(xf_lock_t lock)
     return sp_ops->unlock(lock);
 }
 
+xf_err_t xf_cond_init(xf_cond_t *p_cond)
+{
+    if ((NULL == sp_ops) || (NULL == p_cond)) {
+        return XF_FAIL;
+    }
+    if (NULL == sp_ops->cond_init) {
+        return XF_ERR_NOT_SUPPORTED;
+    }
+    return sp_ops->cond_init(p_cond);
+}
+
+xf_err_t xf_cond_destroy(xf_cond_t cond)
+{
+    if ((NULL == sp_ops) || (NULL == sp_ops->cond_destroy)) {
+        return XF_FAIL;
+    }
+    return sp_ops->cond_destroy(cond);
+}
+
+int xf_cond_wait(xf_cond_t cond, xf_lock_t lock, uint32_t timeout_ms)
+{
+    if ((NULL == sp_ops) || (NULL == sp_ops->cond_wait)) {
+        return XF_LOCK_FAIL;
+    }
+    return sp_ops->cond_wait(cond, lock, timeout_ms);
+}
+
+int xf_cond_signal(xf_cond_t cond)
+{
+    if ((NULL == sp_ops) || (NULL == sp_ops->cond_signal)) {
+        return XF_LOCK_FAIL;
+    }
+    return sp_ops->cond_signal(cond);
+}
+
+int xf_cond_broadcast(xf_cond_t cond)
+{
+    if ((NULL == sp_ops) || (NULL == sp_ops->cond_broadcast)) {
+        return XF_LOCK_FAIL;
+    }
+    return sp_ops->cond_broadcast(cond);
+}
+
 /* ==================== [Static Functions] ================================== */
 
@@ -117,6 +117,61 @@ int xf_lock_timedlock(xf_lock_t lock, uint32_t timeout_ms);
  */
 int xf_lock_unlock(xf_lock_t lock);
 
+/**
+ * @brief 初始化条件变量.
+ *
+ * @param[out] p_cond 获取并初始化一个条件变量.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NOT_SUPPORTED  对接的锁没有实现条件变量
+ *      - XF_FAIL               失败
+ */
+xf_err_t xf_cond_init(xf_cond_t *p_cond);
+
+/**
+ * @brief 销毁条件变量.
+ *
+ * @param cond 需要销毁的条件变量句柄.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               失败
+ */
+xf_err_t xf_cond_destroy(xf_cond_t cond);
+
+/**
+ * @brief 原子地释放 lock 并等待 cond 被唤醒或超时, 返回前重新持有 lock.
+ *
+ * @attention 可能虚假唤醒, 需要在循环中重新检查条件.
+ *
+ * @param cond 条件变量句柄.
+ * @param lock 调用者持有的锁句柄.
+ * @param timeout_ms 超时时间, 单位 ms. 如果填入 `(uint32_t)(~0)`, 则一直等待.
+ * @return int
+ *      - XF_LOCK_FAIL          超时或失败
+ *      - XF_LOCK_SUCC          被唤醒
+ */
+int xf_cond_wait(xf_cond_t cond, xf_lock_t lock, uint32_t timeout_ms);
+
+/**
+ * @brief 唤醒至少一个等待者.
+ *
+ * @param cond 条件变量句柄.
+ * @return int
+ *      - XF_LOCK_FAIL          失败
+ *      - XF_LOCK_SUCC          成功
+ */
+int xf_cond_signal(xf_cond_t cond);
+
+/**
+ * @brief 唤醒所有等待者.
+ *
+ * @param cond 条件变量句柄.
+ * @return int
+ *      - XF_LOCK_FAIL          失败
+ *      - XF_LOCK_SUCC          成功
+ */
+int xf_cond_broadcast(xf_cond_t cond);
+
 /* ==================== [Macros] ============================================ */
 
 #ifdef __cplusplus
@@ -39,6 +39,11 @@ extern "C" {
  */
 typedef void *xf_lock_t;
 
+/**
+ * @brief 条件变量句柄. 与 xf_lock_t 配合使用, 对接方式相同.
+ */
+typedef void *xf_cond_t;
+
 /**
  * End of group_xf_utils_lock
  * @}
@@ -132,6 +137,62 @@ typedef int (*xf_lock_ops_timedlock_t)(xf_lock_t lock, uint32_t timeout_ms);
  */
 typedef int (*xf_lock_ops_unlock_t)(xf_lock_t lock);
 
+/**
+ * @brief 初始化条件变量. 可选.
+ *
+ * @param[out] p_cond 指向需要初始化的条件变量句柄的指针.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               失败
+ */
+typedef xf_err_t (*xf_lock_ops_cond_init_t)(xf_cond_t *p_cond);
+
+/**
+ * @brief 销毁条件变量. 可选.
+ *
+ * @param cond 需要销毁的条件变量句柄.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               失败
+ */
+typedef xf_err_t (*xf_lock_ops_cond_destroy_t)(xf_cond_t cond);
+
+/**
+ * @brief 原子地释放 lock 并等待 cond 被唤醒或超时, 返回前重新持有 lock. 可选.
+ *
+ * 允许虚假唤醒, 调用者需要在循环中重新检查条件.
+ *
+ * @param cond 条件变量句柄.
+ * @param lock 调用者持有的锁句柄.
+ * @param timeout_ms 超时时间, 单位 ms. 如果填入 `(uint32_t)(~0)`, 则一直等待.
+ * @return int
+ *      - XF_LOCK_FAIL          超时或失败
+ *      - XF_LOCK_SUCC          被唤醒
+ *
+ * @note 返回值等同 bool, 只有成功和失败两种可能性.
+ */
+typedef int (*xf_lock_ops_cond_wait_t)(xf_cond_t cond, xf_lock_t lock, uint32_t timeout_ms);
+
+/**
+ * @brief 唤醒至少一个等待者. 可选.
+ *
+ * @param cond 条件变量句柄.
+ * @return int
+ *      - XF_LOCK_FAIL          失败
+ *      - XF_LOCK_SUCC          成功
+ */
+typedef int (*xf_lock_ops_cond_signal_t)(xf_cond_t cond);
+
+/**
+ * @brief 唤醒所有等待者. 可选.
+ *
+ * @param cond 条件变量句柄.
+ * @return int
+ *      - XF_LOCK_FAIL          失败
+ *      - XF_LOCK_SUCC          成功
+ */
+typedef int (*xf_lock_ops_cond_broadcast_t)(xf_cond_t cond);
+
 /**
  * @brief 锁操作结构体.
  *
@@ -140,6 +201,8 @@ typedef int (*xf_lock_ops_unlock_t)(xf_lock_t lock);
  * 2. `trylock`;
  * 3. `unlock`.
  * @attention 如未完全实现, 请用 `#pragma message("...")` 等方式明显地通知用户.
+ * @note `cond_*` 为可选的条件变量操作, 需要阻塞等待的模块（如 xf_clist）才会用到.
+ *       要么全部实现, 要么全部为 NULL.
  */
 typedef struct xf_lock_ops_s {
     xf_lock_ops_init_t      init;
@@ -148,6 +211,12 @@ typedef struct xf_lock_ops_s {
     xf_lock_ops_lock_t      lock;
     xf_lock_ops_timedlock_t timedlock;
     xf_lock_ops_unlock_t    unlock;
+
+    xf_lock_ops_cond_init_t         cond_init;
+    xf_lock_ops_cond_destroy_t      cond_destroy;
+    xf_lock_ops_cond_wait_t         cond_wait;
+    xf_lock_ops_cond_signal_t       cond_signal;
+    xf_lock_ops_cond_broadcast_t    cond_broadcast;
 } xf_lock_ops_t;
 
 /**
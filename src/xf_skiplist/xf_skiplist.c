@@ -0,0 +1,255 @@
+/**
+ * @file xf_skiplist.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 侵入式跳表, 读者无锁。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_skiplist.h"
+
+/* ==================== [Defines] =========================================== */
+
+/*
+ * 写者发布指针用 release, 读者读取指针用 acquire,
+ * 保证读者通过指针看到的节点内容（键和该节点自己的指针）已经写好.
+ */
+#define LOAD_PTR(p)                     xf_atomic_load((p), XF_ATOMIC_ACQUIRE)
+#define PUBLISH_PTR(p, v)               xf_atomic_store((p), (v), XF_ATOMIC_RELEASE)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_skiplist_node_t *_descend(
+    const xf_skiplist_t *sl, const void *key, xf_skiplist_node_t **preds, bool after_equal);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#define _LOCK(sl) \
+    do { if ((sl)->use_lock) { xf_lock_lock((sl)->lock); } } while (0)
+#define _UNLOCK(sl) \
+    do { if ((sl)->use_lock) { xf_lock_unlock((sl)->lock); } } while (0)
+
+/**
+ * @brief 第 i 层（i >= 1）中 pred 之后的指针所在位置, pred 为 NULL 表示头节点.
+ */
+#define _SLOT(sl, pred, i) \
+    ((NULL == (pred)) ? (xf_skiplist_node_t **)&(sl)->head_next[(i) - 1] : &(pred)->next[(i) - 1])
+
+#define _ENTRY(ptr)                     xf_container_of(ptr, xf_skiplist_node_t, list)
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_skiplist_init(xf_skiplist_t *sl, xf_skiplist_cmp_t cmp, bool thread_safe)
+{
+    if ((NULL == sl) || (NULL == cmp)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_list_init(&sl->head);
+    for (uint32_t i = 0; i < XF_SKIPLIST_MAX_LEVEL - 1; i++) {
+        sl->head_next[i] = NULL;
+    }
+    sl->level = 1;
+    sl->seed = 0x9e3779b9u;
+    sl->len = 0;
+    sl->cmp = cmp;
+    sl->use_lock = thread_safe;
+    sl->lock = NULL;
+    if (thread_safe) {
+        if (XF_OK != xf_lock_init(&sl->lock)) {
+            return XF_FAIL;
+        }
+    }
+    return XF_OK;
+}
+
+void xf_skiplist_deinit(xf_skiplist_t *sl)
+{
+    if (NULL == sl) {
+        return;
+    }
+    if (sl->use_lock) {
+        xf_lock_destroy(sl->lock);
+        sl->lock = NULL;
+        sl->use_lock = false;
+    }
+    xf_list_init(&sl->head);
+    for (uint32_t i = 0; i < XF_SKIPLIST_MAX_LEVEL - 1; i++) {
+        sl->head_next[i] = NULL;
+    }
+    sl->level = 1;
+    sl->len = 0;
+}
+
+uint32_t xf_skiplist_random_level(xf_skiplist_t *sl)
+{
+    if (NULL == sl) {
+        return 1;
+    }
+    /* xorshift32. 多个线程同时调用时可能得到相同的值, 不影响正确性 */
+    uint32_t x = xf_atomic_load(&sl->seed, XF_ATOMIC_RELAXED);
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    xf_atomic_store(&sl->seed, x, XF_ATOMIC_RELAXED);
+
+    /* 每两个为 0 的低位升一层 */
+    uint32_t level = 1 + (uint32_t)xf_bit_ctzll(x) / 2;
+    return (level < XF_SKIPLIST_MAX_LEVEL) ? level : XF_SKIPLIST_MAX_LEVEL;
+}
+
+xf_err_t xf_skiplist_insert(xf_skiplist_t *sl, xf_skiplist_node_t *node, const void *key)
+{
+    if ((NULL == sl) || (NULL == node)
+            || (node->level < 1) || (node->level > XF_SKIPLIST_MAX_LEVEL)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_skiplist_node_t *preds[XF_SKIPLIST_MAX_LEVEL];
+    uint32_t level = node->level;
+
+    _LOCK(sl);
+    uint32_t top = sl->level;
+    xf_skiplist_node_t *pred = _descend(sl, key, preds, true);
+    for (uint32_t i = top; i < level; i++) {
+        preds[i] = NULL;
+    }
+
+    xf_list_t *prev = (NULL == pred) ? &sl->head : &pred->list;
+    while ((prev->next != &sl->head) && (sl->cmp(_ENTRY(prev->next), key) <= 0)) {
+        prev = prev->next;
+    }
+
+    /* 先填好新节点自己的指针, 此时读者还看不到它 */
+    node->list.next = prev->next;
+    node->list.prev = prev;
+    for (uint32_t i = 1; i < level; i++) {
+        node->next[i - 1] = *_SLOT(sl, preds[i], i);
+    }
+
+    /* 自下而上发布: 读者从高层到达节点时, 它的低层指针都已可见 */
+    prev->next->prev = &node->list;
+    PUBLISH_PTR(&prev->next, &node->list);
+    for (uint32_t i = 1; i < level; i++) {
+        PUBLISH_PTR(_SLOT(sl, preds[i], i), node);
+    }
+    if (level > top) {
+        PUBLISH_PTR(&sl->level, level);
+    }
+    xf_atomic_store(&sl->len, sl->len + 1, XF_ATOMIC_RELAXED);
+    _UNLOCK(sl);
+    return XF_OK;
+}
+
+xf_err_t xf_skiplist_remove(xf_skiplist_t *sl, xf_skiplist_node_t *node, const void *key)
+{
+    if ((NULL == sl) || (NULL == node)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_skiplist_node_t *preds[XF_SKIPLIST_MAX_LEVEL];
+    uint32_t level = node->level;
+
+    _LOCK(sl);
+    if ((NULL == node->list.prev) || (level > sl->level)) {
+        _UNLOCK(sl);
+        return XF_ERR_NOT_FOUND;
+    }
+    _descend(sl, key, preds, false);
+
+    /* preds[i] 是键小于 key 的最后一个节点, 之后越过相等的键才能找到 node 本身 */
+    for (uint32_t i = level - 1; i >= 1; i--) {
+        xf_skiplist_node_t *pred = preds[i];
+        xf_skiplist_node_t *next;
+        while ((next = *_SLOT(sl, pred, i)) != node) {
+            if ((NULL == next) || (sl->cmp(next, key) > 0)) {
+                _UNLOCK(sl);
+                return XF_ERR_NOT_FOUND;
+            }
+            pred = next;
+        }
+        preds[i] = pred;
+    }
+
+    /* 自上而下摘除, node 自己的指针保持不变 */
+    for (uint32_t i = level - 1; i >= 1; i--) {
+        PUBLISH_PTR(_SLOT(sl, preds[i], i), node->next[i - 1]);
+    }
+    xf_list_t *prev = node->list.prev;
+    xf_list_t *next = node->list.next;
+    next->prev = prev;
+    PUBLISH_PTR(&prev->next, next);
+    node->list.prev = NULL;
+    xf_atomic_store(&sl->len, sl->len - 1, XF_ATOMIC_RELAXED);
+    _UNLOCK(sl);
+    return XF_OK;
+}
+
+xf_skiplist_node_t *xf_skiplist_lower_bound(const xf_skiplist_t *sl, const void *key)
+{
+    if (NULL == sl) {
+        return NULL;
+    }
+    xf_skiplist_node_t *pred = _descend(sl, key, NULL, false);
+    const xf_list_t *pos = (NULL == pred) ? &sl->head : &pred->list;
+
+    for (;;) {
+        xf_list_t *next = LOAD_PTR(&pos->next);
+        if (next == &sl->head) {
+            return NULL;
+        }
+        if (sl->cmp(_ENTRY(next), key) >= 0) {
+            return _ENTRY(next);
+        }
+        pos = next;
+    }
+}
+
+xf_skiplist_node_t *xf_skiplist_find(const xf_skiplist_t *sl, const void *key)
+{
+    xf_skiplist_node_t *node = xf_skiplist_lower_bound(sl, key);
+    if ((NULL == node) || (0 != sl->cmp(node, key))) {
+        return NULL;
+    }
+    return node;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 从最高层逐层向下查找, 返回第 1 层的前驱（NULL 表示头节点）.
+ *
+ * @param preds 非 NULL 时记录第 1 ~ level - 1 层的前驱.
+ * @param after_equal 为 true 时越过键相等的节点（插入位置）,
+ *      否则停在第一个不小于 key 的节点之前.
+ */
+static xf_skiplist_node_t *_descend(
+    const xf_skiplist_t *sl, const void *key, xf_skiplist_node_t **preds, bool after_equal)
+{
+    xf_skiplist_node_t *pred = NULL;
+    uint32_t top = LOAD_PTR(&sl->level);
+
+    for (uint32_t i = top - 1; i >= 1; i--) {
+        for (;;) {
+            xf_skiplist_node_t *next = LOAD_PTR(_SLOT(sl, pred, i));
+            if (NULL == next) {
+                break;
+            }
+            int c = sl->cmp(next, key);
+            if ((c > 0) || ((0 == c) && !after_equal)) {
+                break;
+            }
+            pred = next;
+        }
+        if (NULL != preds) {
+            preds[i] = pred;
+        }
+    }
+    return pred;
+}
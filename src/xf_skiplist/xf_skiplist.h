@@ -0,0 +1,248 @@
+/**
+ * @file xf_skiplist.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 侵入式跳表, 读者无锁。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 有序、允许重复键（相等的键按插入顺序排列）. 查找、插入、删除均为期望 O(log n).
+ *
+ * - 第 0 层就是一个 xf_list_t 双向循环链表, 头节点为 xf_skiplist_t::head,
+ *   按顺序遍历与普通 xf_list 相同;
+ * - 第 1 层及以上为单向链表, 节点的层数在分配时确定, 上层指针以柔性数组放在节点末尾,
+ *   因此节点必须是用户结构体的最后一个成员;
+ * - 写者（插入、删除）之间通过 xf_lock 互斥; 读者（查找、遍历）不加锁:
+ *   写者先填好新节点的指针再自下而上发布, 删除时自上而下摘除且保留被删节点的指针,
+ *   读者任何时刻看到的都是一个有序的链表.
+ *
+ * 有并发读者时, 删除的节点要等读者离开后才能释放, 可以配合 xf_epoch 使用:
+ * 读者在 xf_epoch_enter() / xf_epoch_exit() 之间访问跳表,
+ * 写者删除后通过 xf_epoch_retire() 延迟释放.
+ *
+ * @code{.c}
+ * typedef struct {
+ *     uint32_t            key;
+ *     xf_epoch_entry_t    retire;
+ *     xf_skiplist_node_t  node;        // 必须是最后一个成员
+ * } item_t;
+ *
+ * uint32_t level = xf_skiplist_random_level(&sl);
+ * item_t *item = malloc(sizeof(item_t) + XF_SKIPLIST_NODE_EXTRA_SIZE(level));
+ * item->key = 42;
+ * xf_skiplist_node_init(&item->node, level);
+ * xf_skiplist_insert(&sl, &item->node, &item->key);
+ * @endcode
+ */
+
+#ifndef __XF_SKIPLIST_H__
+#define __XF_SKIPLIST_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_skiplist_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_lock/xf_lock.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_skiplist xf_skiplist
+ * @brief 侵入式跳表, 读者无锁。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief level 层的节点在 sizeof(用户结构体) 之外需要额外分配的字节数.
+ */
+#define XF_SKIPLIST_NODE_EXTRA_SIZE(level) \
+    (((size_t)(level) - 1) * sizeof(xf_skiplist_node_t *))
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 跳表节点.
+ */
+typedef struct xf_skiplist_node_s {
+    xf_list_t                   list;   /*!< 第 0 层 */
+    uint32_t                    level;  /*!< 层数, 1 ~ XF_SKIPLIST_MAX_LEVEL */
+    struct xf_skiplist_node_s  *next[]; /*!< 第 1 ~ level - 1 层的后继, 末尾为 NULL */
+} xf_skiplist_node_t;
+
+/**
+ * @brief 比较节点的键与 key.
+ *
+ * @return int 节点的键小于、等于、大于 key 时分别返回负数、0、正数.
+ */
+typedef int (*xf_skiplist_cmp_t)(const xf_skiplist_node_t *node, const void *key);
+
+/**
+ * @brief 跳表.
+ */
+typedef struct xf_skiplist_s {
+    xf_list_t           head;           /*!< 第 0 层头节点 */
+    xf_skiplist_node_t *head_next[XF_SKIPLIST_MAX_LEVEL - 1]; /*!< 第 1 层及以上的头指针 */
+    uint32_t            level;          /*!< 当前使用的层数 */
+    uint32_t            seed;           /*!< 随机层数的状态 */
+    size_t              len;            /*!< 节点数 */
+    xf_skiplist_cmp_t   cmp;            /*!< 比较函数 */
+    bool                use_lock;       /*!< 是否使用 lock */
+    xf_lock_t           lock;           /*!< 写者之间互斥 */
+} xf_skiplist_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化跳表.
+ *
+ * @param sl 跳表.
+ * @param cmp 比较函数.
+ * @param thread_safe 是否通过 xf_lock 使写者互斥. 有多个写者时必须为 true,
+ *      需要已通过 xf_lock_register() 对接锁; 只有一个写者时可以为 false.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_FAIL               创建锁失败
+ */
+xf_err_t xf_skiplist_init(xf_skiplist_t *sl, xf_skiplist_cmp_t cmp, bool thread_safe);
+
+/**
+ * @brief 销毁跳表. 不释放节点.
+ *
+ * @param sl 跳表.
+ */
+void xf_skiplist_deinit(xf_skiplist_t *sl);
+
+/**
+ * @brief 为新节点生成随机层数, 第 k 层的概率为 (1/4)^(k-1) * 3/4.
+ *
+ * @param sl 跳表.
+ * @return uint32_t 层数, 1 ~ XF_SKIPLIST_MAX_LEVEL.
+ */
+uint32_t xf_skiplist_random_level(xf_skiplist_t *sl);
+
+/**
+ * @brief 插入节点. 键与已有节点相等时插在它们之后.
+ *
+ * @param sl 跳表.
+ * @param node 已通过 xf_skiplist_node_init() 初始化的节点.
+ * @param key 节点的键, 传给比较函数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_skiplist_insert(xf_skiplist_t *sl, xf_skiplist_node_t *node, const void *key);
+
+/**
+ * @brief 删除节点. 节点的指针保持不变, 正在访问它的读者可以继续向后遍历.
+ *
+ * @param sl 跳表.
+ * @param node 节点.
+ * @param key 节点的键, 用于定位各层的前驱.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_FOUND      节点不在跳表中
+ */
+xf_err_t xf_skiplist_remove(xf_skiplist_t *sl, xf_skiplist_node_t *node, const void *key);
+
+/**
+ * @brief 查找第一个键不小于 key 的节点. 不加锁.
+ *
+ * @param sl 跳表.
+ * @param key 键.
+ * @return xf_skiplist_node_t* 节点, 不存在时返回 NULL.
+ */
+xf_skiplist_node_t *xf_skiplist_lower_bound(const xf_skiplist_t *sl, const void *key);
+
+/**
+ * @brief 查找第一个键等于 key 的节点. 不加锁.
+ *
+ * @param sl 跳表.
+ * @param key 键.
+ * @return xf_skiplist_node_t* 节点, 不存在时返回 NULL.
+ */
+xf_skiplist_node_t *xf_skiplist_find(const xf_skiplist_t *sl, const void *key);
+
+/**
+ * @brief 初始化节点.
+ *
+ * @param node 节点, 至少分配了 XF_SKIPLIST_NODE_EXTRA_SIZE(level) 的额外空间.
+ * @param level 层数, 通常由 xf_skiplist_random_level() 生成.
+ */
+static inline void xf_skiplist_node_init(xf_skiplist_node_t *node, uint32_t level)
+{
+    node->list.next = NULL;
+    node->list.prev = NULL;
+    node->level = level;
+}
+
+/**
+ * @brief 第一个节点. 不加锁.
+ *
+ * @return xf_skiplist_node_t* 节点, 跳表为空时返回 NULL.
+ */
+static inline xf_skiplist_node_t *xf_skiplist_first(const xf_skiplist_t *sl)
+{
+    xf_list_t *next = xf_atomic_load(&sl->head.next, XF_ATOMIC_ACQUIRE);
+    return (next == &sl->head) ? NULL : xf_container_of(next, xf_skiplist_node_t, list);
+}
+
+/**
+ * @brief 下一个节点. 不加锁, node 可以是刚被删除的节点.
+ *
+ * @return xf_skiplist_node_t* 节点, 已到末尾时返回 NULL.
+ */
+static inline xf_skiplist_node_t *xf_skiplist_next(
+    const xf_skiplist_t *sl, const xf_skiplist_node_t *node)
+{
+    xf_list_t *next = xf_atomic_load(&node->list.next, XF_ATOMIC_ACQUIRE);
+    return (next == &sl->head) ? NULL : xf_container_of(next, xf_skiplist_node_t, list);
+}
+
+/**
+ * @brief 节点数.
+ */
+static inline size_t xf_skiplist_len(const xf_skiplist_t *sl)
+{
+    return xf_atomic_load(&sl->len, XF_ATOMIC_RELAXED);
+}
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 按顺序遍历. 不加锁, 遍历期间其他线程可以插入、删除.
+ *
+ * @param pos 用作循环游标的用户结构体指针.
+ * @param sl 跳表.
+ * @param type 用户结构体类型.
+ * @param member 节点在结构体中的成员名.
+ */
+#define xf_skiplist_for_each_entry(pos, sl, type, member) \
+    for (xf_skiplist_node_t *__xf_sl_node = xf_skiplist_first(sl); \
+         (NULL != __xf_sl_node) && (((pos) = xf_container_of(__xf_sl_node, type, member)), 1); \
+         __xf_sl_node = xf_skiplist_next((sl), __xf_sl_node))
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_skiplist
+ * @}
+ */
+
+#endif // __XF_SKIPLIST_H__
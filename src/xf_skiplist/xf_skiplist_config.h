@@ -0,0 +1,46 @@
+/**
+ * @file xf_skiplist_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 侵入式跳表配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_SKIPLIST_CONFIG_H__
+#define __XF_SKIPLIST_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 最大层数. 每层节点数约为下一层的 1/4, 16 层足够容纳 4^16 个节点.
+ */
+#if !defined(XF_SKIPLIST_MAX_LEVEL)
+#   define XF_SKIPLIST_MAX_LEVEL        (16)
+#endif
+
+#if (XF_SKIPLIST_MAX_LEVEL < 2) || (XF_SKIPLIST_MAX_LEVEL > 16)
+#   error "xf_skiplist: XF_SKIPLIST_MAX_LEVEL must be in [2, 16]"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_SKIPLIST_CONFIG_H__
@@ -77,6 +77,45 @@ extern "C" {
 #   define XF_STRING_IS_ENABLE     (0)
 #endif
 
+/**
+ * @brief 是否使用内置的 xf_memcpy/xf_memset/xf_memcmp/xf_strlen 实现（按字及 SIMD 处理）,
+ *        适用于 C 库只提供逐字节实现的平台, 默认关闭（使用 C 库）.
+ */
+#if defined(XF_STRING_BUILTIN_ENABLE) && (XF_STRING_BUILTIN_ENABLE)
+#   define XF_STRING_BUILTIN_IS_ENABLE          (1)
+#else
+#   define XF_STRING_BUILTIN_IS_ENABLE          (0)
+#endif
+
+/**
+ * @brief 内置实现是否使用 SIMD（x86 SSE2, AArch64 NEON）, 其余平台按机器字处理.
+ */
+#if !defined(XF_STRING_BUILTIN_SIMD_ENABLE) || (XF_STRING_BUILTIN_SIMD_ENABLE)
+#   define XF_STRING_BUILTIN_SIMD_IS_ENABLE     (1)
+#else
+#   define XF_STRING_BUILTIN_SIMD_IS_ENABLE     (0)
+#endif
+
+#if XF_STRING_BUILTIN_IS_ENABLE
+
+#ifndef xf_user_memcpy
+#   define xf_user_memcpy(dest, src, n)   xf_builtin_memcpy(dest, src, n)
+#endif
+
+#ifndef xf_user_memcmp
+#   define xf_user_memcmp(dest, src, n)   xf_builtin_memcmp(dest, src, n)
+#endif
+
+#ifndef xf_user_memset
+#   define xf_user_memset(ptr, value, size) xf_builtin_memset((ptr), (value), (size))
+#endif
+
+#ifndef xf_user_strlen
+#   define xf_user_strlen(str)   xf_builtin_strlen(str)
+#endif
+
+#endif /* XF_STRING_BUILTIN_IS_ENABLE */
+
 #ifndef xf_user_memcpy
 #   define xf_user_memcpy(dest, src, n)   memcpy(dest, src, n)
 #endif
@@ -118,6 +157,45 @@ extern "C" {
 #   define XF_STDIO_IS_ENABLE     (0)
 #endif
 
+/**
+ * @brief 是否使用内置的格式化函数（xf_builtin_vsnprintf）实现 xf_sprintf/xf_snprintf 等,
+ *        可重入、不分配内存、不加锁, 默认关闭（使用 C 库）.
+ */
+#if defined(XF_STDIO_BUILTIN_PRINTF_ENABLE) && (XF_STDIO_BUILTIN_PRINTF_ENABLE)
+#   define XF_STDIO_BUILTIN_PRINTF_IS_ENABLE        (1)
+#else
+#   define XF_STDIO_BUILTIN_PRINTF_IS_ENABLE        (0)
+#endif
+
+/**
+ * @brief 内置格式化函数是否支持浮点（%f %e %g）, 关闭时浮点参数输出为 "?".
+ */
+#if !defined(XF_STDIO_BUILTIN_PRINTF_FLOAT_ENABLE) || (XF_STDIO_BUILTIN_PRINTF_FLOAT_ENABLE)
+#   define XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE  (1)
+#else
+#   define XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE  (0)
+#endif
+
+#if XF_STDIO_BUILTIN_PRINTF_IS_ENABLE
+
+#ifndef xf_user_sprintf
+#   define xf_user_sprintf(dest, format, ...)  xf_builtin_snprintf(dest, (size_t)-1, format, ##__VA_ARGS__)
+#endif
+
+#ifndef xf_user_snprintf
+#   define xf_user_snprintf(dest, size, format, ...)    xf_builtin_snprintf(dest, size, format, ##__VA_ARGS__)
+#endif
+
+#ifndef xf_user_vsprintf
+#   define xf_user_vsprintf(dest, format, ap)           xf_builtin_vsnprintf(dest, (size_t)-1, format, ap)
+#endif
+
+#ifndef xf_user_vsnprintf
+#   define xf_user_vsnprintf(dest, size, format, ap)    xf_builtin_vsnprintf(dest, size, format, ap)
+#endif
+
+#endif /* XF_STDIO_BUILTIN_PRINTF_IS_ENABLE */
+
 #ifndef xf_user_sprintf
 #   define xf_user_sprintf(dest, format, ...)  sprintf(dest, format, ##__VA_ARGS__)
 #endif
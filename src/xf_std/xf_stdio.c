@@ -0,0 +1,1040 @@
+/**
+ * @file xf_stdio.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 内置的格式化输出.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_stdio.h"
+
+#if XF_STDIO_BUILTIN_PRINTF_IS_ENABLE
+
+#include "xf_stdint.h"
+#include "xf_stdbool.h"
+#include "xf_string.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define FLAG_LEFT                       (1u << 0)   /*!< '-' */
+#define FLAG_PLUS                       (1u << 1)   /*!< '+' */
+#define FLAG_SPACE                      (1u << 2)   /*!< ' ' */
+#define FLAG_ALT                        (1u << 3)   /*!< '#' */
+#define FLAG_ZERO                       (1u << 4)   /*!< '0' */
+#define FLAG_UPPER                      (1u << 5)   /*!< 大写十六进制/指数 */
+#define FLAG_PREC                       (1u << 6)   /*!< 指定了精度 */
+
+/* 64 位整数最多 22 位八进制数字 */
+#define INT_BUF_SIZE                    (24)
+
+/* 浮点最多输出的有效数字位数 */
+#define FLOAT_MAX_DIGITS                (17)
+
+/* 10^0 ~ 10^18 */
+#define U64_POW10_NUM                   (19)
+
+/* 精确舍入支持的最大缩放位数, 覆盖 double 的全部范围 */
+#define ROUND_EXACT_MAX_K               (350)
+
+/* 大整数的字数: 2^53 * 5^350 不超过 870 位 */
+#define BIG_WORDS                       (30)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef enum {
+    LEN_NONE = 0,
+    LEN_HH,
+    LEN_H,
+    LEN_L,
+    LEN_LL,
+    LEN_J,
+    LEN_Z,
+    LEN_T,
+    LEN_BIG_L,
+} length_t;
+
+typedef struct {
+    char       *buf;
+    size_t      size;                   /*!< 缓冲区大小（含 '\0'） */
+    size_t      len;                    /*!< 已输出的字节数（可能超过 size） */
+} out_t;
+
+typedef struct {
+    uint32_t    flags;
+    int         width;
+    int         prec;
+} spec_t;
+
+#if XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE
+/**
+ * @brief 浮点数的各部分: 整数数字 + 补零, 前导零 + 小数数字 + 补零, 指数.
+ */
+typedef struct {
+    char        idig[FLOAT_MAX_DIGITS + 4];
+    uint32_t    ni;
+    uint32_t    izero;
+    uint32_t    flead;
+    char        fdig[FLOAT_MAX_DIGITS + 4];
+    uint32_t    nf;
+    uint32_t    fzero;
+    char        exp[8];
+    uint32_t    ne;
+} fparts_t;
+
+/**
+ * @brief 无符号大整数, 32 位字小端存放, 只用于舍入时的精确比较.
+ */
+typedef struct {
+    uint32_t    w[BIG_WORDS];
+    uint32_t    n;                      /*!< 有效字数, 最高字非 0 */
+} big_t;
+
+/**
+ * @brief 2 * v * 10^k 的精确表示: a * 2^s 与 n * p5 比较.
+ */
+typedef struct {
+    big_t       a;
+    big_t       p5;
+    int         s;
+} scaled_t;
+#endif
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _put(out_t *o, const char *s, size_t n);
+static void _putc(out_t *o, char c);
+static void _pad(out_t *o, char c, int n);
+static uint32_t _utoa_rev(uint64_t v, uint32_t base, bool upper, char *end);
+static void _fmt_int(out_t *o, uint64_t v, bool neg, bool is_signed, uint32_t base,
+                     const spec_t *spec);
+static void _fmt_str(out_t *o, const char *s, const spec_t *spec);
+#if XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE
+static void _fmt_float(out_t *o, double v, char conv, const spec_t *spec);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+static const char s_dig2[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char s_hex_lower[] = "0123456789abcdef";
+static const char s_hex_upper[] = "0123456789ABCDEF";
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+int xf_builtin_snprintf(char *buf, size_t size, const char *format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+    int n = xf_builtin_vsnprintf(buf, size, format, ap);
+    va_end(ap);
+    return n;
+}
+
+int xf_builtin_vsnprintf(char *buf, size_t size, const char *format, va_list ap)
+{
+    out_t o = { buf, (NULL == buf) ? 0 : size, 0 };
+    const char *p = format;
+    char tmp[INT_BUF_SIZE];
+
+    while ('\0' != *p) {
+        /* 原样输出的文本整段拷贝 */
+        const char *q = p;
+        while (('\0' != *q) && ('%' != *q)) {
+            q++;
+        }
+        if (q != p) {
+            _put(&o, p, (size_t)(q - p));
+            p = q;
+            if ('\0' == *p) {
+                break;
+            }
+        }
+        p++;
+
+        /* 快速路径: 无标志、宽度、精度、长度的常用转换 */
+        switch (*p) {
+        case 'd':
+        case 'i': {
+            int v = va_arg(ap, int);
+            uint32_t u = (v < 0) ? (0u - (uint32_t)v) : (uint32_t)v;
+            uint32_t n = _utoa_rev(u, 10, false, tmp + sizeof(tmp));
+            if (v < 0) {
+                _putc(&o, '-');
+            }
+            _put(&o, tmp + sizeof(tmp) - n, n);
+            p++;
+            continue;
+        }
+        case 'u':
+        case 'x': {
+            uint32_t base = ('u' == *p) ? 10 : 16;
+            uint32_t n = _utoa_rev(va_arg(ap, unsigned int), base, false, tmp + sizeof(tmp));
+            _put(&o, tmp + sizeof(tmp) - n, n);
+            p++;
+            continue;
+        }
+        case 's': {
+            const char *s = va_arg(ap, const char *);
+            if (NULL == s) {
+                s = "(null)";
+            }
+            _put(&o, s, xf_strlen(s));
+            p++;
+            continue;
+        }
+        case '%':
+            _putc(&o, '%');
+            p++;
+            continue;
+        default:
+            break;
+        }
+
+        /* 完整解析: %[flags][width][.prec][length]conv */
+        spec_t spec = { 0, 0, 0 };
+        for (;; p++) {
+            if ('-' == *p) {
+                spec.flags |= FLAG_LEFT;
+            } else if ('+' == *p) {
+                spec.flags |= FLAG_PLUS;
+            } else if (' ' == *p) {
+                spec.flags |= FLAG_SPACE;
+            } else if ('#' == *p) {
+                spec.flags |= FLAG_ALT;
+            } else if ('0' == *p) {
+                spec.flags |= FLAG_ZERO;
+            } else {
+                break;
+            }
+        }
+        if ('*' == *p) {
+            spec.width = va_arg(ap, int);
+            if (spec.width < 0) {
+                spec.flags |= FLAG_LEFT;
+                spec.width = -spec.width;
+            }
+            p++;
+        } else {
+            while ((*p >= '0') && (*p <= '9')) {
+                spec.width = spec.width * 10 + (*p++ - '0');
+            }
+        }
+        if ('.' == *p) {
+            p++;
+            spec.flags |= FLAG_PREC;
+            if ('*' == *p) {
+                spec.prec = va_arg(ap, int);
+                if (spec.prec < 0) {
+                    spec.flags &= ~FLAG_PREC;
+                    spec.prec = 0;
+                }
+                p++;
+            } else {
+                while ((*p >= '0') && (*p <= '9')) {
+                    spec.prec = spec.prec * 10 + (*p++ - '0');
+                }
+            }
+        }
+
+        length_t len = LEN_NONE;
+        switch (*p) {
+        case 'h':
+            p++;
+            len = LEN_H;
+            if ('h' == *p) {
+                p++;
+                len = LEN_HH;
+            }
+            break;
+        case 'l':
+            p++;
+            len = LEN_L;
+            if ('l' == *p) {
+                p++;
+                len = LEN_LL;
+            }
+            break;
+        case 'j': p++; len = LEN_J;     break;
+        case 'z': p++; len = LEN_Z;     break;
+        case 't': p++; len = LEN_T;     break;
+        case 'L': p++; len = LEN_BIG_L; break;
+        default:                        break;
+        }
+
+        char conv = *p;
+        if ('\0' == conv) {
+            break;
+        }
+        p++;
+        switch (conv) {
+        case 'd':
+        case 'i': {
+            int64_t v;
+            switch (len) {
+            case LEN_HH:    v = (signed char)va_arg(ap, int);   break;
+            case LEN_H:     v = (short)va_arg(ap, int);         break;
+            case LEN_L:     v = va_arg(ap, long);               break;
+            case LEN_LL:    v = va_arg(ap, long long);          break;
+            case LEN_J:     v = va_arg(ap, intmax_t);           break;
+            case LEN_Z:
+            case LEN_T:     v = va_arg(ap, ptrdiff_t);          break;
+            default:        v = va_arg(ap, int);                break;
+            }
+            uint64_t u = (v < 0) ? (0u - (uint64_t)v) : (uint64_t)v;
+            _fmt_int(&o, u, v < 0, true, 10, &spec);
+            break;
+        }
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X': {
+            uint64_t v;
+            switch (len) {
+            case LEN_HH:    v = (unsigned char)va_arg(ap, unsigned int);    break;
+            case LEN_H:     v = (unsigned short)va_arg(ap, unsigned int);   break;
+            case LEN_L:     v = va_arg(ap, unsigned long);                  break;
+            case LEN_LL:    v = va_arg(ap, unsigned long long);             break;
+            case LEN_J:     v = va_arg(ap, uintmax_t);                      break;
+            case LEN_Z:     v = va_arg(ap, size_t);                         break;
+            case LEN_T:     v = (uint64_t)va_arg(ap, ptrdiff_t);            break;
+            default:        v = va_arg(ap, unsigned int);                   break;
+            }
+            uint32_t base = ('u' == conv) ? 10 : (('o' == conv) ? 8 : 16);
+            if ('X' == conv) {
+                spec.flags |= FLAG_UPPER;
+            }
+            _fmt_int(&o, v, false, false, base, &spec);
+            break;
+        }
+        case 'c': {
+            char c = (char)va_arg(ap, int);
+            int pad = (spec.width > 1) ? (spec.width - 1) : 0;
+            if (!(spec.flags & FLAG_LEFT)) {
+                _pad(&o, ' ', pad);
+            }
+            _putc(&o, c);
+            if (spec.flags & FLAG_LEFT) {
+                _pad(&o, ' ', pad);
+            }
+            break;
+        }
+        case 's':
+            _fmt_str(&o, va_arg(ap, const char *), &spec);
+            break;
+        case 'p': {
+            void *ptr = va_arg(ap, void *);
+            if (NULL == ptr) {
+                spec.flags &= ~FLAG_PREC;
+                _fmt_str(&o, "(nil)", &spec);
+            } else {
+                spec.flags |= FLAG_ALT;
+                _fmt_int(&o, (uint64_t)(uintptr_t)ptr, false, false, 16, &spec);
+            }
+            break;
+        }
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G': {
+            double v = (LEN_BIG_L == len) ? (double)va_arg(ap, long double) : va_arg(ap, double);
+#if XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE
+            _fmt_float(&o, v, conv, &spec);
+#else
+            (void)v;
+            _putc(&o, '?');
+#endif
+            break;
+        }
+        case 'n':
+            /* 不支持 %n, 只跳过参数 */
+            (void)va_arg(ap, void *);
+            break;
+        case '%':
+            _putc(&o, '%');
+            break;
+        default:
+            /* 未知转换原样输出 */
+            _putc(&o, '%');
+            _putc(&o, conv);
+            break;
+        }
+    }
+
+    if (o.size > 0) {
+        o.buf[(o.len < o.size) ? o.len : (o.size - 1)] = '\0';
+    }
+    return (int)o.len;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _put(out_t *o, const char *s, size_t n)
+{
+    if (o->len + 1 < o->size) {
+        size_t room = o->size - 1 - o->len;
+        xf_memcpy(o->buf + o->len, s, (n < room) ? n : room);
+    }
+    o->len += n;
+}
+
+static void _putc(out_t *o, char c)
+{
+    if (o->len + 1 < o->size) {
+        o->buf[o->len] = c;
+    }
+    o->len++;
+}
+
+static void _pad(out_t *o, char c, int n)
+{
+    for (; n > 0; n--) {
+        _putc(o, c);
+    }
+}
+
+/**
+ * @brief 从 end 向前写入 v 的数字, 返回位数. 十进制每次处理两位.
+ */
+static uint32_t _utoa_rev(uint64_t v, uint32_t base, bool upper, char *end)
+{
+    char *p = end;
+
+    if (10 == base) {
+        /* 32 位以内用 32 位除法, 在 32 位 MCU 上明显更快 */
+        while (v > 0xffffffffu) {
+            uint32_t r = (uint32_t)(v % 100);
+            v /= 100;
+            p -= 2;
+            p[0] = s_dig2[r * 2];
+            p[1] = s_dig2[r * 2 + 1];
+        }
+        uint32_t v32 = (uint32_t)v;
+        while (v32 >= 100) {
+            uint32_t r = v32 % 100;
+            v32 /= 100;
+            p -= 2;
+            p[0] = s_dig2[r * 2];
+            p[1] = s_dig2[r * 2 + 1];
+        }
+        if (v32 >= 10) {
+            p -= 2;
+            p[0] = s_dig2[v32 * 2];
+            p[1] = s_dig2[v32 * 2 + 1];
+        } else {
+            *--p = (char)('0' + v32);
+        }
+    } else {
+        const char *digits = upper ? s_hex_upper : s_hex_lower;
+        uint32_t shift = (16 == base) ? 4 : 3;
+        do {
+            *--p = digits[v & (base - 1)];
+            v >>= shift;
+        } while (v > 0);
+    }
+    return (uint32_t)(end - p);
+}
+
+static void _fmt_int(out_t *o, uint64_t v, bool neg, bool is_signed, uint32_t base,
+                     const spec_t *spec)
+{
+    char buf[INT_BUF_SIZE];
+    char prefix[2];
+    uint32_t np = 0;
+    uint32_t nd = 0;
+
+    /* 精度为 0 且值为 0 时不输出数字 */
+    if ((0 != v) || !(spec->flags & FLAG_PREC) || (0 != spec->prec)) {
+        nd = _utoa_rev(v, base, spec->flags & FLAG_UPPER, buf + sizeof(buf));
+    }
+
+    if (neg) {
+        prefix[np++] = '-';
+    } else if (is_signed && (spec->flags & FLAG_PLUS)) {
+        prefix[np++] = '+';
+    } else if (is_signed && (spec->flags & FLAG_SPACE)) {
+        prefix[np++] = ' ';
+    }
+    if ((spec->flags & FLAG_ALT) && (16 == base) && (0 != v)) {
+        prefix[np++] = '0';
+        prefix[np++] = (spec->flags & FLAG_UPPER) ? 'X' : 'x';
+    }
+
+    /* 精度: 最少数字位数; '#' 八进制保证以 0 开头 */
+    int zeros = ((spec->flags & FLAG_PREC) && (spec->prec > (int)nd)) ? (spec->prec - (int)nd) : 0;
+    if ((spec->flags & FLAG_ALT) && (8 == base) && (0 == zeros)
+            && ((0 == nd) || ('0' != buf[sizeof(buf) - nd]))) {
+        zeros = 1;
+    }
+    int total = (int)(np + nd) + zeros;
+    int pad = (spec->width > total) ? (spec->width - total) : 0;
+
+    if (spec->flags & FLAG_LEFT) {
+        _put(o, prefix, np);
+        _pad(o, '0', zeros);
+        _put(o, buf + sizeof(buf) - nd, nd);
+        _pad(o, ' ', pad);
+    } else if ((spec->flags & FLAG_ZERO) && !(spec->flags & FLAG_PREC)) {
+        _put(o, prefix, np);
+        _pad(o, '0', zeros + pad);
+        _put(o, buf + sizeof(buf) - nd, nd);
+    } else {
+        _pad(o, ' ', pad);
+        _put(o, prefix, np);
+        _pad(o, '0', zeros);
+        _put(o, buf + sizeof(buf) - nd, nd);
+    }
+}
+
+static void _fmt_str(out_t *o, const char *s, const spec_t *spec)
+{
+    if (NULL == s) {
+        s = "(null)";
+    }
+    /* 指定精度时最多读取 prec 个字节, s 可以不以 '\0' 结尾 */
+    size_t n = 0;
+    if (spec->flags & FLAG_PREC) {
+        while ((n < (size_t)spec->prec) && ('\0' != s[n])) {
+            n++;
+        }
+    } else {
+        n = xf_strlen(s);
+    }
+    int pad = ((size_t)spec->width > n) ? (spec->width - (int)n) : 0;
+    if (!(spec->flags & FLAG_LEFT)) {
+        _pad(o, ' ', pad);
+    }
+    _put(o, s, n);
+    if (spec->flags & FLAG_LEFT) {
+        _pad(o, ' ', pad);
+    }
+}
+
+#if XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE
+
+static const double s_pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static const uint64_t s_u64_pow10[U64_POW10_NUM] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+    10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL,
+};
+
+static const uint32_t s_u32_pow5[] = {
+    1U, 5U, 25U, 125U, 625U, 3125U, 15625U, 78125U, 390625U, 1953125U, 9765625U,
+    48828125U, 244140625U, 1220703125U,
+};
+
+/**
+ * @brief v * 10^k. |k| <= 22 时只有一次舍入.
+ */
+static double _scale10(double v, int k)
+{
+    while (k > 22) {
+        v *= 1e22;
+        k -= 22;
+    }
+    while (k < -22) {
+        v /= 1e22;
+        k += 22;
+    }
+    return (k >= 0) ? (v * s_pow10[k]) : (v / s_pow10[-k]);
+}
+
+static void _big_set(big_t *b, uint64_t v)
+{
+    b->w[0] = (uint32_t)v;
+    b->w[1] = (uint32_t)(v >> 32);
+    b->n = (0 != b->w[1]) ? 2 : ((0 != b->w[0]) ? 1 : 0);
+}
+
+static void _big_mul32(big_t *b, uint32_t m)
+{
+    uint64_t c = 0;
+    for (uint32_t i = 0; i < b->n; i++) {
+        c += (uint64_t)b->w[i] * m;
+        b->w[i] = (uint32_t)c;
+        c >>= 32;
+    }
+    if (0 != c) {
+        b->w[b->n++] = (uint32_t)c;
+    }
+}
+
+/**
+ * @brief r = a * m.
+ */
+static void _big_mul64(big_t *r, const big_t *a, uint64_t m)
+{
+    const uint32_t h[2] = {(uint32_t)m, (uint32_t)(m >> 32)};
+    xf_memset(r->w, 0, sizeof(uint32_t) * (a->n + 2));
+    for (uint32_t j = 0; j < 2; j++) {
+        uint64_t c = 0;
+        for (uint32_t i = 0; i < a->n; i++) {
+            c += (uint64_t)a->w[i] * h[j] + r->w[i + j];
+            r->w[i + j] = (uint32_t)c;
+            c >>= 32;
+        }
+        r->w[a->n + j] = (uint32_t)c;
+    }
+    r->n = a->n + 2;
+    while ((r->n > 0) && (0 == r->w[r->n - 1])) {
+        r->n--;
+    }
+}
+
+static void _big_mul_pow5(big_t *b, uint32_t k)
+{
+    while (k > 13) {
+        _big_mul32(b, s_u32_pow5[13]);
+        k -= 13;
+    }
+    _big_mul32(b, s_u32_pow5[k]);
+}
+
+static int _big_bitlen(const big_t *b)
+{
+    if (0 == b->n) {
+        return 0;
+    }
+    int n = (int)(b->n - 1) * 32;
+    for (uint32_t w = b->w[b->n - 1]; 0 != w; w >>= 1) {
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief (b * 2^sh) 的第 i 个字, sh >= 0.
+ */
+static uint32_t _big_word(const big_t *b, uint32_t sh, uint32_t i)
+{
+    uint32_t ws = sh / 32;
+    uint32_t bs = sh % 32;
+    uint32_t r = 0;
+    if ((i >= ws) && (i - ws < b->n)) {
+        r = b->w[i - ws] << bs;
+    }
+    if ((0 != bs) && (i >= ws + 1) && (i - ws - 1 < b->n)) {
+        r |= b->w[i - ws - 1] >> (32 - bs);
+    }
+    return r;
+}
+
+/**
+ * @brief 将 a * 2^t 舍入为整数, t < 0, 正中间时五成双. 结果须小于 2^64.
+ */
+static uint64_t _big_round_shr(const big_t *a, uint32_t sh)
+{
+    uint32_t ws = sh / 32;
+    uint32_t bs = sh % 32;
+    uint64_t w0 = (ws < a->n) ? a->w[ws] : 0;
+    uint64_t w1 = (ws + 1 < a->n) ? a->w[ws + 1] : 0;
+    uint64_t w2 = (ws + 2 < a->n) ? a->w[ws + 2] : 0;
+    uint64_t q = (w0 | (w1 << 32)) >> bs;
+    if (0 != bs) {
+        q |= w2 << (64 - bs);
+    }
+
+    /* 舍去部分的最高位与其余位 */
+    uint32_t hb = sh - 1;
+    bool half = (hb / 32 < a->n) && ((a->w[hb / 32] >> (hb % 32)) & 1);
+    bool sticky = (hb / 32 < a->n) && (0 != (a->w[hb / 32] & ((1u << (hb % 32)) - 1)));
+    for (uint32_t i = 0; !sticky && (i < hb / 32) && (i < a->n); i++) {
+        sticky = (0 != a->w[i]);
+    }
+    if (half && (sticky || (q & 1))) {
+        q++;
+    }
+    return q;
+}
+
+/**
+ * @brief 比较 a * 2^s 与 b.
+ */
+static int _big_cmp_shifted(const big_t *a, int s, const big_t *b)
+{
+    if ((0 == a->n) || (0 == b->n)) {
+        return (a->n == b->n) ? 0 : ((0 == a->n) ? -1 : 1);
+    }
+    int la = _big_bitlen(a) + s;
+    int lb = _big_bitlen(b);
+    if (la != lb) {
+        return (la > lb) ? 1 : -1;
+    }
+    /* 位数相同, 只需把指数较小的一方左移 */
+    uint32_t sa = (s > 0) ? (uint32_t)s : 0;
+    uint32_t sb = (s < 0) ? (uint32_t)(-s) : 0;
+    for (uint32_t i = (uint32_t)(lb + (int)sb + 31) / 32; i > 0; i--) {
+        uint32_t wa = _big_word(a, sa, i - 1);
+        uint32_t wb = _big_word(b, sb, i - 1);
+        if (wa != wb) {
+            return (wa > wb) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 准备精确比较 2 * v * 10^k 与整数, |k| <= ROUND_EXACT_MAX_K.
+ *
+ * v = m * 2^e, 故 2 * v * 10^k = m * 5^k * 2^(e + k + 1).
+ * k < 0 时 5^-k 移到比较的另一侧.
+ */
+static void _scaled_init(scaled_t *sc, double v, int k)
+{
+    union {
+        double      d;
+        uint64_t    u;
+    } cv;
+    cv.d = v;
+    uint64_t m = cv.u & ((1ULL << 52) - 1);
+    int e = (int)((cv.u >> 52) & 0x7ff);
+    if (0 == e) {
+        e = -1074;
+    } else {
+        m |= 1ULL << 52;
+        e -= 1075;
+    }
+    sc->s = e + k + 1;
+    _big_set(&sc->a, m);
+    _big_set(&sc->p5, 1);
+    if (k >= 0) {
+        _big_mul_pow5(&sc->a, (uint32_t)k);
+    } else {
+        _big_mul_pow5(&sc->p5, (uint32_t)(-k));
+    }
+}
+
+/**
+ * @brief 比较 2 * v * 10^k 与 n.
+ */
+static int _scaled_cmp(const scaled_t *sc, uint64_t n)
+{
+    big_t b;
+    _big_mul64(&b, &sc->p5, n);
+    return _big_cmp_shifted(&sc->a, sc->s, &b);
+}
+
+/**
+ * @brief 将 x = v * 10^k 舍入为最接近的整数, 正中间时五成双（与 C 库一致）.
+ *
+ * x 离 .5 足够远时直接由 x 决定; 否则用 v 的尾数与指数做大整数比较,
+ * 乘法舍入造成的假 .5 不会影响结果.
+ *
+ * @param x v * 10^k, 不超过 2^62.
+ * @param v 被缩放的数, 非负.
+ * @param k 缩放的位数.
+ */
+static uint64_t _round_scaled(double x, double v, int k)
+{
+    uint64_t d = (uint64_t)x;
+    double r = x - (double)d;
+    /* _scale10() 每步的相对误差不超过 2^-53, 留出余量 */
+    int steps = 1 + ((k < 0) ? -k : k) / 22;
+    double err = (x + 1.0) * (double)steps * (1.0 / 1125899906842624.0);
+
+    if (r < 0.5 - err) {
+        return d;
+    }
+    if ((r > 0.5 + err) || (k > ROUND_EXACT_MAX_K) || (k < -ROUND_EXACT_MAX_K)) {
+        return (r < 0.5) ? d : (d + 1);
+    }
+
+    scaled_t sc;
+    _scaled_init(&sc, v, k);
+    if ((k >= 0) && (sc.s < 1)) {
+        /* v * 10^k = a * 2^(s - 1), 直接移位取整 */
+        return _big_round_shr(&sc.a, (uint32_t)(1 - sc.s));
+    }
+    /* 在 x 的误差范围内二分出 floor(v * 10^k), 再与 d + 0.5 比较 */
+    uint64_t span = (uint64_t)err + 1;
+    uint64_t lo = (d > span) ? (d - span) : 0;
+    uint64_t hi = d + span + 1;
+    while (hi - lo > 1) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (_scaled_cmp(&sc, 2 * mid) >= 0) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    d = lo;
+    /* 误差估计不成立时逐个修正 */
+    while ((d > 0) && (_scaled_cmp(&sc, 2 * d) < 0)) {
+        d--;
+    }
+    while (_scaled_cmp(&sc, 2 * d + 2) >= 0) {
+        d++;
+    }
+    int c = _scaled_cmp(&sc, 2 * d + 1);
+    if ((c > 0) || ((0 == c) && (d & 1))) {
+        d++;
+    }
+    return d;
+}
+
+/**
+ * @brief 由二进制指数估算 floor(log10(v)), 误差不超过 1.
+ */
+static int _estimate_e10(double v)
+{
+    union {
+        double      d;
+        uint64_t    u;
+    } cv;
+    cv.d = v;
+    if (0 == ((cv.u >> 52) & 0x7ff)) {
+        /* 非规格化数先放大 */
+        return _estimate_e10(v * 1e16) - 16;
+    }
+    int e2 = (int)((cv.u >> 52) & 0x7ff) - 1023;
+    /* 1233 / 4096 ~= log10(2) */
+    return (e2 >= 0) ? ((e2 * 1233) >> 12) : -(((-e2) * 1233 + 4095) >> 12);
+}
+
+/**
+ * @brief 将 v (> 0) 舍入为 nd 位有效数字 d * 10^(e10 - nd + 1), 返回 d.
+ */
+static uint64_t _sig_digits(double v, uint32_t nd, int *p_e10)
+{
+    int e10 = _estimate_e10(v);
+    uint64_t d = 0;
+
+    for (int i = 0; i < 4; i++) {
+        int k = (int)nd - 1 - e10;
+        double x = _scale10(v, k);
+        d = _round_scaled(x, v, k);
+        if (d >= s_u64_pow10[nd]) {
+            e10++;
+        } else if (d < s_u64_pow10[nd - 1]) {
+            e10--;
+        } else {
+            break;
+        }
+    }
+    *p_e10 = e10;
+    return d;
+}
+
+/**
+ * @brief 将 v 写成恰好 n 位十进制数字（高位补 0）.
+ */
+static void _digits(uint64_t v, uint32_t n, char *out)
+{
+    for (uint32_t i = n; i > 0; i--) {
+        out[i - 1] = (char)('0' + (v % 10));
+        v /= 10;
+    }
+}
+
+/**
+ * @brief 定点格式. 整数部分精确输出（小于 2^64 时）, 小数部分从第一个非零数字起
+ *        最多 FLOAT_MAX_DIGITS 位, 其余位补 0.
+ */
+static void _ftoa_f(double v, int prec, fparts_t *fp)
+{
+    uint32_t k = (prec > FLOAT_MAX_DIGITS) ? FLOAT_MAX_DIGITS : (uint32_t)prec;
+
+    fp->flead = 0;
+    fp->ne = 0;
+    if (v < 18446744073709551616.0) {
+        /* 减去整数部分是精确的, 小数部分只在缩放时舍入一次 */
+        uint64_t ip = (uint64_t)v;
+        double frac = v - (double)ip;
+        uint64_t fd = 0;
+        if ((prec > FLOAT_MAX_DIGITS) && (frac > 0.0)) {
+            /* 小数部分的前导零不计入 FLOAT_MAX_DIGITS */
+            int e10;
+            (void)_sig_digits(frac, FLOAT_MAX_DIGITS, &e10);
+            int lim = FLOAT_MAX_DIGITS - 1 - e10;
+            k = (prec < lim) ? (uint32_t)prec : (uint32_t)lim;
+        }
+        if (k > 0) {
+            fd = _round_scaled(_scale10(frac, (int)k), frac, (int)k);
+            if ((k < U64_POW10_NUM) && (fd >= s_u64_pow10[k])) {
+                ip++;
+                fd -= s_u64_pow10[k];
+            }
+        } else if ((frac > 0.5) || ((0.5 == frac) && (ip & 1))) {
+            ip++;
+        }
+        char tmp[INT_BUF_SIZE];
+        fp->ni = _utoa_rev(ip, 10, false, tmp + sizeof(tmp));
+        xf_memcpy(fp->idig, tmp + sizeof(tmp) - fp->ni, fp->ni);
+        fp->izero = 0;
+        /* 超出 fdig 的部分只可能是前导零 */
+        fp->nf = k;
+        if (k > FLOAT_MAX_DIGITS + 1) {
+            fp->nf = 0;
+            while ((fp->nf < U64_POW10_NUM) && (fd >= s_u64_pow10[fp->nf])) {
+                fp->nf++;
+            }
+            fp->flead = k - fp->nf;
+        }
+        _digits(fd, fp->nf, fp->fdig);
+        fp->fzero = (uint32_t)prec - k;
+    } else {
+        int e10;
+        uint64_t d = _sig_digits(v, FLOAT_MAX_DIGITS, &e10);
+        _digits(d, FLOAT_MAX_DIGITS, fp->idig);
+        fp->ni = FLOAT_MAX_DIGITS;
+        fp->izero = (uint32_t)(e10 - (FLOAT_MAX_DIGITS - 1));
+        fp->nf = 0;
+        fp->fzero = (uint32_t)prec;
+    }
+}
+
+static void _ftoa_e(double v, int prec, bool upper, fparts_t *fp)
+{
+    uint32_t nd = ((uint32_t)prec + 1 > FLOAT_MAX_DIGITS) ? FLOAT_MAX_DIGITS : ((uint32_t)prec + 1);
+    char tmp[FLOAT_MAX_DIGITS];
+    int e10 = 0;
+    uint64_t d = 0;
+
+    if (0.0 != v) {
+        d = _sig_digits(v, nd, &e10);
+    }
+    _digits(d, nd, tmp);
+    fp->idig[0] = tmp[0];
+    fp->ni = 1;
+    fp->izero = 0;
+    fp->flead = 0;
+    xf_memcpy(fp->fdig, tmp + 1, nd - 1);
+    fp->nf = nd - 1;
+    fp->fzero = (uint32_t)prec + 1 - nd;
+
+    /* 指数至少两位 */
+    uint32_t ue = (e10 < 0) ? (uint32_t)(-e10) : (uint32_t)e10;
+    char etmp[INT_BUF_SIZE];
+    uint32_t n = _utoa_rev(ue, 10, false, etmp + sizeof(etmp));
+    fp->ne = 0;
+    fp->exp[fp->ne++] = upper ? 'E' : 'e';
+    fp->exp[fp->ne++] = (e10 < 0) ? '-' : '+';
+    if (n < 2) {
+        fp->exp[fp->ne++] = '0';
+    }
+    xf_memcpy(fp->exp + fp->ne, etmp + sizeof(etmp) - n, n);
+    fp->ne += n;
+}
+
+static void _fmt_float(out_t *o, double v, char conv, const spec_t *spec)
+{
+    bool upper = ('F' == conv) || ('E' == conv) || ('G' == conv);
+    char sign = 0;
+    fparts_t fp;
+
+    union {
+        double      d;
+        uint64_t    u;
+    } cv;
+    cv.d = v;
+    if (cv.u >> 63) {
+        sign = '-';
+        v = -v;
+    } else if (spec->flags & FLAG_PLUS) {
+        sign = '+';
+    } else if (spec->flags & FLAG_SPACE) {
+        sign = ' ';
+    }
+
+    /* inf / nan 不补 0 */
+    if ((v != v) || (v > 1.7976931348623157e308)) {
+        char s[5];
+        uint32_t n = 0;
+        const char *t = (v != v) ? (upper ? "NAN" : "nan") : (upper ? "INF" : "inf");
+        if (sign) {
+            s[n++] = sign;
+        }
+        for (uint32_t i = 0; i < 3; i++) {
+            s[n++] = t[i];
+        }
+        s[n] = '\0';
+        spec_t sp = *spec;
+        sp.flags &= ~FLAG_PREC;
+        _fmt_str(o, s, &sp);
+        return;
+    }
+
+    int prec = (spec->flags & FLAG_PREC) ? spec->prec : 6;
+    bool strip = false;
+    if (('g' == conv) || ('G' == conv)) {
+        /* C 标准: P 为有效数字位数, X 为按 P 位舍入后的指数 */
+        int P = (0 == prec) ? 1 : prec;
+        int X = 0;
+        if (0.0 != v) {
+            (void)_sig_digits(v, (P > FLOAT_MAX_DIGITS) ? FLOAT_MAX_DIGITS : (uint32_t)P, &X);
+        }
+        if ((P > X) && (X >= -4)) {
+            _ftoa_f(v, P - 1 - X, &fp);
+        } else {
+            _ftoa_e(v, P - 1, upper, &fp);
+        }
+        strip = !(spec->flags & FLAG_ALT);
+    } else if (('e' == conv) || ('E' == conv)) {
+        _ftoa_e(v, prec, upper, &fp);
+    } else {
+        _ftoa_f(v, prec, &fp);
+    }
+
+    if (strip) {
+        fp.fzero = 0;
+        while ((fp.nf > 0) && ('0' == fp.fdig[fp.nf - 1])) {
+            fp.nf--;
+        }
+        if (0 == fp.nf) {
+            fp.flead = 0;
+        }
+    }
+    bool dot = (fp.flead + fp.nf + fp.fzero > 0) || (spec->flags & FLAG_ALT);
+    int total = (sign ? 1 : 0) + (int)(fp.ni + fp.izero + fp.flead + fp.nf + fp.fzero + fp.ne) + (dot ? 1 : 0);
+    int pad = (spec->width > total) ? (spec->width - total) : 0;
+
+    if (!(spec->flags & FLAG_LEFT) && !(spec->flags & FLAG_ZERO)) {
+        _pad(o, ' ', pad);
+    }
+    if (sign) {
+        _putc(o, sign);
+    }
+    if (!(spec->flags & FLAG_LEFT) && (spec->flags & FLAG_ZERO)) {
+        _pad(o, '0', pad);
+    }
+    _put(o, fp.idig, fp.ni);
+    _pad(o, '0', (int)fp.izero);
+    if (dot) {
+        _putc(o, '.');
+    }
+    _pad(o, '0', (int)fp.flead);
+    _put(o, fp.fdig, fp.nf);
+    _pad(o, '0', (int)fp.fzero);
+    _put(o, fp.exp, fp.ne);
+    if (spec->flags & FLAG_LEFT) {
+        _pad(o, ' ', pad);
+    }
+}
+
+#endif /* XF_STDIO_BUILTIN_PRINTF_FLOAT_IS_ENABLE */
+
+#endif /* XF_STDIO_BUILTIN_PRINTF_IS_ENABLE */
@@ -20,6 +20,11 @@
 #include <stdio.h>
 #endif
 
+#if XF_STDIO_BUILTIN_PRINTF_IS_ENABLE
+#include <stdarg.h>
+#include <stddef.h>
+#endif
+
 /**
  * @cond XFAPI_USER
  * @ingroup group_xf_utils_std
@@ -45,6 +50,39 @@ extern "C" {
 
 /* ==================== [Global Prototypes] ================================= */
 
+#if XF_STDIO_BUILTIN_PRINTF_IS_ENABLE
+
+/**
+ * @brief 内置的 vsnprintf, 可重入、不分配内存、不依赖 locale.
+ *
+ * 支持:
+ * - 标志 `-+ #0`, 宽度与精度（含 `*`）, 长度 `hh h l ll j z t L`;
+ * - 转换 `d i u o x X c s p %`, 以及 `f F e E g G`（XF_STDIO_BUILTIN_PRINTF_FLOAT_ENABLE）.
+ *
+ * 不支持 `%n`（只跳过参数）和 `%a`. 浮点从第一个非零数字起最多输出 17 位有效数字,
+ * 其余位补 0（`%f` 中小于 2^64 的整数部分总是完整输出）. 末位按精确值舍入,
+ * 恰好位于正中间时五成双, 因此 17 位以内的结果与 C 库一致, "%.17g" 可被 strtod() 还原.
+ * 靠近舍入边界时用大整数精确比较, 浮点转换约需 400 字节栈.
+ *
+ * @param buf 输出缓冲区, 可为 NULL（此时 size 应为 0）.
+ * @param size 缓冲区大小. 非 0 时输出总以 '\0' 结尾.
+ * @param format 格式化字符串.
+ * @param ap 参数.
+ * @return int 不受 size 限制时应输出的字节数（不含 '\0'）, 同 C99 vsnprintf.
+ */
+int xf_builtin_vsnprintf(char *buf, size_t size, const char *format, va_list ap);
+
+/**
+ * @brief 同 xf_builtin_vsnprintf(), 参数为可变参数.
+ */
+int xf_builtin_snprintf(char *buf, size_t size, const char *format, ...)
+#if defined(__GNUC__)
+__attribute__((format(printf, 3, 4)))
+#endif
+;
+
+#endif /* XF_STDIO_BUILTIN_PRINTF_IS_ENABLE */
+
 /* ==================== [Macros] ============================================ */
 
 #ifdef __cplusplus
@@ -0,0 +1,264 @@
+/**
+ * @file xf_stdlib.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 整数与字符串的快速转换.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_stdlib.h"
+#include "xf_stdbool.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 9 位十进制数不会超过 uint32_t */
+#define U32_SAFE_DIGITS                 (9)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static uint32_t _count_digits(uint32_t v);
+static char *_put_u32(char *p, uint32_t v);
+static char *_put_8digits(char *p, uint32_t v);
+static size_t _skip_zeros(const char *str, size_t len, size_t i);
+
+/* ==================== [Static Variables] ================================== */
+
+static const char s_dig2[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/* ==================== [Macros] ============================================ */
+
+#define _PUT_PAIR(p, r) do { \
+        (p)[0] = s_dig2[(r) * 2]; \
+        (p)[1] = s_dig2[(r) * 2 + 1]; \
+    } while (0)
+
+/* ==================== [Global Functions] ================================== */
+
+size_t xf_utoa(uint32_t value, char *buf)
+{
+    char *end = _put_u32(buf, value);
+    *end = '\0';
+    return (size_t)(end - buf);
+}
+
+size_t xf_itoa(int32_t value, char *buf)
+{
+    char *p = buf;
+    uint32_t u = (uint32_t)value;
+    if (value < 0) {
+        *p++ = '-';
+        u = 0u - u;
+    }
+    char *end = _put_u32(p, u);
+    *end = '\0';
+    return (size_t)(end - buf);
+}
+
+size_t xf_u64toa(uint64_t value, char *buf)
+{
+    char *p = buf;
+
+    /* 按 1e8 拆分, 最多两次 64 位除法, 其余都是 32 位运算 */
+    if (value <= 0xffffffffu) {
+        p = _put_u32(p, (uint32_t)value);
+    } else {
+        uint64_t hi = value / 100000000u;
+        uint32_t lo = (uint32_t)(value - hi * 100000000u);
+        if (hi <= 0xffffffffu) {
+            p = _put_u32(p, (uint32_t)hi);
+        } else {
+            uint32_t top = (uint32_t)(hi / 100000000u);
+            uint32_t mid = (uint32_t)(hi - (uint64_t)top * 100000000u);
+            p = _put_u32(p, top);
+            p = _put_8digits(p, mid);
+        }
+        p = _put_8digits(p, lo);
+    }
+    *p = '\0';
+    return (size_t)(p - buf);
+}
+
+size_t xf_i64toa(int64_t value, char *buf)
+{
+    if (value < 0) {
+        *buf = '-';
+        return 1 + xf_u64toa(0u - (uint64_t)value, buf + 1);
+    }
+    return xf_u64toa((uint64_t)value, buf);
+}
+
+size_t xf_atou(const char *str, size_t len, uint32_t *value)
+{
+    if ((NULL == str) || (NULL == value)) {
+        return 0;
+    }
+    size_t i = _skip_zeros(str, len, 0);
+    bool any = (i > 0);
+    uint32_t v = 0;
+
+    /* 前 9 位不会溢出, 每位只有一次判断 */
+    size_t safe_end = (len - i > U32_SAFE_DIGITS) ? (i + U32_SAFE_DIGITS) : len;
+    for (; i < safe_end; i++) {
+        uint32_t d = (uint32_t)(uint8_t)str[i] - '0';
+        if (d > 9) {
+            break;
+        }
+        v = v * 10 + d;
+        any = true;
+    }
+    /* 第 10 位需要检查溢出, 第 11 位一定溢出 */
+    if ((i == safe_end) && (i < len)) {
+        uint32_t d = (uint32_t)(uint8_t)str[i] - '0';
+        if (d <= 9) {
+            if ((v > 429496729u) || ((429496729u == v) && (d > 5))) {
+                return 0;
+            }
+            v = v * 10 + d;
+            i++;
+            if ((i < len) && ((uint32_t)(uint8_t)str[i] - '0' <= 9)) {
+                return 0;
+            }
+        }
+    }
+    if (!any) {
+        return 0;
+    }
+    *value = v;
+    return i;
+}
+
+size_t xf_atoi(const char *str, size_t len, int32_t *value)
+{
+    if ((NULL == str) || (NULL == value) || (0 == len)) {
+        return 0;
+    }
+    size_t i = 0;
+    bool neg = false;
+    if (('-' == str[0]) || ('+' == str[0])) {
+        neg = ('-' == str[0]);
+        i = 1;
+    }
+    uint32_t u = 0;
+    size_t n = xf_atou(str + i, len - i, &u);
+    if ((0 == n) || (u > (neg ? 0x80000000u : 0x7fffffffu))) {
+        return 0;
+    }
+    *value = neg ? (int32_t)(0u - u) : (int32_t)u;
+    return i + n;
+}
+
+size_t xf_hextou(const char *str, size_t len, uint32_t *value)
+{
+    if ((NULL == str) || (NULL == value)) {
+        return 0;
+    }
+    size_t i = 0;
+    if ((len >= 3) && ('0' == str[0]) && ('x' == (str[1] | 0x20))) {
+        i = 2;
+    }
+    size_t start = i;
+    i = _skip_zeros(str, len, i);
+    bool any = (i > start);
+    uint32_t v = 0;
+    uint32_t nd = 0;
+
+    for (; i < len; i++) {
+        uint32_t c = (uint32_t)(uint8_t)str[i];
+        uint32_t d = c - '0';
+        if (d > 9) {
+            /* 'A'~'F' 与 'a'~'f' 合并判断 */
+            d = (c | 0x20) - 'a';
+            if (d > 5) {
+                break;
+            }
+            d += 10;
+        }
+        if (++nd > 8) {
+            return 0;
+        }
+        v = (v << 4) | d;
+        any = true;
+    }
+    if (!any) {
+        return 0;
+    }
+    *value = v;
+    return i;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static uint32_t _count_digits(uint32_t v)
+{
+    if (v < 100000u) {
+        if (v < 100u) {
+            return (v < 10u) ? 1 : 2;
+        }
+        return (v < 1000u) ? 3 : ((v < 10000u) ? 4 : 5);
+    }
+    if (v < 10000000u) {
+        return (v < 1000000u) ? 6 : 7;
+    }
+    return (v < 100000000u) ? 8 : ((v < 1000000000u) ? 9 : 10);
+}
+
+/**
+ * @brief 写入 v 的十进制数字（不含 '\0'）, 返回结尾. 先算出位数, 再从低位每次写两位.
+ */
+static char *_put_u32(char *p, uint32_t v)
+{
+    char *end = p + _count_digits(v);
+    char *q = end;
+    while (v >= 100) {
+        uint32_t r = v % 100;
+        v /= 100;
+        q -= 2;
+        _PUT_PAIR(q, r);
+    }
+    if (v >= 10) {
+        q -= 2;
+        _PUT_PAIR(q, v);
+    } else {
+        *--q = (char)('0' + v);
+    }
+    return end;
+}
+
+/**
+ * @brief 写入 v（< 1e8）的 8 位十进制数字, 不足补 0.
+ */
+static char *_put_8digits(char *p, uint32_t v)
+{
+    uint32_t hi = v / 10000;
+    uint32_t lo = v - hi * 10000;
+    _PUT_PAIR(p, hi / 100);
+    _PUT_PAIR(p + 2, hi % 100);
+    _PUT_PAIR(p + 4, lo / 100);
+    _PUT_PAIR(p + 6, lo % 100);
+    return p + 8;
+}
+
+static size_t _skip_zeros(const char *str, size_t len, size_t i)
+{
+    while ((i < len) && ('0' == str[i])) {
+        i++;
+    }
+    return i;
+}
@@ -16,6 +16,9 @@
 
 #include "xf_std_config.h"
 
+#include "xf_stdint.h"
+#include "xf_stddef.h"
+
 #if XF_STDLIB_IS_ENABLE
 #   include <stdlib.h>
 #endif
@@ -38,10 +41,62 @@ extern "C" {
 #define xf_malloc(x)                   xf_user_malloc(x)
 #define xf_free(x)                     xf_user_free(x)
 
+/* 转换结果（含 '\0'）所需的缓冲区大小 */
+#define XF_UTOA_BUF_SIZE               (11)
+#define XF_ITOA_BUF_SIZE               (12)
+#define XF_U64TOA_BUF_SIZE             (21)
+#define XF_I64TOA_BUF_SIZE             (21)
+
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Global Prototypes] ================================= */
 
+/**
+ * @brief 无符号整数转十进制字符串. 每次查表写两位, 不依赖 printf.
+ *
+ * @param value 数值.
+ * @param buf 输出缓冲区, 至少 XF_UTOA_BUF_SIZE 字节, 以 '\0' 结尾.
+ * @return size_t 字符数（不含 '\0'）.
+ */
+size_t xf_utoa(uint32_t value, char *buf);
+
+/**
+ * @brief 有符号整数转十进制字符串. 同 xf_utoa(), 缓冲区至少 XF_ITOA_BUF_SIZE 字节.
+ */
+size_t xf_itoa(int32_t value, char *buf);
+
+/**
+ * @brief 64 位无符号整数转十进制字符串. 缓冲区至少 XF_U64TOA_BUF_SIZE 字节.
+ *
+ * 按 1e8 拆分后用 32 位运算输出, 32 位 MCU 上最多两次 64 位除法.
+ */
+size_t xf_u64toa(uint64_t value, char *buf);
+
+/**
+ * @brief 64 位有符号整数转十进制字符串. 缓冲区至少 XF_I64TOA_BUF_SIZE 字节.
+ */
+size_t xf_i64toa(int64_t value, char *buf);
+
+/**
+ * @brief 解析十进制无符号整数. 遇到非数字字符或 len 个字符后停止, 不跳过空白.
+ *
+ * @param str 字符串, 不要求以 '\0' 结尾.
+ * @param len 最多解析的字符数, 以 '\0' 结尾的字符串可传 SIZE_MAX.
+ * @param value 解析结果, 失败时不修改.
+ * @return size_t 解析的字符数; 0 表示没有数字或超出 uint32_t 范围.
+ */
+size_t xf_atou(const char *str, size_t len, uint32_t *value);
+
+/**
+ * @brief 解析十进制有符号整数, 允许一个前导 '+' 或 '-'. 参数同 xf_atou().
+ */
+size_t xf_atoi(const char *str, size_t len, int32_t *value);
+
+/**
+ * @brief 解析十六进制无符号整数, 允许 "0x"/"0X" 前缀, 不区分大小写. 参数同 xf_atou().
+ */
+size_t xf_hextou(const char *str, size_t len, uint32_t *value);
+
 /* ==================== [Macros] ============================================ */
 
 #ifdef __cplusplus
@@ -0,0 +1,638 @@
+/**
+ * @file xf_string.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 内置的 memcpy/memset/memcmp/strlen.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_string.h"
+
+#if XF_STRING_BUILTIN_IS_ENABLE
+
+#include "xf_stdint.h"
+#include "../xf_common/xf_bit_defs.h"
+
+#if XF_STRING_BUILTIN_SIMD_IS_ENABLE && defined(__SSE2__)
+#   include <emmintrin.h>
+#   define USE_SSE2                     (1)
+#elif XF_STRING_BUILTIN_SIMD_IS_ENABLE && defined(__ARM_NEON) && defined(__aarch64__)
+#   include <arm_neon.h>
+#   define USE_NEON                     (1)
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#if defined(USE_SSE2) || defined(USE_NEON)
+#   define USE_SIMD                     (1)
+#   define VSIZE                        (16)
+#endif
+
+/* 可以用普通的 load/store 访问非对齐地址（需要编译器支持 packed 结构体） */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__) \
+        || defined(__aarch64__) || defined(__ARM_FEATURE_UNALIGNED))
+#   define UNALIGNED_OK                 (1)
+#else
+#   define UNALIGNED_OK                 (0)
+#endif
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#   define BIG_ENDIAN_WORD              (1)
+#else
+#   define BIG_ENDIAN_WORD              (0)
+#endif
+
+#define WSIZE                           (sizeof(word_t))
+#define WMASK                           (WSIZE - 1)
+/* 每个字节都为 0x01 / 0x80 的字 */
+#define WORD_ONES                       ((word_t)-1 / 0xff)
+#define WORD_HIGHS                      (WORD_ONES << 7)
+/* 字中是否有为 0 的字节 */
+#define WORD_HAS_ZERO(w)                ((((w) - WORD_ONES) & ~(w) & WORD_HIGHS) != 0)
+
+/*
+ * 编译器会把逐字节/逐字的循环识别为 memcpy/memset 并替换为库函数调用,
+ * 这里要实现的正是这些函数, 需要关闭该优化.
+ */
+#if defined(__clang__)
+#   define NO_LIBCALL                   __attribute__((no_builtin))
+#elif defined(__GNUC__)
+#   define NO_LIBCALL                   __attribute__((optimize("no-tree-loop-distribute-patterns")))
+#else
+#   define NO_LIBCALL
+#endif
+
+/* strlen 会读到字符串结尾之后同一个对齐块内的字节 */
+#if defined(__GNUC__)
+#   define NO_ASAN                      __attribute__((no_sanitize_address))
+#else
+#   define NO_ASAN
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+#if defined(__GNUC__)
+typedef uintptr_t __attribute__((__may_alias__)) word_t;
+#else
+typedef uintptr_t word_t;
+#endif
+
+#if UNALIGNED_OK
+typedef struct __attribute__((packed, __may_alias__)) {
+    uint16_t v;
+} u16_unaligned_t;
+typedef struct __attribute__((packed, __may_alias__)) {
+    uint32_t v;
+} u32_unaligned_t;
+typedef struct __attribute__((packed, __may_alias__)) {
+    uint64_t v;
+} u64_unaligned_t;
+typedef struct __attribute__((packed, __may_alias__)) {
+    word_t v;
+} word_unaligned_t;
+#endif
+
+#if defined(USE_SSE2)
+typedef __m128i vec_t;
+#elif defined(USE_NEON)
+typedef uint8x16_t vec_t;
+#endif
+
+/* ==================== [Static Prototypes] ================================= */
+
+#if UNALIGNED_OK
+static inline word_t _load_word(const uint8_t *p);
+static inline void _copy_small(uint8_t *d, const uint8_t *s, size_t n);
+static inline void _set_small(uint8_t *d, uint8_t c, size_t n);
+#endif
+
+#if defined(USE_SIMD)
+static inline vec_t _vload(const void *p);
+NO_ASAN static inline vec_t _vload_aligned(const void *p);
+static inline void _vstore(void *p, vec_t v);
+static inline void _vstore_aligned(void *p, vec_t v);
+static inline vec_t _vdup(uint8_t c);
+static inline vec_t _veq(vec_t a, vec_t b);
+static inline vec_t _vand(vec_t a, vec_t b);
+static inline vec_t _vmin(vec_t a, vec_t b);
+static inline uint64_t _vne_mask(vec_t a, vec_t b);
+static inline uint64_t _vzero_mask(vec_t v);
+#endif
+#if defined(USE_NEON)
+static inline uint64_t _vmask(uint8x16_t eq);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#if defined(USE_SSE2)
+/* 掩码中每个字节占 1 位 */
+#   define VMASK_SHIFT                  (0)
+#elif defined(USE_NEON)
+/* 掩码中每个字节占 4 位 */
+#   define VMASK_SHIFT                  (2)
+#endif
+
+/* ==================== [Global Functions] ================================== */
+
+NO_LIBCALL void *xf_builtin_memcpy(void *dest, const void *src, size_t n)
+{
+    uint8_t *d = (uint8_t *)dest;
+    const uint8_t *s = (const uint8_t *)src;
+
+#if UNALIGNED_OK
+    if (n <= 16) {
+        _copy_small(d, s, n);
+        return dest;
+    }
+#endif
+
+#if defined(USE_SIMD)
+    if (n >= VSIZE) {
+        /* 首尾各用一次非对齐访问覆盖, 中间按目标地址对齐拷贝 */
+        vec_t head = _vload(s);
+        vec_t tail = _vload(s + n - VSIZE);
+        if ((n > 2 * VSIZE) && (n <= 4 * VSIZE)) {
+            vec_t head2 = _vload(s + VSIZE);
+            vec_t tail2 = _vload(s + n - 2 * VSIZE);
+            _vstore(d + VSIZE, head2);
+            _vstore(d + n - 2 * VSIZE, tail2);
+        } else if (n > 4 * VSIZE) {
+            size_t skip = VSIZE - ((uintptr_t)d & (VSIZE - 1));
+            uint8_t *dd = d + skip;
+            const uint8_t *ss = s + skip;
+            size_t left = n - skip;
+            while (left >= 4 * VSIZE) {
+                vec_t v0 = _vload(ss);
+                vec_t v1 = _vload(ss + VSIZE);
+                vec_t v2 = _vload(ss + 2 * VSIZE);
+                vec_t v3 = _vload(ss + 3 * VSIZE);
+                _vstore_aligned(dd, v0);
+                _vstore_aligned(dd + VSIZE, v1);
+                _vstore_aligned(dd + 2 * VSIZE, v2);
+                _vstore_aligned(dd + 3 * VSIZE, v3);
+                dd += 4 * VSIZE;
+                ss += 4 * VSIZE;
+                left -= 4 * VSIZE;
+            }
+            while (left >= VSIZE) {
+                _vstore_aligned(dd, _vload(ss));
+                dd += VSIZE;
+                ss += VSIZE;
+                left -= VSIZE;
+            }
+        }
+        _vstore(d, head);
+        _vstore(d + n - VSIZE, tail);
+        return dest;
+    }
+#endif
+
+    while ((n > 0) && ((uintptr_t)d & WMASK)) {
+        *d++ = *s++;
+        n--;
+    }
+
+#if UNALIGNED_OK
+    while (n >= 4 * WSIZE) {
+        word_t w0 = _load_word(s);
+        word_t w1 = _load_word(s + WSIZE);
+        word_t w2 = _load_word(s + 2 * WSIZE);
+        word_t w3 = _load_word(s + 3 * WSIZE);
+        ((word_t *)d)[0] = w0;
+        ((word_t *)d)[1] = w1;
+        ((word_t *)d)[2] = w2;
+        ((word_t *)d)[3] = w3;
+        d += 4 * WSIZE;
+        s += 4 * WSIZE;
+        n -= 4 * WSIZE;
+    }
+    while (n >= WSIZE) {
+        *(word_t *)d = _load_word(s);
+        d += WSIZE;
+        s += WSIZE;
+        n -= WSIZE;
+    }
+#else
+    size_t off = (uintptr_t)s & WMASK;
+    if (0 == off) {
+        while (n >= 4 * WSIZE) {
+            ((word_t *)d)[0] = ((const word_t *)s)[0];
+            ((word_t *)d)[1] = ((const word_t *)s)[1];
+            ((word_t *)d)[2] = ((const word_t *)s)[2];
+            ((word_t *)d)[3] = ((const word_t *)s)[3];
+            d += 4 * WSIZE;
+            s += 4 * WSIZE;
+            n -= 4 * WSIZE;
+        }
+        while (n >= WSIZE) {
+            *(word_t *)d = *(const word_t *)s;
+            d += WSIZE;
+            s += WSIZE;
+            n -= WSIZE;
+        }
+    } else if (n >= WSIZE) {
+        /* 源地址未对齐: 读对齐的字, 相邻两个字移位拼接后写出 */
+        const word_t *sw = (const word_t *)(s - off);
+        unsigned int sh = (unsigned int)(off * 8);
+        word_t w0 = *sw++;
+        while (n >= WSIZE) {
+            word_t w1 = *sw++;
+#if BIG_ENDIAN_WORD
+            *(word_t *)d = (w0 << sh) | (w1 >> (WSIZE * 8 - sh));
+#else
+            *(word_t *)d = (w0 >> sh) | (w1 << (WSIZE * 8 - sh));
+#endif
+            w0 = w1;
+            d += WSIZE;
+            s += WSIZE;
+            n -= WSIZE;
+        }
+    }
+#endif
+
+    while (n > 0) {
+        *d++ = *s++;
+        n--;
+    }
+    return dest;
+}
+
+NO_LIBCALL void *xf_builtin_memset(void *ptr, int value, size_t n)
+{
+    uint8_t *d = (uint8_t *)ptr;
+    uint8_t c = (uint8_t)value;
+
+#if UNALIGNED_OK
+    if (n <= 16) {
+        _set_small(d, c, n);
+        return ptr;
+    }
+#endif
+
+#if defined(USE_SIMD)
+    if (n >= VSIZE) {
+        vec_t v = _vdup(c);
+        _vstore(d, v);
+        _vstore(d + n - VSIZE, v);
+        if (n <= 4 * VSIZE) {
+            if (n > 2 * VSIZE) {
+                _vstore(d + VSIZE, v);
+                _vstore(d + n - 2 * VSIZE, v);
+            }
+            return ptr;
+        }
+        uint8_t *dd = (uint8_t *)(((uintptr_t)d + VSIZE) & ~(uintptr_t)(VSIZE - 1));
+        uint8_t *end = d + n - VSIZE;
+        while (dd + 4 * VSIZE <= end) {
+            _vstore_aligned(dd, v);
+            _vstore_aligned(dd + VSIZE, v);
+            _vstore_aligned(dd + 2 * VSIZE, v);
+            _vstore_aligned(dd + 3 * VSIZE, v);
+            dd += 4 * VSIZE;
+        }
+        while (dd < end) {
+            _vstore_aligned(dd, v);
+            dd += VSIZE;
+        }
+        return ptr;
+    }
+#endif
+
+    while ((n > 0) && ((uintptr_t)d & WMASK)) {
+        *d++ = c;
+        n--;
+    }
+    word_t w = WORD_ONES * c;
+    while (n >= 4 * WSIZE) {
+        ((word_t *)d)[0] = w;
+        ((word_t *)d)[1] = w;
+        ((word_t *)d)[2] = w;
+        ((word_t *)d)[3] = w;
+        d += 4 * WSIZE;
+        n -= 4 * WSIZE;
+    }
+    while (n >= WSIZE) {
+        *(word_t *)d = w;
+        d += WSIZE;
+        n -= WSIZE;
+    }
+    while (n > 0) {
+        *d++ = c;
+        n--;
+    }
+    return ptr;
+}
+
+NO_LIBCALL int xf_builtin_memcmp(const void *a, const void *b, size_t n)
+{
+    const uint8_t *pa = (const uint8_t *)a;
+    const uint8_t *pb = (const uint8_t *)b;
+
+#if defined(USE_SIMD)
+    if (n >= VSIZE) {
+        /* 最后一块与前一块重叠, 前面的字节已确认相等, 不影响结果 */
+        const uint8_t *last = pa + n - VSIZE;
+        ptrdiff_t diff = pb - pa;
+        /* 每次比较 4 块, 合并后只判断一次 */
+        while (pa + 4 * VSIZE <= last) {
+            vec_t e = _vand(_vand(_veq(_vload(pa), _vload(pa + diff)),
+                                  _veq(_vload(pa + VSIZE), _vload(pa + diff + VSIZE))),
+                            _vand(_veq(_vload(pa + 2 * VSIZE), _vload(pa + diff + 2 * VSIZE)),
+                                  _veq(_vload(pa + 3 * VSIZE), _vload(pa + diff + 3 * VSIZE))));
+            if (0 != _vzero_mask(e)) {
+                break;
+            }
+            pa += 4 * VSIZE;
+        }
+        while (1) {
+            if (pa > last) {
+                pa = last;
+            }
+            uint64_t m = _vne_mask(_vload(pa), _vload(pa + diff));
+            if (0 != m) {
+                size_t i = (size_t)xf_bit_ctzll(m) >> VMASK_SHIFT;
+                return (int)pa[i] - (int)pa[diff + (ptrdiff_t)i];
+            }
+            if (pa == last) {
+                return 0;
+            }
+            pa += VSIZE;
+        }
+    }
+#endif
+
+#if UNALIGNED_OK
+    if (n >= WSIZE) {
+#else
+    if ((n >= WSIZE) && (0 == (((uintptr_t)pa ^ (uintptr_t)pb) & WMASK))) {
+        while ((uintptr_t)pa & WMASK) {
+            if (*pa != *pb) {
+                return (int)*pa - (int)*pb;
+            }
+            pa++;
+            pb++;
+            n--;
+        }
+#endif
+        /* 找到第一个不同的字, 再逐字节定位 */
+        while (n >= WSIZE) {
+#if UNALIGNED_OK
+            if (_load_word(pa) != _load_word(pb)) {
+#else
+            if (*(const word_t *)pa != *(const word_t *)pb) {
+#endif
+                break;
+            }
+            pa += WSIZE;
+            pb += WSIZE;
+            n -= WSIZE;
+        }
+    }
+
+    while (n > 0) {
+        if (*pa != *pb) {
+            return (int)*pa - (int)*pb;
+        }
+        pa++;
+        pb++;
+        n--;
+    }
+    return 0;
+}
+
+NO_ASAN NO_LIBCALL size_t xf_builtin_strlen(const char *str)
+{
+#if defined(USE_SIMD)
+    /* 对齐读取不会跨页; 第一块中 str 之前的字节从掩码中移除 */
+    size_t off = (uintptr_t)str & (VSIZE - 1);
+    const char *p = str - off;
+    uint64_t m = _vzero_mask(_vload_aligned(p)) >> (off << VMASK_SHIFT);
+    if (0 != m) {
+        return (size_t)xf_bit_ctzll(m) >> VMASK_SHIFT;
+    }
+    while (1) {
+        p += VSIZE;
+        /* 按 4 块对齐后每次检查 4 块（不会跨越页边界）, 取逐字节最小值后只判断一次 */
+        if (0 == ((uintptr_t)p & (4 * VSIZE - 1))) {
+            while (0 == _vzero_mask(_vmin(
+                                        _vmin(_vload_aligned(p), _vload_aligned(p + VSIZE)),
+                                        _vmin(_vload_aligned(p + 2 * VSIZE),
+                                              _vload_aligned(p + 3 * VSIZE))))) {
+                p += 4 * VSIZE;
+            }
+        }
+        m = _vzero_mask(_vload_aligned(p));
+        if (0 != m) {
+            return (size_t)(p - str) + ((size_t)xf_bit_ctzll(m) >> VMASK_SHIFT);
+        }
+    }
+#else
+    const char *p = str;
+    while ((uintptr_t)p & WMASK) {
+        if ('\0' == *p) {
+            return (size_t)(p - str);
+        }
+        p++;
+    }
+    const word_t *w = (const word_t *)p;
+    while (!WORD_HAS_ZERO(*w)) {
+        w++;
+    }
+    p = (const char *)w;
+    while ('\0' != *p) {
+        p++;
+    }
+    return (size_t)(p - str);
+#endif
+}
+
+/* ==================== [Static Functions] ================================== */
+
+#if UNALIGNED_OK
+
+static inline word_t _load_word(const uint8_t *p)
+{
+    return ((const word_unaligned_t *)p)->v;
+}
+
+/**
+ * @brief 拷贝 0~16 字节. 首尾两次访问相互重叠, 不需要逐字节循环.
+ */
+static inline void _copy_small(uint8_t *d, const uint8_t *s, size_t n)
+{
+    if (n >= 8) {
+        uint64_t x = ((const u64_unaligned_t *)s)->v;
+        uint64_t y = ((const u64_unaligned_t *)(s + n - 8))->v;
+        ((u64_unaligned_t *)d)->v = x;
+        ((u64_unaligned_t *)(d + n - 8))->v = y;
+    } else if (n >= 4) {
+        uint32_t x = ((const u32_unaligned_t *)s)->v;
+        uint32_t y = ((const u32_unaligned_t *)(s + n - 4))->v;
+        ((u32_unaligned_t *)d)->v = x;
+        ((u32_unaligned_t *)(d + n - 4))->v = y;
+    } else if (n >= 2) {
+        uint16_t x = ((const u16_unaligned_t *)s)->v;
+        uint16_t y = ((const u16_unaligned_t *)(s + n - 2))->v;
+        ((u16_unaligned_t *)d)->v = x;
+        ((u16_unaligned_t *)(d + n - 2))->v = y;
+    } else if (n > 0) {
+        *d = *s;
+    }
+}
+
+static inline void _set_small(uint8_t *d, uint8_t c, size_t n)
+{
+    if (n >= 8) {
+        uint64_t x = 0x0101010101010101ULL * c;
+        ((u64_unaligned_t *)d)->v = x;
+        ((u64_unaligned_t *)(d + n - 8))->v = x;
+    } else if (n >= 4) {
+        uint32_t x = 0x01010101UL * c;
+        ((u32_unaligned_t *)d)->v = x;
+        ((u32_unaligned_t *)(d + n - 4))->v = x;
+    } else if (n >= 2) {
+        uint16_t x = (uint16_t)(0x0101u * c);
+        ((u16_unaligned_t *)d)->v = x;
+        ((u16_unaligned_t *)(d + n - 2))->v = x;
+    } else if (n > 0) {
+        *d = c;
+    }
+}
+
+#endif /* UNALIGNED_OK */
+
+#if defined(USE_SSE2)
+
+static inline vec_t _vload(const void *p)
+{
+    return _mm_loadu_si128((const __m128i *)p);
+}
+
+NO_ASAN static inline vec_t _vload_aligned(const void *p)
+{
+    return _mm_load_si128((const __m128i *)p);
+}
+
+static inline void _vstore(void *p, vec_t v)
+{
+    _mm_storeu_si128((__m128i *)p, v);
+}
+
+static inline void _vstore_aligned(void *p, vec_t v)
+{
+    _mm_store_si128((__m128i *)p, v);
+}
+
+static inline vec_t _vdup(uint8_t c)
+{
+    return _mm_set1_epi8((char)c);
+}
+
+/**
+ * @brief 逐字节比较, 相等为 0xff.
+ */
+static inline vec_t _veq(vec_t a, vec_t b)
+{
+    return _mm_cmpeq_epi8(a, b);
+}
+
+static inline vec_t _vand(vec_t a, vec_t b)
+{
+    return _mm_and_si128(a, b);
+}
+
+/**
+ * @brief 逐字节无符号最小值.
+ */
+static inline vec_t _vmin(vec_t a, vec_t b)
+{
+    return _mm_min_epu8(a, b);
+}
+
+/**
+ * @brief 不相等字节的掩码, 每个字节 1 位.
+ */
+static inline uint64_t _vne_mask(vec_t a, vec_t b)
+{
+    return (uint64_t)(~_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) & 0xffff);
+}
+
+/**
+ * @brief 为 0 的字节的掩码, 每个字节 1 位.
+ */
+static inline uint64_t _vzero_mask(vec_t v)
+{
+    return (uint64_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+}
+
+#elif defined(USE_NEON)
+
+static inline vec_t _vload(const void *p)
+{
+    return vld1q_u8((const uint8_t *)p);
+}
+
+NO_ASAN static inline vec_t _vload_aligned(const void *p)
+{
+    return vld1q_u8((const uint8_t *)p);
+}
+
+static inline void _vstore(void *p, vec_t v)
+{
+    vst1q_u8((uint8_t *)p, v);
+}
+
+static inline void _vstore_aligned(void *p, vec_t v)
+{
+    vst1q_u8((uint8_t *)p, v);
+}
+
+static inline vec_t _vdup(uint8_t c)
+{
+    return vdupq_n_u8(c);
+}
+
+/**
+ * @brief 将比较结果（每字节 0x00/0xff）压缩为 64 位掩码, 每个字节 4 位.
+ */
+static inline uint64_t _vmask(uint8x16_t eq)
+{
+    uint8x8_t nib = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nib), 0);
+}
+
+static inline vec_t _veq(vec_t a, vec_t b)
+{
+    return vceqq_u8(a, b);
+}
+
+static inline vec_t _vand(vec_t a, vec_t b)
+{
+    return vandq_u8(a, b);
+}
+
+static inline vec_t _vmin(vec_t a, vec_t b)
+{
+    return vminq_u8(a, b);
+}
+
+static inline uint64_t _vne_mask(vec_t a, vec_t b)
+{
+    return ~_vmask(vceqq_u8(a, b));
+}
+
+static inline uint64_t _vzero_mask(vec_t v)
+{
+    return _vmask(vceqzq_u8(v));
+}
+
+#endif /* USE_SSE2 / USE_NEON */
+
+#endif /* XF_STRING_BUILTIN_IS_ENABLE */
@@ -20,6 +20,10 @@
 #include <string.h>
 #endif
 
+#if XF_STRING_BUILTIN_IS_ENABLE
+#include <stddef.h>
+#endif
+
 /**
  * @cond XFAPI_USER
  * @ingroup group_xf_utils_std
@@ -47,6 +51,33 @@ extern "C" {
 #define xf_strncmp(dest, src, n)       xf_user_strncmp((dest), (src), (n))
 #define xf_strlen(str)                 xf_user_strlen((str))
 
+#if XF_STRING_BUILTIN_IS_ENABLE
+
+/**
+ * @brief 内置的 memcpy. 先按目标地址对齐, 再按机器字（或 SIMD 寄存器）拷贝.
+ *        不支持非对齐访问的平台上, 源地址未对齐时按移位拼接处理.
+ */
+void *xf_builtin_memcpy(void *dest, const void *src, size_t n);
+
+/**
+ * @brief 内置的 memset. 先按地址对齐, 再按机器字（或 SIMD 寄存器）填充.
+ */
+void *xf_builtin_memset(void *ptr, int value, size_t n);
+
+/**
+ * @brief 内置的 memcmp. 按机器字（或 SIMD 寄存器）比较, 找到不同的字后再定位字节.
+ */
+int xf_builtin_memcmp(const void *a, const void *b, size_t n);
+
+/**
+ * @brief 内置的 strlen. 按对齐的机器字（或 SIMD 寄存器）查找 '\0'.
+ *
+ * @note 对齐的读取不会跨越页边界, 但可能读到字符串结尾之后同一个字内的字节.
+ */
+size_t xf_builtin_strlen(const char *str);
+
+#endif /* XF_STRING_BUILTIN_IS_ENABLE */
+
 /* ==================== [Macros] ============================================ */
 
 #ifdef __cplusplus
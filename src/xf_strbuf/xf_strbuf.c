@@ -0,0 +1,268 @@
+/**
+ * @file xf_strbuf.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 带内联小缓冲区的可增长字符串构建器。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_strbuf.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_std/xf_string.h"
+#include "../xf_std/xf_stdio.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define INLINE_CAP                      (XF_STRBUF_INLINE_SIZE - 1)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _reset(xf_strbuf_t *sb);
+static xf_err_t _grow(xf_strbuf_t *sb, size_t extra);
+
+/* ==================== [Static Variables] ================================== */
+
+static const char s_hex[] = "0123456789abcdef";
+
+/* ==================== [Macros] ============================================ */
+
+/* 保证 len + extra 字节可用, 绝大多数追加只走这一次比较 */
+#define _ENSURE(sb, extra) \
+    ((((extra) <= (sb)->cap - (sb)->len)) ? XF_OK : _grow((sb), (extra)))
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_strbuf_init(xf_strbuf_t *sb)
+{
+    if (NULL == sb) {
+        return XF_ERR_INVALID_ARG;
+    }
+    _reset(sb);
+    return XF_OK;
+}
+
+void xf_strbuf_deinit(xf_strbuf_t *sb)
+{
+    if (NULL == sb) {
+        return;
+    }
+    if (xf_strbuf_is_heap(sb)) {
+        xf_free(sb->data);
+    }
+    _reset(sb);
+}
+
+xf_err_t xf_strbuf_reserve(xf_strbuf_t *sb, size_t extra)
+{
+    if (NULL == sb) {
+        return XF_ERR_INVALID_ARG;
+    }
+    return _ENSURE(sb, extra);
+}
+
+xf_err_t xf_strbuf_append(xf_strbuf_t *sb, const void *data, size_t len)
+{
+    if ((NULL == sb) || ((NULL == data) && (len > 0))) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_err_t err = _ENSURE(sb, len);
+    if (XF_OK != err) {
+        return err;
+    }
+    xf_memcpy(sb->data + sb->len, data, len);
+    sb->len += len;
+    sb->data[sb->len] = '\0';
+    return XF_OK;
+}
+
+xf_err_t xf_strbuf_append_str(xf_strbuf_t *sb, const char *str)
+{
+    if (NULL == str) {
+        return XF_ERR_INVALID_ARG;
+    }
+    return xf_strbuf_append(sb, str, xf_strlen(str));
+}
+
+xf_err_t xf_strbuf_append_char(xf_strbuf_t *sb, char c)
+{
+    if (NULL == sb) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_err_t err = _ENSURE(sb, 1);
+    if (XF_OK != err) {
+        return err;
+    }
+    sb->data[sb->len++] = c;
+    sb->data[sb->len] = '\0';
+    return XF_OK;
+}
+
+xf_err_t xf_strbuf_vappendf(xf_strbuf_t *sb, const char *format, va_list ap)
+{
+    if ((NULL == sb) || (NULL == format)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    size_t room = sb->cap - sb->len;
+    va_list ap_try;
+
+    /* 先按剩余空间格式化, 不够时得到所需长度 */
+    va_copy(ap_try, ap);
+    int n = xf_vsnprintf(sb->data + sb->len, room + 1, format, ap_try);
+    va_end(ap_try);
+    if (n < 0) {
+        sb->data[sb->len] = '\0';
+        return XF_FAIL;
+    }
+    if ((size_t)n > room) {
+        xf_err_t err = _grow(sb, (size_t)n);
+        if (XF_OK != err) {
+            sb->data[sb->len] = '\0';
+            return err;
+        }
+        n = xf_vsnprintf(sb->data + sb->len, (size_t)n + 1, format, ap);
+        if (n < 0) {
+            sb->data[sb->len] = '\0';
+            return XF_FAIL;
+        }
+    }
+    sb->len += (size_t)n;
+    return XF_OK;
+}
+
+xf_err_t xf_strbuf_appendf(xf_strbuf_t *sb, const char *format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+    xf_err_t err = xf_strbuf_vappendf(sb, format, ap);
+    va_end(ap);
+    return err;
+}
+
+xf_err_t xf_strbuf_append_hex(xf_strbuf_t *sb, const void *data, size_t len)
+{
+    if ((NULL == sb) || ((NULL == data) && (len > 0))) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (len > (SIZE_MAX / 2)) {
+        return XF_ERR_NO_MEM;
+    }
+    xf_err_t err = _ENSURE(sb, len * 2);
+    if (XF_OK != err) {
+        return err;
+    }
+    const uint8_t *src = (const uint8_t *)data;
+    char *p = sb->data + sb->len;
+    for (size_t i = 0; i < len; i++) {
+        *p++ = s_hex[src[i] >> 4];
+        *p++ = s_hex[src[i] & 0x0f];
+    }
+    *p = '\0';
+    sb->len += len * 2;
+    return XF_OK;
+}
+
+xf_err_t xf_strbuf_append_u64(xf_strbuf_t *sb, uint64_t value)
+{
+    if (NULL == sb) {
+        return XF_ERR_INVALID_ARG;
+    }
+    /* xf_u64toa 连同 '\0' 一起写入 */
+    xf_err_t err = _ENSURE(sb, XF_U64TOA_BUF_SIZE - 1);
+    if (XF_OK != err) {
+        return err;
+    }
+    sb->len += xf_u64toa(value, sb->data + sb->len);
+    return XF_OK;
+}
+
+xf_err_t xf_strbuf_append_i64(xf_strbuf_t *sb, int64_t value)
+{
+    if (NULL == sb) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_err_t err = _ENSURE(sb, XF_I64TOA_BUF_SIZE - 1);
+    if (XF_OK != err) {
+        return err;
+    }
+    sb->len += xf_i64toa(value, sb->data + sb->len);
+    return XF_OK;
+}
+
+void xf_strbuf_truncate(xf_strbuf_t *sb, size_t len)
+{
+    if ((NULL == sb) || (len >= sb->len)) {
+        return;
+    }
+    sb->len = len;
+    sb->data[len] = '\0';
+}
+
+char *xf_strbuf_steal(xf_strbuf_t *sb, size_t *len)
+{
+    if (NULL == sb) {
+        return NULL;
+    }
+    char *str = sb->data;
+    size_t n = sb->len;
+    if (!xf_strbuf_is_heap(sb)) {
+        str = (char *)xf_malloc(n + 1);
+        if (NULL == str) {
+            return NULL;
+        }
+        xf_memcpy(str, sb->data, n + 1);
+    }
+    _reset(sb);
+    if (NULL != len) {
+        *len = n;
+    }
+    return str;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _reset(xf_strbuf_t *sb)
+{
+    sb->data = sb->inline_buf;
+    sb->len = 0;
+    sb->cap = INLINE_CAP;
+    sb->inline_buf[0] = '\0';
+}
+
+/**
+ * @brief 扩容以容纳 len + extra 字节. 新容量至少为原来的 2 倍.
+ */
+static xf_err_t _grow(xf_strbuf_t *sb, size_t extra)
+{
+    if (extra > SIZE_MAX - 1 - sb->len) {
+        return XF_ERR_NO_MEM;
+    }
+    size_t need = sb->len + extra;
+    size_t cap = (sb->cap + 1 < XF_STRBUF_MIN_HEAP_SIZE)
+                 ? (XF_STRBUF_MIN_HEAP_SIZE - 1) : sb->cap;
+    while (cap < need) {
+        /* 溢出时直接按所需大小分配 */
+        if (cap > (SIZE_MAX - 1) / 2) {
+            cap = need;
+            break;
+        }
+        cap = cap * 2 + 1;
+    }
+    char *buf = (char *)xf_malloc(cap + 1);
+    if (NULL == buf) {
+        return XF_ERR_NO_MEM;
+    }
+    xf_memcpy(buf, sb->data, sb->len + 1);
+    if (xf_strbuf_is_heap(sb)) {
+        xf_free(sb->data);
+    }
+    sb->data = buf;
+    sb->cap = cap;
+    return XF_OK;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file xf_strbuf.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 带内联小缓冲区的可增长字符串构建器。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * - 字符串不超过 XF_STRBUF_INLINE_SIZE - 1 字节时只使用结构体内的缓冲区,
+ *   不分配堆内存;
+ * - 超出后通过 xf_malloc 转到堆上, 容量按 2 倍增长, 追加操作均摊 O(1);
+ * - 内容始终以 '\0' 结尾, 可直接通过 xf_strbuf_cstr() 使用;
+ * - xf_strbuf_steal() 直接交出堆缓冲区, 不复制.
+ *
+ * @attention 构建器内部可能指向自身的内联缓冲区, 不能按值复制或移动.
+ *            构建器不是线程安全的.
+ */
+
+#ifndef __XF_STRBUF_H__
+#define __XF_STRBUF_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include <stdarg.h>
+
+#include "xf_strbuf_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_strbuf xf_strbuf
+ * @brief 可增长字符串构建器, 小字符串不分配内存。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 字符串构建器.
+ */
+typedef struct xf_strbuf_s {
+    char       *data;                   /*!< 指向 inline_buf 或堆缓冲区 */
+    size_t      len;                    /*!< 字符串长度（不含 '\0'） */
+    size_t      cap;                    /*!< 可容纳的字符串长度（不含 '\0'） */
+    char        inline_buf[XF_STRBUF_INLINE_SIZE];
+} xf_strbuf_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化为空字符串, 使用内联缓冲区.
+ *
+ * @param sb 构建器.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_strbuf_init(xf_strbuf_t *sb);
+
+/**
+ * @brief 释放堆缓冲区（如有）, 并重置为空字符串.
+ *
+ * @param sb 构建器.
+ */
+void xf_strbuf_deinit(xf_strbuf_t *sb);
+
+/**
+ * @brief 确保还能追加 extra 字节而不再分配内存.
+ *
+ * @param sb 构建器.
+ * @param extra 需要追加的字节数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足, 内容不变
+ */
+xf_err_t xf_strbuf_reserve(xf_strbuf_t *sb, size_t extra);
+
+/**
+ * @brief 追加 len 字节. 数据中可以含有 '\0'.
+ *
+ * @param sb 构建器.
+ * @param data 数据.
+ * @param len 字节数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足, 内容不变
+ */
+xf_err_t xf_strbuf_append(xf_strbuf_t *sb, const void *data, size_t len);
+
+/**
+ * @brief 追加 C 字符串.
+ *
+ * @param sb 构建器.
+ * @param str 以 '\0' 结尾的字符串.
+ * @return xf_err_t 同 xf_strbuf_append().
+ */
+xf_err_t xf_strbuf_append_str(xf_strbuf_t *sb, const char *str);
+
+/**
+ * @brief 追加一个字符.
+ *
+ * @param sb 构建器.
+ * @param c 字符.
+ * @return xf_err_t 同 xf_strbuf_append().
+ */
+xf_err_t xf_strbuf_append_char(xf_strbuf_t *sb, char c);
+
+/**
+ * @brief 按格式追加, 格式化由 xf_vsnprintf 完成.
+ *
+ * 剩余空间足够时只格式化一次; 否则按所需长度扩容后再格式化一次.
+ *
+ * @param sb 构建器.
+ * @param format 格式.
+ * @param ap 参数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足, 内容不变
+ *      - XF_FAIL               格式化失败, 内容不变
+ */
+xf_err_t xf_strbuf_vappendf(xf_strbuf_t *sb, const char *format, va_list ap);
+
+/**
+ * @brief 同 xf_strbuf_vappendf(), 参数为可变参数.
+ */
+xf_err_t xf_strbuf_appendf(xf_strbuf_t *sb, const char *format, ...);
+
+/**
+ * @brief 以小写十六进制追加 len 字节, 每字节两个字符, 无分隔符.
+ *
+ * @param sb 构建器.
+ * @param data 数据.
+ * @param len 字节数.
+ * @return xf_err_t 同 xf_strbuf_append().
+ */
+xf_err_t xf_strbuf_append_hex(xf_strbuf_t *sb, const void *data, size_t len);
+
+/**
+ * @brief 以十进制追加无符号整数, 不经过格式化.
+ *
+ * @param sb 构建器.
+ * @param value 数值.
+ * @return xf_err_t 同 xf_strbuf_append().
+ */
+xf_err_t xf_strbuf_append_u64(xf_strbuf_t *sb, uint64_t value);
+
+/**
+ * @brief 以十进制追加有符号整数, 不经过格式化.
+ *
+ * @param sb 构建器.
+ * @param value 数值.
+ * @return xf_err_t 同 xf_strbuf_append().
+ */
+xf_err_t xf_strbuf_append_i64(xf_strbuf_t *sb, int64_t value);
+
+/**
+ * @brief 截断到 len 字节. len 不小于当前长度时不做任何事, 不释放内存.
+ *
+ * @param sb 构建器.
+ * @param len 新长度.
+ */
+void xf_strbuf_truncate(xf_strbuf_t *sb, size_t len);
+
+/**
+ * @brief 取走字符串, 构建器重置为空字符串（内联缓冲区）.
+ *
+ * 内容在堆上时直接交出缓冲区, 不复制; 仍在内联缓冲区时复制到
+ * 新分配的内存中.
+ *
+ * @param sb 构建器.
+ * @param[out] len 字符串长度, 可为 NULL.
+ * @return char* 以 '\0' 结尾的字符串, 由调用者通过 xf_free 释放.
+ *      内存不足时返回 NULL, 构建器内容不变.
+ */
+char *xf_strbuf_steal(xf_strbuf_t *sb, size_t *len);
+
+/**
+ * @brief 获取以 '\0' 结尾的字符串. 在下一次修改前有效.
+ *
+ * @param sb 构建器.
+ * @return const char* 字符串.
+ */
+static inline const char *xf_strbuf_cstr(const xf_strbuf_t *sb)
+{
+    return sb->data;
+}
+
+/**
+ * @brief 获取字符串长度（不含 '\0'）.
+ *
+ * @param sb 构建器.
+ * @return size_t 长度.
+ */
+static inline size_t xf_strbuf_len(const xf_strbuf_t *sb)
+{
+    return sb->len;
+}
+
+/**
+ * @brief 内容是否在堆上.
+ *
+ * @param sb 构建器.
+ * @return bool
+ *      - true          在堆上
+ *      - false         在内联缓冲区中
+ */
+static inline bool xf_strbuf_is_heap(const xf_strbuf_t *sb)
+{
+    return sb->data != sb->inline_buf;
+}
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 清空字符串, 保留已分配的容量.
+ */
+#define xf_strbuf_clear(sb)             xf_strbuf_truncate((sb), 0)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_strbuf
+ * @}
+ */
+
+#endif // __XF_STRBUF_H__
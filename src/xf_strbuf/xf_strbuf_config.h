@@ -0,0 +1,53 @@
+/**
+ * @file xf_strbuf_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 字符串构建器配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_STRBUF_CONFIG_H__
+#define __XF_STRBUF_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 内联缓冲区字节数（含 '\0'）. 不超过该长度的字符串不分配堆内存.
+ */
+#if !defined(XF_STRBUF_INLINE_SIZE)
+#   define XF_STRBUF_INLINE_SIZE        (64)
+#endif
+
+/**
+ * @brief 首次转到堆上时的最小容量（含 '\0'）, 之后按 2 倍增长.
+ */
+#if !defined(XF_STRBUF_MIN_HEAP_SIZE)
+#   define XF_STRBUF_MIN_HEAP_SIZE      (128)
+#endif
+
+#if (XF_STRBUF_INLINE_SIZE < 1) || (XF_STRBUF_MIN_HEAP_SIZE < 1)
+#   error "xf_strbuf: XF_STRBUF_INLINE_SIZE and XF_STRBUF_MIN_HEAP_SIZE must be positive"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_STRBUF_CONFIG_H__
@@ -0,0 +1,88 @@
+/**
+ * @file xf_thread.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 线程抽象层。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_thread.h"
+#include "xf_thread_port.h"
+#include "../xf_std/xf_stddef.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+static const xf_thread_ops_t *sp_ops = NULL;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_thread_register(const xf_thread_ops_t *const p_ops)
+{
+    if ((NULL == p_ops) || (NULL == p_ops->create) || (NULL == p_ops->join)) {
+        return XF_FAIL;
+    }
+    sp_ops = p_ops;
+    return XF_OK;
+}
+
+xf_err_t xf_thread_create(xf_thread_t *p_thread, xf_thread_func_t func, void *arg)
+{
+    if ((NULL == p_thread) || (NULL == func)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (NULL == sp_ops) {
+        return XF_FAIL;
+    }
+    return sp_ops->create(p_thread, func, arg);
+}
+
+xf_err_t xf_thread_join(xf_thread_t thread)
+{
+    if (NULL == thread) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (NULL == sp_ops) {
+        return XF_FAIL;
+    }
+    return sp_ops->join(thread);
+}
+
+void xf_thread_yield(void)
+{
+    if ((NULL == sp_ops) || (NULL == sp_ops->yield)) {
+        return;
+    }
+    sp_ops->yield();
+}
+
+xf_err_t xf_thread_set_affinity(xf_thread_t thread, uint32_t cpu)
+{
+    if ((NULL == sp_ops) || (NULL == sp_ops->set_affinity)) {
+        return XF_ERR_NOT_SUPPORTED;
+    }
+    return sp_ops->set_affinity(thread, cpu);
+}
+
+uint32_t xf_thread_get_cpu_num(void)
+{
+    if ((NULL == sp_ops) || (NULL == sp_ops->get_cpu_num)) {
+        return 1;
+    }
+    uint32_t num = sp_ops->get_cpu_num();
+    return (0 == num) ? 1 : num;
+}
+
+/* ==================== [Static Functions] ================================== */
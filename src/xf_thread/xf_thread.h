@@ -0,0 +1,98 @@
+/**
+ * @file xf_thread.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 线程抽象层。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_THREAD_H__
+#define __XF_THREAD_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_thread_types.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_thread xf_thread
+ * @brief 线程接口（创建、等待、让出、绑核）, 需对接具体实现。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 创建并启动线程.
+ *
+ * @param[out] p_thread 线程句柄.
+ * @param func 线程入口.
+ * @param arg 传给 func 的参数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_FAIL               未对接或创建失败
+ */
+xf_err_t xf_thread_create(xf_thread_t *p_thread, xf_thread_func_t func, void *arg);
+
+/**
+ * @brief 等待线程结束并释放其资源.
+ *
+ * @param thread 线程句柄, 之后不再有效.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_FAIL               未对接或失败
+ */
+xf_err_t xf_thread_join(xf_thread_t thread);
+
+/**
+ * @brief 让出 CPU. 未对接时为空操作.
+ */
+void xf_thread_yield(void);
+
+/**
+ * @brief 把线程绑定到编号为 cpu 的核上.
+ *
+ * @param thread 线程句柄.
+ * @param cpu 核编号, 0 ~ xf_thread_get_cpu_num() - 1.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    cpu 超出对接支持的范围
+ *      - XF_ERR_NOT_SUPPORTED  未对接
+ *      - XF_FAIL               失败
+ */
+xf_err_t xf_thread_set_affinity(xf_thread_t thread, uint32_t cpu);
+
+/**
+ * @brief 可用的核数.
+ *
+ * @return uint32_t 核数. 未对接时返回 1.
+ */
+uint32_t xf_thread_get_cpu_num(void);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_thread
+ * @}
+ */
+
+#endif /* __XF_THREAD_H__ */
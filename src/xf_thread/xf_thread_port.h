@@ -0,0 +1,59 @@
+/**
+ * @file xf_thread_port.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 线程对接。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_THREAD_PORT_H__
+#define __XF_THREAD_PORT_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_thread_types.h"
+
+/**
+ * @cond XFAPI_PORT
+ * @ingroup group_xf_utils_port
+ * @defgroup group_xf_utils_port_thread xf_thread
+ * @brief 对接 xf_thread 操作集。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 注册线程操作.
+ *
+ * @param p_ops 指向静态线程操作集的指针, 操作集必须在整个程序生命周期中可用.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               失败
+ */
+xf_err_t xf_thread_register(const xf_thread_ops_t *const p_ops);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_port_thread
+ * @}
+ */
+
+#endif /* __XF_THREAD_PORT_H__ */
@@ -0,0 +1,130 @@
+/**
+ * @file xf_thread_types.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 线程通用数据类型。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_THREAD_TYPES_H__
+#define __XF_THREAD_TYPES_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_common/xf_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils_thread
+ * @endcond
+ * @{
+ */
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 线程句柄.
+ */
+typedef void *xf_thread_t;
+
+/**
+ * @brief 线程入口.
+ *
+ * @param arg 创建时传入的参数.
+ */
+typedef void (*xf_thread_func_t)(void *arg);
+
+/**
+ * End of group_xf_utils_thread
+ * @}
+ */
+
+/**
+ * @cond XFAPI_PORT
+ * @ingroup group_xf_utils_port_thread
+ * @endcond
+ * @{
+ */
+
+/**
+ * @brief 创建并启动线程.
+ *
+ * @param[out] p_thread 线程句柄.
+ * @param func 线程入口.
+ * @param arg 传给 func 的参数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               失败
+ */
+typedef xf_err_t (*xf_thread_ops_create_t)(
+    xf_thread_t *p_thread, xf_thread_func_t func, void *arg);
+
+/**
+ * @brief 等待线程结束并释放其资源.
+ *
+ * @param thread 线程句柄, 之后不再有效.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               失败
+ */
+typedef xf_err_t (*xf_thread_ops_join_t)(xf_thread_t thread);
+
+/**
+ * @brief 让出 CPU. 可选.
+ */
+typedef void (*xf_thread_ops_yield_t)(void);
+
+/**
+ * @brief 把线程绑定到编号为 cpu 的核上. 可选.
+ *
+ * @param thread 线程句柄.
+ * @param cpu 核编号, 0 ~ 核数 - 1.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               失败
+ */
+typedef xf_err_t (*xf_thread_ops_set_affinity_t)(xf_thread_t thread, uint32_t cpu);
+
+/**
+ * @brief 可用的核数. 可选.
+ *
+ * @return uint32_t 核数, 至少为 1.
+ */
+typedef uint32_t (*xf_thread_ops_get_cpu_num_t)(void);
+
+/**
+ * @brief 线程操作结构体.
+ *
+ * @attention 至少实现 `create` 与 `join`.
+ */
+typedef struct xf_thread_ops_s {
+    xf_thread_ops_create_t          create;
+    xf_thread_ops_join_t            join;
+    xf_thread_ops_yield_t           yield;
+    xf_thread_ops_set_affinity_t    set_affinity;
+    xf_thread_ops_get_cpu_num_t     get_cpu_num;
+} xf_thread_ops_t;
+
+/**
+ * End of group_xf_utils_port_thread
+ * @}
+ */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XF_THREAD_TYPES_H__ */
@@ -0,0 +1,565 @@
+/**
+ * @file xf_threadpool.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 工作窃取线程池。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_threadpool.h"
+#include "../xf_common/xf_atomic.h"
+#include "../xf_common/xf_attr.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_thread/xf_thread.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define DEQUE_MASK                      ((uintptr_t)XF_THREADPOOL_DEQUE_SIZE - 1)
+
+#if !defined(XF_THREAD_LOCAL)
+#   error "xf_threadpool: thread-local storage is required"
+#endif
+
+/* 每个工作线程占用的字节数, 向上取整到 XF_THREADPOOL_ALIGN */
+#define WORKER_STRIDE \
+    ((sizeof(worker_t) + XF_THREADPOOL_ALIGN - 1) & ~((size_t)XF_THREADPOOL_ALIGN - 1))
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 工作线程及其 Chase-Lev 双端队列.
+ *
+ * top 只被窃取者 CAS 推进, 单独占一个缓存行; bottom 与队列只有所有者修改.
+ * 两者只增不减, 用无符号数回绕, 比较一律通过有符号的差值 (intptr_t)(b - t).
+ * 内存序见 N. M. Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models".
+ */
+typedef struct {
+    uintptr_t               top;
+    uint8_t                 pad[XF_THREADPOOL_ALIGN - sizeof(uintptr_t)];
+    uintptr_t               bottom;
+    xf_threadpool_t        *pool;
+    xf_thread_t             thread;
+    uint32_t                id;
+    xf_threadpool_task_t   *buf[XF_THREADPOOL_DEQUE_SIZE];
+} worker_t;
+
+/**
+ * @brief xf_threadpool_parallel_for() 的共享状态.
+ */
+typedef struct {
+    size_t                      next;   /*!< 下一块的起点, 原子推进 */
+    size_t                      end;
+    size_t                      grain;
+    xf_threadpool_range_cb_t    cb;
+    void                       *arg;
+} pfor_ctx_t;
+
+typedef struct {
+    xf_threadpool_task_t    task;
+    pfor_ctx_t             *ctx;
+} pfor_task_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static bool _deque_push(worker_t *w, xf_threadpool_task_t *task);
+static xf_threadpool_task_t *_deque_pop(worker_t *w);
+static xf_threadpool_task_t *_deque_steal(worker_t *w);
+static worker_t *_self(xf_threadpool_t *pool);
+static xf_threadpool_task_t *_find_task(xf_threadpool_t *pool, worker_t *self);
+static xf_threadpool_task_t *_take_injector(xf_threadpool_t *pool, worker_t *self);
+static xf_threadpool_task_t *_steal_any(xf_threadpool_t *pool, worker_t *self);
+static bool _has_work(xf_threadpool_t *pool);
+static void _notify(xf_threadpool_t *pool, size_t num);
+static void _run(xf_threadpool_task_t *task);
+static void _worker_main(void *arg);
+static void _pfor_body(pfor_ctx_t *ctx);
+static void _pfor_cb(xf_threadpool_task_t *task);
+static uint32_t _rand(void);
+
+/* ==================== [Static Variables] ================================== */
+
+static XF_THREAD_LOCAL worker_t *s_self = NULL;
+static XF_THREAD_LOCAL uint32_t s_seed = 1;
+
+/* ==================== [Macros] ============================================ */
+
+#define _WORKER(pool, i)                ((worker_t *)((pool)->workers + (size_t)(i) * WORKER_STRIDE))
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_threadpool_init(xf_threadpool_t *pool, uint32_t num, bool pin_cpu)
+{
+    if (NULL == pool) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_err_t err = XF_OK;
+    uint32_t cpu_num = xf_thread_get_cpu_num();
+
+    if (0 == num) {
+        num = cpu_num;
+    }
+    if (num > XF_THREADPOOL_MAX_WORKERS) {
+        num = XF_THREADPOOL_MAX_WORKERS;
+    }
+    pool->mem = NULL;
+    pool->workers = NULL;
+    pool->num = 0;
+    pool->started = 0;
+    pool->sleepers = 0;
+    pool->stop = 0;
+    pool->lock = NULL;
+    pool->cond = NULL;
+
+    err = xf_clist_init(&pool->injector, false);
+    if (XF_OK != err) {
+        return err;
+    }
+    if (XF_OK != xf_lock_init(&pool->lock)) {
+        pool->lock = NULL;
+        err = XF_FAIL;
+        goto l_err;
+    }
+    err = xf_cond_init(&pool->cond);
+    if (XF_OK != err) {
+        pool->cond = NULL;
+        goto l_err;
+    }
+    pool->mem = xf_malloc((size_t)num * WORKER_STRIDE + XF_THREADPOOL_ALIGN - 1);
+    if (NULL == pool->mem) {
+        err = XF_ERR_NO_MEM;
+        goto l_err;
+    }
+    pool->workers = (uint8_t *)(((uintptr_t)pool->mem + XF_THREADPOOL_ALIGN - 1)
+                                & ~((uintptr_t)XF_THREADPOOL_ALIGN - 1));
+    for (uint32_t i = 0; i < num; i++) {
+        worker_t *w = _WORKER(pool, i);
+        w->top = 0;
+        w->bottom = 0;
+        w->pool = pool;
+        w->thread = NULL;
+        w->id = i;
+    }
+    pool->num = num;
+
+    for (uint32_t i = 0; i < num; i++) {
+        worker_t *w = _WORKER(pool, i);
+        err = xf_thread_create(&w->thread, _worker_main, w);
+        if (XF_OK != err) {
+            goto l_err;
+        }
+        pool->started = i + 1;
+        if (pin_cpu) {
+            xf_thread_set_affinity(w->thread, i % cpu_num);
+        }
+    }
+    return XF_OK;
+
+l_err:
+    xf_threadpool_deinit(pool);
+    return err;
+}
+
+void xf_threadpool_deinit(xf_threadpool_t *pool)
+{
+    if (NULL == pool) {
+        return;
+    }
+    if (pool->started > 0) {
+        xf_lock_lock(pool->lock);
+        xf_atomic_store(&pool->stop, 1, XF_ATOMIC_RELEASE);
+        xf_cond_broadcast(pool->cond);
+        xf_lock_unlock(pool->lock);
+        for (uint32_t i = 0; i < pool->started; i++) {
+            xf_thread_join(_WORKER(pool, i)->thread);
+        }
+    }
+    if (NULL != pool->mem) {
+        xf_free(pool->mem);
+    }
+    if (NULL != pool->cond) {
+        xf_cond_destroy(pool->cond);
+    }
+    if (NULL != pool->lock) {
+        xf_lock_destroy(pool->lock);
+    }
+    xf_clist_deinit(&pool->injector);
+    pool->mem = NULL;
+    pool->workers = NULL;
+    pool->num = 0;
+    pool->started = 0;
+    pool->lock = NULL;
+    pool->cond = NULL;
+}
+
+xf_err_t xf_threadpool_submit(xf_threadpool_t *pool, xf_threadpool_task_t *task)
+{
+    if ((NULL == pool) || (NULL == task) || (NULL == task->cb)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (NULL != task->group) {
+        xf_atomic_fetch_add(&task->group->pending, 1, XF_ATOMIC_RELAXED);
+    }
+    worker_t *self = _self(pool);
+    if ((NULL == self) || !_deque_push(self, task)) {
+        xf_clist_push_back(&pool->injector, &task->node);
+    }
+    _notify(pool, 1);
+    return XF_OK;
+}
+
+xf_err_t xf_threadpool_submit_batch(
+    xf_threadpool_t *pool, xf_threadpool_task_t *const tasks[], size_t num)
+{
+    if ((NULL == pool) || ((NULL == tasks) && (num > 0))) {
+        return XF_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < num; i++) {
+        if ((NULL == tasks[i]) || (NULL == tasks[i]->cb)) {
+            return XF_ERR_INVALID_ARG;
+        }
+    }
+    if (0 == num) {
+        return XF_OK;
+    }
+    worker_t *self = _self(pool);
+    xf_list_t spill;
+    xf_list_init(&spill);
+
+    for (size_t i = 0; i < num; i++) {
+        xf_threadpool_task_t *task = tasks[i];
+        if (NULL != task->group) {
+            xf_atomic_fetch_add(&task->group->pending, 1, XF_ATOMIC_RELAXED);
+        }
+        if ((NULL == self) || !_deque_push(self, task)) {
+            xf_list_add_tail(&task->node, &spill);
+        }
+    }
+    xf_clist_push_back_list(&pool->injector, &spill);
+    _notify(pool, num);
+    return XF_OK;
+}
+
+void xf_threadpool_group_wait(xf_threadpool_t *pool, xf_threadpool_group_t *group)
+{
+    if ((NULL == pool) || (NULL == group)) {
+        return;
+    }
+    worker_t *self = _self(pool);
+    while (0 != xf_atomic_load(&group->pending, XF_ATOMIC_ACQUIRE)) {
+        xf_threadpool_task_t *task = _find_task(pool, self);
+        if (NULL != task) {
+            _run(task);
+        } else {
+            xf_thread_yield();
+        }
+    }
+}
+
+xf_err_t xf_threadpool_parallel_for(xf_threadpool_t *pool, size_t begin, size_t end,
+                                    size_t grain, xf_threadpool_range_cb_t cb, void *arg)
+{
+    if ((NULL == pool) || (NULL == cb)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (begin >= end) {
+        return XF_OK;
+    }
+    size_t total = end - begin;
+    if (0 == grain) {
+        grain = total / (((size_t)pool->num + 1) * 4);
+        if (0 == grain) {
+            grain = 1;
+        }
+    }
+    size_t chunks = (total - 1) / grain + 1;
+    size_t helpers = (chunks - 1 < pool->num) ? (chunks - 1) : pool->num;
+    if (0 == helpers) {
+        cb(begin, end, arg);
+        return XF_OK;
+    }
+
+    /* 只提交 helpers 个任务, 每个任务循环领取块; 调用者自己也领取 */
+    pfor_ctx_t ctx = {.next = begin, .end = end, .grain = grain, .cb = cb, .arg = arg};
+    pfor_task_t tasks[XF_THREADPOOL_MAX_WORKERS];
+    xf_threadpool_task_t *ptrs[XF_THREADPOOL_MAX_WORKERS];
+    xf_threadpool_group_t group;
+
+    xf_threadpool_group_init(&group);
+    for (size_t i = 0; i < helpers; i++) {
+        xf_threadpool_task_init(&tasks[i].task, _pfor_cb, &group);
+        tasks[i].ctx = &ctx;
+        ptrs[i] = &tasks[i].task;
+    }
+    xf_threadpool_submit_batch(pool, ptrs, helpers);
+    _pfor_body(&ctx);
+    xf_threadpool_group_wait(pool, &group);
+    return XF_OK;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+/**
+ * @brief 所有者在底部压入. 队列满时返回 false.
+ */
+static bool _deque_push(worker_t *w, xf_threadpool_task_t *task)
+{
+    uintptr_t b = xf_atomic_load(&w->bottom, XF_ATOMIC_RELAXED);
+    uintptr_t t = xf_atomic_load(&w->top, XF_ATOMIC_ACQUIRE);
+    if ((intptr_t)(b - t) >= (intptr_t)XF_THREADPOOL_DEQUE_SIZE) {
+        return false;
+    }
+    xf_atomic_store(&w->buf[b & DEQUE_MASK], task, XF_ATOMIC_RELAXED);
+    /* RELEASE: 窃取者 ACQUIRE 读到新的 bottom 后, 也能看到任务的内容 */
+    xf_atomic_store(&w->bottom, b + 1, XF_ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief 所有者从底部弹出. 只剩一个任务时与窃取者竞争 top.
+ */
+static xf_threadpool_task_t *_deque_pop(worker_t *w)
+{
+    uintptr_t b = xf_atomic_load(&w->bottom, XF_ATOMIC_RELAXED) - 1;
+    xf_atomic_store(&w->bottom, b, XF_ATOMIC_RELAXED);
+    xf_atomic_thread_fence(XF_ATOMIC_SEQ_CST);
+    uintptr_t t = xf_atomic_load(&w->top, XF_ATOMIC_RELAXED);
+
+    if ((intptr_t)(b - t) < 0) {
+        /* 空 */
+        xf_atomic_store(&w->bottom, b + 1, XF_ATOMIC_RELAXED);
+        return NULL;
+    }
+    xf_threadpool_task_t *task = xf_atomic_load(&w->buf[b & DEQUE_MASK], XF_ATOMIC_RELAXED);
+    if (t == b) {
+        if (!xf_atomic_cas(&w->top, &t, t + 1, XF_ATOMIC_SEQ_CST, XF_ATOMIC_RELAXED)) {
+            task = NULL;
+        }
+        xf_atomic_store(&w->bottom, b + 1, XF_ATOMIC_RELAXED);
+    }
+    return task;
+}
+
+/**
+ * @brief 从顶部窃取. 队列为空或与其他线程竞争失败时返回 NULL.
+ */
+static xf_threadpool_task_t *_deque_steal(worker_t *w)
+{
+    uintptr_t t = xf_atomic_load(&w->top, XF_ATOMIC_ACQUIRE);
+    xf_atomic_thread_fence(XF_ATOMIC_SEQ_CST);
+    uintptr_t b = xf_atomic_load(&w->bottom, XF_ATOMIC_ACQUIRE);
+
+    if ((intptr_t)(b - t) <= 0) {
+        return NULL;
+    }
+    xf_threadpool_task_t *task = xf_atomic_load(&w->buf[t & DEQUE_MASK], XF_ATOMIC_RELAXED);
+    if (!xf_atomic_cas(&w->top, &t, t + 1, XF_ATOMIC_SEQ_CST, XF_ATOMIC_RELAXED)) {
+        return NULL;
+    }
+    return task;
+}
+
+/**
+ * @brief 当前线程是 pool 的工作线程时返回其描述, 否则返回 NULL.
+ */
+static worker_t *_self(xf_threadpool_t *pool)
+{
+    worker_t *w = s_self;
+    return ((NULL != w) && (w->pool == pool)) ? w : NULL;
+}
+
+/**
+ * @brief 依次尝试: 自己的队列, 全局队列, 窃取其他工作线程.
+ */
+static xf_threadpool_task_t *_find_task(xf_threadpool_t *pool, worker_t *self)
+{
+    xf_threadpool_task_t *task = NULL;
+    if (NULL != self) {
+        task = _deque_pop(self);
+    }
+    if (NULL == task) {
+        task = _take_injector(pool, self);
+    }
+    if (NULL == task) {
+        task = _steal_any(pool, self);
+    }
+    return task;
+}
+
+/**
+ * @brief 从全局队列取任务. 工作线程一次取出一批, 其余压入自己的队列.
+ */
+static xf_threadpool_task_t *_take_injector(xf_threadpool_t *pool, worker_t *self)
+{
+    if (xf_clist_empty(&pool->injector)) {
+        return NULL;
+    }
+    if (NULL == self) {
+        xf_list_t *node = xf_clist_pop_front(&pool->injector);
+        return (NULL != node) ? xf_list_entry(node, xf_threadpool_task_t, node) : NULL;
+    }
+
+    xf_list_t batch;
+    xf_list_init(&batch);
+    size_t num = xf_clist_pop_front_n(&pool->injector, &batch, XF_THREADPOOL_BATCH);
+    if (0 == num) {
+        return NULL;
+    }
+    xf_list_t *first = batch.next;
+    xf_list_del_init(first);
+
+    /* 逆序压入, 所有者仍按提交顺序弹出, 窃取者拿走最后提交的 */
+    size_t pushed = 0;
+    while (!xf_list_empty(&batch)) {
+        xf_list_t *node = batch.prev;
+        if (!_deque_push(self, xf_list_entry(node, xf_threadpool_task_t, node))) {
+            break;
+        }
+        xf_list_del_init(node);
+        pushed++;
+    }
+    if (!xf_list_empty(&batch)) {
+        xf_clist_push_back_list(&pool->injector, &batch);
+    }
+    if (pushed > 0) {
+        _notify(pool, pushed);
+    }
+    return xf_list_entry(first, xf_threadpool_task_t, node);
+}
+
+/**
+ * @brief 从随机的起点开始依次窃取其他工作线程.
+ */
+static xf_threadpool_task_t *_steal_any(xf_threadpool_t *pool, worker_t *self)
+{
+    uint32_t num = pool->num;
+    uint32_t start = _rand() % num;
+    for (uint32_t n = 0; n < num; n++) {
+        worker_t *victim = _WORKER(pool, (start + n) % num);
+        if (victim == self) {
+            continue;
+        }
+        xf_threadpool_task_t *task = _deque_steal(victim);
+        if (NULL != task) {
+            return task;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 是否还有排队的任务. 在 sleepers 增加之后调用, 见 _notify().
+ */
+static bool _has_work(xf_threadpool_t *pool)
+{
+    if (0 != xf_atomic_load(&pool->injector.len, XF_ATOMIC_SEQ_CST)) {
+        return true;
+    }
+    for (uint32_t i = 0; i < pool->num; i++) {
+        worker_t *w = _WORKER(pool, i);
+        uintptr_t b = xf_atomic_load(&w->bottom, XF_ATOMIC_SEQ_CST);
+        uintptr_t t = xf_atomic_load(&w->top, XF_ATOMIC_SEQ_CST);
+        if ((intptr_t)(b - t) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 有 num 个新任务入队后唤醒睡眠的工作线程.
+ *
+ * 入队与读取 sleepers 之间的 SEQ_CST 栅栏, 与睡眠方递增 sleepers 后再检查队列构成 Dekker 式配对:
+ * 要么这里看到 sleepers 非 0 并唤醒, 要么睡眠方看到新任务而不睡眠.
+ */
+static void _notify(xf_threadpool_t *pool, size_t num)
+{
+    xf_atomic_thread_fence(XF_ATOMIC_SEQ_CST);
+    if (0 == xf_atomic_load(&pool->sleepers, XF_ATOMIC_RELAXED)) {
+        return;
+    }
+    xf_lock_lock(pool->lock);
+    if (num > 1) {
+        xf_cond_broadcast(pool->cond);
+    } else {
+        xf_cond_signal(pool->cond);
+    }
+    xf_lock_unlock(pool->lock);
+}
+
+static void _run(xf_threadpool_task_t *task)
+{
+    /* 回调可能释放 task, 先取出任务组 */
+    xf_threadpool_group_t *group = task->group;
+    task->cb(task);
+    if (NULL != group) {
+        xf_atomic_fetch_sub(&group->pending, 1, XF_ATOMIC_RELEASE);
+    }
+}
+
+static void _worker_main(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+    xf_threadpool_t *pool = w->pool;
+    uint32_t idle = 0;
+
+    s_self = w;
+    s_seed = w->id * 2654435761u + 1;
+    for (;;) {
+        xf_threadpool_task_t *task = _find_task(pool, w);
+        if (NULL != task) {
+            _run(task);
+            idle = 0;
+            continue;
+        }
+        if ((0 != xf_atomic_load(&pool->stop, XF_ATOMIC_ACQUIRE)) && !_has_work(pool)) {
+            break;
+        }
+        if (++idle < XF_THREADPOOL_SPIN) {
+            xf_thread_yield();
+            continue;
+        }
+        idle = 0;
+        xf_lock_lock(pool->lock);
+        xf_atomic_fetch_add(&pool->sleepers, 1, XF_ATOMIC_SEQ_CST);
+        if (!_has_work(pool) && (0 == xf_atomic_load(&pool->stop, XF_ATOMIC_RELAXED))) {
+            xf_cond_wait(pool->cond, pool->lock, (uint32_t)(~0));
+        }
+        xf_atomic_fetch_sub(&pool->sleepers, 1, XF_ATOMIC_RELAXED);
+        xf_lock_unlock(pool->lock);
+    }
+    s_self = NULL;
+}
+
+/**
+ * @brief 循环领取 grain 大小的块, 直到区间处理完.
+ */
+static void _pfor_body(pfor_ctx_t *ctx)
+{
+    size_t begin = xf_atomic_load(&ctx->next, XF_ATOMIC_RELAXED);
+    for (;;) {
+        if (begin >= ctx->end) {
+            return;
+        }
+        size_t end = (ctx->end - begin > ctx->grain) ? (begin + ctx->grain) : ctx->end;
+        if (xf_atomic_cas_weak(&ctx->next, &begin, end, XF_ATOMIC_RELAXED, XF_ATOMIC_RELAXED)) {
+            ctx->cb(begin, end, ctx->arg);
+            begin = end;
+        }
+    }
+}
+
+static void _pfor_cb(xf_threadpool_task_t *task)
+{
+    _pfor_body(xf_container_of(task, pfor_task_t, task)->ctx);
+}
+
+static uint32_t _rand(void)
+{
+    s_seed = s_seed * 1103515245u + 12345u;
+    return s_seed >> 8;
+}
@@ -0,0 +1,244 @@
+/**
+ * @file xf_threadpool.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 工作窃取线程池。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 每个工作线程有一个固定容量的 Chase-Lev 双端队列: 所有者在底部压入、弹出（后进先出, 缓存友好）,
+ * 空闲的工作线程从其他队列的顶部窃取（先进先出, 通常窃取到较大的子任务）.
+ * 工作线程之外提交的任务进入全局队列（xf_clist_t）, 工作线程每次批量取出 XF_THREADPOOL_BATCH 个.
+ *
+ * - 任务是侵入式的 xf_threadpool_task_t, 线程池不分配内存;
+ * - 在任务回调中调用 xf_threadpool_submit() 会压入当前工作线程自己的队列, 不加锁;
+ * - xf_threadpool_submit_batch() 一次提交多个任务, 只加一次锁、只唤醒一次;
+ * - 属于同一 xf_threadpool_group_t 的任务可以用 xf_threadpool_group_wait() 等待,
+ *   等待期间调用者也会执行任务, 在任务回调中等待子任务不会死锁;
+ * - xf_threadpool_parallel_for() 把区间切块后由调用者与所有工作线程共同执行.
+ *
+ * 需要已通过 xf_thread_register() 对接线程, 通过 xf_lock_register() 对接锁与条件变量.
+ *
+ * @code{.c}
+ * static void _scale(size_t begin, size_t end, void *arg)
+ * {
+ *     float *v = (float *)arg;
+ *     for (size_t i = begin; i < end; i++) {
+ *         v[i] *= 2.0f;
+ *     }
+ * }
+ *
+ * xf_threadpool_t pool;
+ * xf_threadpool_init(&pool, 0, false);
+ * xf_threadpool_parallel_for(&pool, 0, n, 0, _scale, v);
+ * xf_threadpool_deinit(&pool);
+ * @endcode
+ */
+
+#ifndef __XF_THREADPOOL_H__
+#define __XF_THREADPOOL_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_threadpool_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_clist/xf_clist.h"
+#include "../xf_lock/xf_lock.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_threadpool xf_threadpool
+ * @brief 工作窃取线程池。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct xf_threadpool_task_s xf_threadpool_task_t;
+
+/**
+ * @brief 任务回调. 回调中可以释放或重新提交 task.
+ */
+typedef void (*xf_threadpool_task_cb_t)(xf_threadpool_task_t *task);
+
+/**
+ * @brief 区间回调, 处理 [begin, end).
+ */
+typedef void (*xf_threadpool_range_cb_t)(size_t begin, size_t end, void *arg);
+
+/**
+ * @brief 任务组, 记录尚未执行完的任务数.
+ */
+typedef struct xf_threadpool_group_s {
+    size_t              pending;        /*!< 已提交、尚未执行完的任务数 */
+} xf_threadpool_group_t;
+
+/**
+ * @brief 任务. 一般作为成员嵌入使用者的结构体, 回调中通过 xf_container_of() 取回.
+ */
+struct xf_threadpool_task_s {
+    xf_list_t               node;       /*!< 在全局队列中时使用 */
+    xf_threadpool_task_cb_t cb;         /*!< 回调 */
+    xf_threadpool_group_t  *group;      /*!< 所属任务组, 可为 NULL */
+};
+
+/**
+ * @brief 线程池.
+ */
+typedef struct xf_threadpool_s {
+    void               *mem;            /*!< 分配的内存 */
+    uint8_t            *workers;        /*!< 按 XF_THREADPOOL_ALIGN 对齐的各工作线程 */
+    uint32_t            num;            /*!< 工作线程数 */
+    uint32_t            started;        /*!< 已创建的线程数 */
+    uint32_t            sleepers;       /*!< 正在睡眠或准备睡眠的工作线程数 */
+    uint32_t            stop;           /*!< 非 0 时工作线程在队列为空后退出 */
+    xf_clist_t          injector;       /*!< 全局队列, 工作线程之外提交的任务 */
+    xf_lock_t           lock;           /*!< 只用于睡眠与唤醒 */
+    xf_cond_t           cond;           /*!< 有新任务或退出 */
+} xf_threadpool_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化线程池并启动工作线程.
+ *
+ * @param pool 线程池.
+ * @param num 工作线程数. 0 表示 xf_thread_get_cpu_num(), 超过 XF_THREADPOOL_MAX_WORKERS 时取上限.
+ * @param pin_cpu 是否把第 i 个工作线程绑定到第 i 个核上; 对接未实现绑核时忽略.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NO_MEM         内存不足
+ *      - XF_ERR_NOT_SUPPORTED  对接的锁没有实现条件变量
+ *      - XF_FAIL               创建锁或线程失败, 需要已对接 xf_lock 与 xf_thread
+ */
+xf_err_t xf_threadpool_init(xf_threadpool_t *pool, uint32_t num, bool pin_cpu);
+
+/**
+ * @brief 执行完所有已提交的任务后, 停止并等待所有工作线程退出.
+ *
+ * @attention 不能在任务回调中调用. 调用期间其他线程不能再提交任务.
+ *
+ * @param pool 线程池.
+ */
+void xf_threadpool_deinit(xf_threadpool_t *pool);
+
+/**
+ * @brief 初始化任务.
+ *
+ * @param task 任务.
+ * @param cb 回调.
+ * @param group 所属任务组, 可为 NULL. 任务组必须在任务执行完之前一直有效.
+ */
+static inline void xf_threadpool_task_init(
+    xf_threadpool_task_t *task, xf_threadpool_task_cb_t cb, xf_threadpool_group_t *group)
+{
+    xf_list_init(&task->node);
+    task->cb = cb;
+    task->group = group;
+}
+
+/**
+ * @brief 初始化任务组.
+ */
+static inline void xf_threadpool_group_init(xf_threadpool_group_t *group)
+{
+    group->pending = 0;
+}
+
+/**
+ * @brief 任务组中的任务是否已全部执行完, 不等待.
+ */
+static inline bool xf_threadpool_group_done(xf_threadpool_group_t *group)
+{
+    return 0 == xf_atomic_load(&group->pending, XF_ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief 提交任务.
+ *
+ * 在该线程池的任务回调中调用时压入当前工作线程的队列, 否则进入全局队列.
+ *
+ * @param pool 线程池.
+ * @param task 已初始化的任务, 执行前不能再次提交.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_threadpool_submit(xf_threadpool_t *pool, xf_threadpool_task_t *task);
+
+/**
+ * @brief 一次提交多个任务. 全局队列只加一次锁, 只唤醒一次.
+ *
+ * @param pool 线程池.
+ * @param tasks 任务指针数组.
+ * @param num 任务数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_threadpool_submit_batch(
+    xf_threadpool_t *pool, xf_threadpool_task_t *const tasks[], size_t num);
+
+/**
+ * @brief 等待任务组中的任务全部执行完. 等待期间调用者也从线程池中取任务执行.
+ *
+ * 可以在任务回调中调用（例如等待自己提交的子任务）.
+ *
+ * @param pool 线程池.
+ * @param group 任务组.
+ */
+void xf_threadpool_group_wait(xf_threadpool_t *pool, xf_threadpool_group_t *group);
+
+/**
+ * @brief 并行处理区间 [begin, end), 返回时所有块都已处理完.
+ *
+ * 区间按 grain 切块, 调用者与工作线程通过原子计数领取. 可以在任务回调中嵌套调用.
+ *
+ * @param pool 线程池.
+ * @param begin 起点.
+ * @param end 终点（不含）.
+ * @param grain 每块的大小. 0 表示自动, 约为每个线程 4 块.
+ * @param cb 区间回调, 会被多个线程同时调用.
+ * @param arg 传给 cb 的参数.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_threadpool_parallel_for(xf_threadpool_t *pool, size_t begin, size_t end,
+                                    size_t grain, xf_threadpool_range_cb_t cb, void *arg);
+
+/**
+ * @brief 工作线程数.
+ */
+static inline uint32_t xf_threadpool_num_workers(const xf_threadpool_t *pool)
+{
+    return pool->num;
+}
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_threadpool
+ * @}
+ */
+
+#endif // __XF_THREADPOOL_H__
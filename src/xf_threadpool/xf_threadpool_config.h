@@ -0,0 +1,87 @@
+/**
+ * @file xf_threadpool_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_threadpool 配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_THREADPOOL_CONFIG_H__
+#define __XF_THREADPOOL_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 最大工作线程数. xf_threadpool_parallel_for() 在栈上为每个工作线程放一个任务.
+ */
+#if !defined(XF_THREADPOOL_MAX_WORKERS)
+#   define XF_THREADPOOL_MAX_WORKERS    (64)
+#endif
+
+/**
+ * @brief 每个工作线程的双端队列容量, 必须是 2 的幂. 满时任务转入全局队列.
+ */
+#if !defined(XF_THREADPOOL_DEQUE_SIZE)
+#   define XF_THREADPOOL_DEQUE_SIZE     (256)
+#endif
+
+/**
+ * @brief 工作线程从全局队列一次最多取出的任务数, 多出的放入自己的双端队列供其他线程窃取.
+ */
+#if !defined(XF_THREADPOOL_BATCH)
+#   define XF_THREADPOOL_BATCH          (16)
+#endif
+
+/**
+ * @brief 工作线程找不到任务时, 让出 CPU 并重试的轮数, 之后才睡眠.
+ */
+#if !defined(XF_THREADPOOL_SPIN)
+#   define XF_THREADPOOL_SPIN           (32)
+#endif
+
+/**
+ * @brief 每个工作线程的对齐字节数, 通常为缓存行大小, 避免相邻工作线程的队列伪共享.
+ */
+#if !defined(XF_THREADPOOL_ALIGN)
+#   define XF_THREADPOOL_ALIGN          (64)
+#endif
+
+#if (XF_THREADPOOL_MAX_WORKERS < 1)
+#   error "xf_threadpool: XF_THREADPOOL_MAX_WORKERS must be >= 1"
+#endif
+
+#if (XF_THREADPOOL_DEQUE_SIZE < 2) \
+        || ((XF_THREADPOOL_DEQUE_SIZE & (XF_THREADPOOL_DEQUE_SIZE - 1)) != 0)
+#   error "xf_threadpool: XF_THREADPOOL_DEQUE_SIZE must be a power of 2 and >= 2"
+#endif
+
+#if (XF_THREADPOOL_BATCH < 1) || (XF_THREADPOOL_BATCH > XF_THREADPOOL_DEQUE_SIZE)
+#   error "xf_threadpool: XF_THREADPOOL_BATCH must be in [1, XF_THREADPOOL_DEQUE_SIZE]"
+#endif
+
+#if (XF_THREADPOOL_ALIGN < 16) || ((XF_THREADPOOL_ALIGN & (XF_THREADPOOL_ALIGN - 1)) != 0)
+#   error "xf_threadpool: XF_THREADPOOL_ALIGN must be a power of 2 and >= 16"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_THREADPOOL_CONFIG_H__
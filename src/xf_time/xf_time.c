@@ -0,0 +1,59 @@
+/**
+ * @file xf_time.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 单调高精度时间。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_time.h"
+#include "xf_time_port.h"
+#include "../xf_std/xf_stddef.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+/* ==================== [Static Variables] ================================== */
+
+static const xf_time_ops_t *sp_ops = NULL;
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_time_register(const xf_time_ops_t *const p_ops)
+{
+    if ((NULL == p_ops) || (NULL == p_ops->get_ns)) {
+        return XF_FAIL;
+    }
+    sp_ops = p_ops;
+    return XF_OK;
+}
+
+uint64_t xf_time_get_ns(void)
+{
+    if (NULL == sp_ops) {
+        return 0;
+    }
+    return sp_ops->get_ns();
+}
+
+uint64_t xf_time_get_us(void)
+{
+    return xf_time_get_ns() / 1000U;
+}
+
+uint64_t xf_time_get_ms(void)
+{
+    return xf_time_get_ns() / 1000000U;
+}
+
+/* ==================== [Static Functions] ================================== */
@@ -0,0 +1,70 @@
+/**
+ * @file xf_time.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 单调高精度时间。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_TIME_H__
+#define __XF_TIME_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_time_types.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_time xf_time
+ * @brief 单调时间接口，用于延时测量、日志时间戳等。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 获取单调时间, 单位 ns.
+ *
+ * @return uint64_t 单调时间. 未对接时返回 0.
+ */
+uint64_t xf_time_get_ns(void);
+
+/**
+ * @brief 获取单调时间, 单位 us.
+ *
+ * @return uint64_t 单调时间. 未对接时返回 0.
+ */
+uint64_t xf_time_get_us(void);
+
+/**
+ * @brief 获取单调时间, 单位 ms.
+ *
+ * @return uint64_t 单调时间. 未对接时返回 0.
+ */
+uint64_t xf_time_get_ms(void);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_time
+ * @}
+ */
+
+#endif /* __XF_TIME_H__ */
@@ -0,0 +1,59 @@
+/**
+ * @file xf_time_port.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 时间对接。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_TIME_PORT_H__
+#define __XF_TIME_PORT_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_time_types.h"
+
+/**
+ * @cond XFAPI_PORT
+ * @ingroup group_xf_utils_port
+ * @defgroup group_xf_utils_port_time xf_time
+ * @brief 对接 xf_time 操作集。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 注册时间操作.
+ *
+ * @param p_ops 指向静态时间操作集的指针, 操作集必须在整个程序生命周期中可用.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               失败
+ */
+xf_err_t xf_time_register(const xf_time_ops_t *const p_ops);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_port_time
+ * @}
+ */
+
+#endif /* __XF_TIME_PORT_H__ */
@@ -0,0 +1,66 @@
+/**
+ * @file xf_time_types.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 时间通用数据类型。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_TIME_TYPES_H__
+#define __XF_TIME_TYPES_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_common/xf_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @cond XFAPI_PORT
+ * @ingroup group_xf_utils_port_time
+ * @endcond
+ * @{
+ */
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 获取单调时间.
+ *
+ * @attention 实现要求:
+ * 1. 单调递增, 不受系统时间调整影响;
+ * 2. 可在任意线程（及中断, 如平台允许）中调用;
+ * 3. 尽量廉价, 避免系统调用（如 Linux 下使用 vDSO 或 TSC, MCU 下使用周期计数器）.
+ *
+ * @return uint64_t 自某个固定时刻起经过的纳秒数.
+ */
+typedef uint64_t (*xf_time_ops_get_ns_t)(void);
+
+/**
+ * @brief 时间操作结构体.
+ */
+typedef struct xf_time_ops_s {
+    xf_time_ops_get_ns_t    get_ns;
+} xf_time_ops_t;
+
+/**
+ * End of group_xf_utils_port_time
+ * @}
+ */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XF_TIME_TYPES_H__ */
@@ -0,0 +1,254 @@
+/**
+ * @file xf_timer_wheel.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 基于 xf_list 的分层哈希时间轮。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_timer_wheel.h"
+#include "../xf_std/xf_stddef.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define ROOT_BITS                       XF_TIMER_WHEEL_ROOT_BITS
+#define LEVEL_BITS                      XF_TIMER_WHEEL_LEVEL_BITS
+#define LEVELS                          XF_TIMER_WHEEL_LEVELS
+#define ROOT_MASK                       (XF_TIMER_WHEEL_ROOT_SIZE - 1)
+#define LEVEL_MASK                      (XF_TIMER_WHEEL_LEVEL_SIZE - 1)
+
+/* 第 lvl 层（上层从 0 计）的槽位下标在 tick 中的起始位 */
+#define LEVEL_SHIFT(lvl)                (ROOT_BITS + (lvl) * LEVEL_BITS)
+
+/* 第 lvl 层能容纳的最大距离（不含） */
+#define LEVEL_RANGE(lvl)                (1ULL << LEVEL_SHIFT((lvl) + 1))
+
+/**
+ * 到期判断基于 (int32_t)(expires - now), 因此超时不能超过 INT32_MAX;
+ * 同时不能超过最高层能表示的范围.
+ */
+#define MAX_TIMEOUT \
+    ((LEVEL_RANGE(LEVELS - 1) - 1) < 0x7fffffffULL \
+        ? (uint32_t)(LEVEL_RANGE(LEVELS - 1) - 1) : (uint32_t)0x7fffffffUL)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _internal_add(xf_timer_wheel_t *wheel, xf_timer_wheel_timer_t *timer);
+static void _detach(xf_timer_wheel_timer_t *timer);
+static void _cascade(xf_timer_wheel_t *wheel, uint32_t lvl, uint32_t index);
+static uint32_t _level_index(uint32_t tick, uint32_t lvl);
+
+/* ==================== [Static Variables] ================================== */
+
+/* ==================== [Macros] ============================================ */
+
+#define _LOCK(wheel) \
+    do { if ((wheel)->use_lock) { xf_lock_lock((wheel)->lock); } } while (0)
+#define _UNLOCK(wheel) \
+    do { if ((wheel)->use_lock) { xf_lock_unlock((wheel)->lock); } } while (0)
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_timer_wheel_init(xf_timer_wheel_t *wheel, bool thread_safe)
+{
+    if (NULL == wheel) {
+        return XF_ERR_INVALID_ARG;
+    }
+    wheel->now = 0;
+    wheel->use_lock = thread_safe;
+    wheel->lock = NULL;
+    if (thread_safe) {
+        if (XF_OK != xf_lock_init(&wheel->lock)) {
+            return XF_FAIL;
+        }
+    }
+    for (uint32_t i = 0; i < XF_TIMER_WHEEL_ROOT_SIZE; i++) {
+        xf_list_init(&wheel->root[i]);
+    }
+    for (uint32_t lvl = 0; lvl < LEVELS; lvl++) {
+        for (uint32_t i = 0; i < XF_TIMER_WHEEL_LEVEL_SIZE; i++) {
+            xf_list_init(&wheel->level[lvl][i]);
+        }
+    }
+    return XF_OK;
+}
+
+xf_err_t xf_timer_wheel_deinit(xf_timer_wheel_t *wheel)
+{
+    if (NULL == wheel) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_timer_wheel_timer_t *pos;
+    xf_timer_wheel_timer_t *n;
+
+    _LOCK(wheel);
+    for (uint32_t i = 0; i < XF_TIMER_WHEEL_ROOT_SIZE; i++) {
+        xf_list_for_each_entry_safe(pos, n, &wheel->root[i], xf_timer_wheel_timer_t, node) {
+            _detach(pos);
+        }
+    }
+    for (uint32_t lvl = 0; lvl < LEVELS; lvl++) {
+        for (uint32_t i = 0; i < XF_TIMER_WHEEL_LEVEL_SIZE; i++) {
+            xf_list_for_each_entry_safe(pos, n, &wheel->level[lvl][i], xf_timer_wheel_timer_t, node) {
+                _detach(pos);
+            }
+        }
+    }
+    _UNLOCK(wheel);
+
+    if (wheel->use_lock) {
+        xf_lock_destroy(wheel->lock);
+        wheel->lock = NULL;
+        wheel->use_lock = false;
+    }
+    return XF_OK;
+}
+
+void xf_timer_wheel_timer_init(
+    xf_timer_wheel_timer_t *timer, xf_timer_wheel_cb_t cb, void *user_data)
+{
+    timer->node.next    = NULL;
+    timer->node.prev    = NULL;
+    timer->expires      = 0;
+    timer->cb           = cb;
+    timer->user_data    = user_data;
+}
+
+xf_err_t xf_timer_wheel_add(
+    xf_timer_wheel_t *wheel, xf_timer_wheel_timer_t *timer, uint32_t timeout_ticks)
+{
+    if ((NULL == wheel) || (NULL == timer)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (timeout_ticks > MAX_TIMEOUT) {
+        timeout_ticks = MAX_TIMEOUT;
+    }
+    _LOCK(wheel);
+    if (xf_timer_wheel_timer_is_pending(timer)) {
+        _detach(timer);
+    }
+    timer->expires = wheel->now + timeout_ticks;
+    _internal_add(wheel, timer);
+    _UNLOCK(wheel);
+    return XF_OK;
+}
+
+xf_err_t xf_timer_wheel_del(xf_timer_wheel_t *wheel, xf_timer_wheel_timer_t *timer)
+{
+    if ((NULL == wheel) || (NULL == timer)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_err_t ret = XF_ERR_NOT_FOUND;
+    _LOCK(wheel);
+    if (xf_timer_wheel_timer_is_pending(timer)) {
+        _detach(timer);
+        ret = XF_OK;
+    }
+    _UNLOCK(wheel);
+    return ret;
+}
+
+uint32_t xf_timer_wheel_advance(xf_timer_wheel_t *wheel, uint32_t ticks)
+{
+    if (NULL == wheel) {
+        return 0;
+    }
+    uint32_t expired = 0;
+    xf_list_t work;
+
+    _LOCK(wheel);
+    while (ticks--) {
+        uint32_t index = wheel->now & ROOT_MASK;
+        /* 第 0 层转满一圈, 逐层向下分散, 直到某层未回绕 */
+        if (0 == index) {
+            for (uint32_t lvl = 0; lvl < LEVELS; lvl++) {
+                uint32_t li = _level_index(wheel->now, lvl);
+                _cascade(wheel, lvl, li);
+                if (li != 0) {
+                    break;
+                }
+            }
+        }
+        wheel->now++;
+
+        xf_list_init(&work);
+        xf_list_splice_init(&wheel->root[index], &work);
+        /**
+         * 每次只从 work 中取出一个定时器, 以便回调期间其他线程
+         * 可以安全地删除 work 中尚未执行的定时器.
+         */
+        while (!xf_list_empty(&work)) {
+            xf_timer_wheel_timer_t *timer =
+                xf_list_first_entry(&work, xf_timer_wheel_timer_t, node);
+            xf_timer_wheel_cb_t cb = timer->cb;
+            void *user_data = timer->user_data;
+            _detach(timer);
+            expired++;
+            _UNLOCK(wheel);
+            if (cb) {
+                cb(timer, user_data);
+            }
+            _LOCK(wheel);
+        }
+    }
+    _UNLOCK(wheel);
+    return expired;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static uint32_t _level_index(uint32_t tick, uint32_t lvl)
+{
+    if (LEVEL_SHIFT(lvl) >= 32) {
+        return 0;
+    }
+    return (tick >> LEVEL_SHIFT(lvl)) & LEVEL_MASK;
+}
+
+static void _internal_add(xf_timer_wheel_t *wheel, xf_timer_wheel_timer_t *timer)
+{
+    uint32_t expires = timer->expires;
+    uint32_t delta = expires - wheel->now;
+    xf_list_t *vec;
+
+    if ((int32_t)delta < 0) {
+        /* 已过期（如在回调中以旧的 expires 重新挂入）: 下一个 tick 处理 */
+        vec = &wheel->root[wheel->now & ROOT_MASK];
+    } else if (delta < XF_TIMER_WHEEL_ROOT_SIZE) {
+        vec = &wheel->root[expires & ROOT_MASK];
+    } else {
+        uint32_t lvl = 0;
+        while ((lvl < LEVELS - 1) && ((uint64_t)delta >= LEVEL_RANGE(lvl))) {
+            lvl++;
+        }
+        vec = &wheel->level[lvl][_level_index(expires, lvl)];
+    }
+    xf_list_add_tail(&timer->node, vec);
+}
+
+static void _detach(xf_timer_wheel_timer_t *timer)
+{
+    __xf_list_del_entry(&timer->node);
+    timer->node.next = NULL;
+    timer->node.prev = NULL;
+}
+
+static void _cascade(xf_timer_wheel_t *wheel, uint32_t lvl, uint32_t index)
+{
+    xf_list_t tmp;
+    xf_timer_wheel_timer_t *pos;
+    xf_timer_wheel_timer_t *n;
+
+    xf_list_init(&tmp);
+    xf_list_splice_init(&wheel->level[lvl][index], &tmp);
+    xf_list_for_each_entry_safe(pos, n, &tmp, xf_timer_wheel_timer_t, node) {
+        _internal_add(wheel, pos);
+    }
+}
@@ -0,0 +1,202 @@
+/**
+ * @file xf_timer_wheel.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 基于 xf_list 的分层哈希时间轮。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 时间轮由第 0 层（2^ROOT_BITS 个槽）和若干上层（每层 2^LEVEL_BITS 个槽）组成,
+ * 每个槽都是一个 xf_list_t 链表头。
+ *
+ * - 添加/删除定时器: O(1), 只需计算槽位并挂入/摘下链表;
+ * - 推进时间: 每个 tick 只处理第 0 层的一个槽, 第 0 层转满一圈时
+ *   才将上层的一个槽重新分散（cascade）到下层, 均摊 O(1).
+ *
+ * 时间轮本身不读取时钟, 由调用者通过 xf_timer_wheel_advance() 推进 tick.
+ */
+
+#ifndef __XF_TIMER_WHEEL_H__
+#define __XF_TIMER_WHEEL_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_timer_wheel_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_lock/xf_lock.h"
+#include "../xf_std/xf_stdbool.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_timer_wheel xf_timer_wheel
+ * @brief 分层哈希时间轮, O(1) 添加/删除定时器。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#define XF_TIMER_WHEEL_ROOT_SIZE        (1UL << XF_TIMER_WHEEL_ROOT_BITS)
+#define XF_TIMER_WHEEL_LEVEL_SIZE       (1UL << XF_TIMER_WHEEL_LEVEL_BITS)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct xf_timer_wheel_timer_s xf_timer_wheel_timer_t;
+
+/**
+ * @brief 定时器到期回调。
+ *
+ * @note 回调执行时时间轮的锁已释放, 回调内可以重新添加（周期定时）
+ *       或删除任意定时器。
+ *
+ * @param timer 到期的定时器.
+ * @param user_data 用户数据.
+ */
+typedef void (*xf_timer_wheel_cb_t)(xf_timer_wheel_timer_t *timer, void *user_data);
+
+/**
+ * @brief 定时器. 通常嵌入到用户结构体中, 由用户分配内存.
+ *
+ * @attention 使用前必须调用 xf_timer_wheel_timer_init() 初始化.
+ */
+struct xf_timer_wheel_timer_s {
+    xf_list_t           node;           /*!< 槽链表节点, 未挂起时 next 为 NULL */
+    uint32_t            expires;        /*!< 绝对到期 tick */
+    xf_timer_wheel_cb_t cb;             /*!< 到期回调 */
+    void               *user_data;      /*!< 用户数据 */
+};
+
+/**
+ * @brief 时间轮.
+ */
+typedef struct xf_timer_wheel_s {
+    uint32_t    now;                    /*!< 下一个待处理的 tick */
+    bool        use_lock;               /*!< 是否使用 lock */
+    xf_lock_t   lock;                   /*!< 保护整个时间轮的锁 */
+    xf_list_t   root[XF_TIMER_WHEEL_ROOT_SIZE];
+    xf_list_t   level[XF_TIMER_WHEEL_LEVELS][XF_TIMER_WHEEL_LEVEL_SIZE];
+} xf_timer_wheel_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化时间轮.
+ *
+ * @param wheel 时间轮.
+ * @param thread_safe 是否通过 xf_lock 保护时间轮.
+ *      为 true 时需要已通过 xf_lock_register() 对接锁.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_FAIL               锁初始化失败
+ */
+xf_err_t xf_timer_wheel_init(xf_timer_wheel_t *wheel, bool thread_safe);
+
+/**
+ * @brief 反初始化时间轮.
+ *
+ * 所有仍挂起的定时器都会被摘下（不调用回调）.
+ *
+ * @param wheel 时间轮.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_timer_wheel_deinit(xf_timer_wheel_t *wheel);
+
+/**
+ * @brief 初始化定时器.
+ *
+ * @param timer 定时器.
+ * @param cb 到期回调.
+ * @param user_data 用户数据.
+ */
+void xf_timer_wheel_timer_init(
+    xf_timer_wheel_timer_t *timer, xf_timer_wheel_cb_t cb, void *user_data);
+
+/**
+ * @brief 启动定时器, 在此后第 timeout_ticks + 1 次推进 tick 时到期.
+ *
+ * 当前 tick 视为尚未结束, 因此到期前至少经过 timeout_ticks 个完整 tick.
+ * 如果定时器已挂起, 则重新设置其到期时间.
+ *
+ * @param wheel 时间轮.
+ * @param timer 定时器.
+ * @param timeout_ticks 超时 tick 数. 为 0 时在下一次推进时到期.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_timer_wheel_add(
+    xf_timer_wheel_t *wheel, xf_timer_wheel_timer_t *timer, uint32_t timeout_ticks);
+
+/**
+ * @brief 取消定时器.
+ *
+ * @param wheel 时间轮.
+ * @param timer 定时器.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_FOUND      定时器未挂起
+ */
+xf_err_t xf_timer_wheel_del(xf_timer_wheel_t *wheel, xf_timer_wheel_timer_t *timer);
+
+/**
+ * @brief 推进时间轮, 并执行其间到期的定时器回调.
+ *
+ * @param wheel 时间轮.
+ * @param ticks 推进的 tick 数.
+ * @return uint32_t 本次到期的定时器个数.
+ */
+uint32_t xf_timer_wheel_advance(xf_timer_wheel_t *wheel, uint32_t ticks);
+
+/**
+ * @brief 获取时间轮当前 tick.
+ *
+ * @param wheel 时间轮.
+ * @return uint32_t 当前 tick.
+ */
+static inline uint32_t xf_timer_wheel_get_tick(const xf_timer_wheel_t *wheel)
+{
+    return wheel->now;
+}
+
+/**
+ * @brief 定时器是否已挂起（等待到期）.
+ *
+ * @param timer 定时器.
+ * @return bool
+ *      - true          已挂起
+ *      - false         未挂起
+ */
+static inline bool xf_timer_wheel_timer_is_pending(const xf_timer_wheel_timer_t *timer)
+{
+    return timer->node.next != NULL;
+}
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 推进一个 tick.
+ */
+#define xf_timer_wheel_tick(wheel)      xf_timer_wheel_advance((wheel), 1)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_timer_wheel
+ * @}
+ */
+
+#endif /* __XF_TIMER_WHEEL_H__ */
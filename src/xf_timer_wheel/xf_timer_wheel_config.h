@@ -0,0 +1,64 @@
+/**
+ * @file xf_timer_wheel_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 分层时间轮配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_TIMER_WHEEL_CONFIG_H__
+#define __XF_TIMER_WHEEL_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 第 0 层（最精细层）槽位数的位数。该层覆盖 2^ROOT_BITS 个 tick.
+ */
+#if !defined(XF_TIMER_WHEEL_ROOT_BITS)
+#   define XF_TIMER_WHEEL_ROOT_BITS     (8)
+#endif
+
+/**
+ * @brief 其余各层槽位数的位数。
+ */
+#if !defined(XF_TIMER_WHEEL_LEVEL_BITS)
+#   define XF_TIMER_WHEEL_LEVEL_BITS    (6)
+#endif
+
+/**
+ * @brief 除第 0 层外的层数。
+ *
+ * 可表示的最大超时为 2^(ROOT_BITS + LEVELS * LEVEL_BITS) - 1 个 tick,
+ * 超过 32 位时按 32 位截断。超出范围的超时会被限制为最大值。
+ */
+#if !defined(XF_TIMER_WHEEL_LEVELS)
+#   define XF_TIMER_WHEEL_LEVELS        (4)
+#endif
+
+#if (XF_TIMER_WHEEL_ROOT_BITS < 1) || (XF_TIMER_WHEEL_LEVEL_BITS < 1) \
+        || (XF_TIMER_WHEEL_LEVELS < 1)
+#   error "xf_timer_wheel: ROOT_BITS, LEVEL_BITS and LEVELS must be positive"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_TIMER_WHEEL_CONFIG_H__
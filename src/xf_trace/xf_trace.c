@@ -0,0 +1,325 @@
+/**
+ * @file xf_trace.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 轻量级事件追踪, 可导出为 Chrome trace-event JSON.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_trace.h"
+
+#if XF_TRACE_IS_ENABLE
+
+#include "../xf_time/xf_time.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_std/xf_stdio.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define EVENT_MASK                      (XF_TRACE_BUF_EVENTS - 1)
+
+/* 单个事件的 JSON 最大长度（不含事件名） */
+#define LINE_BUF_SIZE                   (160)
+
+#if !defined(XF_THREAD_LOCAL)
+#   error "xf_trace: thread-local storage is required, disable XF_TRACE_ENABLE"
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct {
+    xf_trace_write_cb_t write;
+    void               *user_data;
+} _out_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static xf_trace_buf_t *_get_buf(void);
+static xf_trace_buf_t *_buf_reuse(void);
+static void _buf_add(xf_trace_buf_t *buf, const char *thread_name, bool auto_alloc);
+static void _put(_out_t *out, const char *data, size_t len);
+static void _put_cstr(_out_t *out, const char *str);
+static void _put_json_str(_out_t *out, const char *str);
+static void _put_event(_out_t *out, const xf_trace_buf_t *buf,
+                       const xf_trace_event_t *ev, bool *p_first);
+
+/* ==================== [Static Variables] ================================== */
+
+static XF_THREAD_LOCAL xf_trace_buf_t *s_tls_buf = NULL;
+static xf_trace_buf_t *s_buf_list = NULL;
+static uint32_t s_next_tid = 1;
+static bool s_enable = true;
+
+/* 分配失败后本线程不再重试 */
+static XF_THREAD_LOCAL bool s_tls_alloc_failed = false;
+
+static const char s_ph[] = { 'B', 'E', 'i', 'C' };
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_trace_thread_attach(xf_trace_buf_t *buf, const char *thread_name)
+{
+    if (NULL == buf) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (NULL != s_tls_buf) {
+        return XF_ERR_INITED;
+    }
+    _buf_add(buf, thread_name, false);
+    return XF_OK;
+}
+
+void xf_trace_thread_detach(void)
+{
+    xf_trace_buf_t *buf = s_tls_buf;
+    if (NULL == buf) {
+        return;
+    }
+    s_tls_buf = NULL;
+    s_tls_alloc_failed = false;
+    xf_atomic_store(&buf->in_use, 0, XF_ATOMIC_RELEASE);
+}
+
+xf_err_t xf_trace_thread_set_name(const char *thread_name)
+{
+    xf_trace_buf_t *buf = _get_buf();
+    if (NULL == buf) {
+        return XF_FAIL;
+    }
+    buf->thread_name = thread_name;
+    return XF_OK;
+}
+
+void xf_trace_set_enable(bool enable)
+{
+    xf_atomic_store(&s_enable, enable, XF_ATOMIC_RELAXED);
+}
+
+void xf_trace_record(uint8_t type, const char *name, uint8_t nargs, int64_t arg0, int64_t arg1)
+{
+    if (!xf_atomic_load(&s_enable, XF_ATOMIC_RELAXED)) {
+        return;
+    }
+    xf_trace_buf_t *buf = _get_buf();
+    if (unlikely(NULL == buf)) {
+        return;
+    }
+    /* 只有本线程写 head, 先写事件再发布 head, 导出方以 acquire 读取 */
+    uint32_t head = buf->head;
+    xf_trace_event_t *ev = &buf->events[head & EVENT_MASK];
+    ev->ts      = xf_time_get_ns();
+    ev->name    = name;
+    ev->type    = type;
+    ev->nargs   = nargs;
+    ev->args[0] = arg0;
+    ev->args[1] = arg1;
+    xf_atomic_store(&buf->head, head + 1, XF_ATOMIC_RELEASE);
+}
+
+void xf_trace_clear(void)
+{
+    /* 写入方已静止, 可以直接修改链表 */
+    xf_trace_buf_t **pp = &s_buf_list;
+    while (NULL != *pp) {
+        xf_trace_buf_t *buf = *pp;
+        if (0 == xf_atomic_load(&buf->in_use, XF_ATOMIC_ACQUIRE)) {
+            *pp = buf->next;
+            if (buf->auto_alloc) {
+                xf_free(buf);
+            }
+            continue;
+        }
+        xf_atomic_store(&buf->head, 0, XF_ATOMIC_RELAXED);
+        pp = &buf->next;
+    }
+}
+
+xf_err_t xf_trace_export_json(xf_trace_write_cb_t write, void *user_data)
+{
+    if (NULL == write) {
+        return XF_ERR_INVALID_ARG;
+    }
+    _out_t out = { write, user_data };
+    bool first = true;
+    char line[LINE_BUF_SIZE];
+
+    _put_cstr(&out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    xf_trace_buf_t *buf = xf_atomic_load(&s_buf_list, XF_ATOMIC_ACQUIRE);
+    for (; buf; buf = buf->next) {
+        /* 线程名元数据 */
+        if (buf->thread_name) {
+            int n = xf_snprintf(line, sizeof(line),
+                                "%s\n{\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                                "\"name\":\"thread_name\",\"args\":{\"name\":",
+                                first ? "" : ",", (unsigned)buf->tid);
+            _put(&out, line, (size_t)n);
+            _put_json_str(&out, buf->thread_name);
+            _put_cstr(&out, "}}");
+            first = false;
+        }
+
+        uint32_t head = xf_atomic_load(&buf->head, XF_ATOMIC_ACQUIRE);
+        uint32_t start = (head > XF_TRACE_BUF_EVENTS) ? (head - XF_TRACE_BUF_EVENTS) : 0;
+        for (uint32_t i = start; i != head; i++) {
+            _put_event(&out, buf, &buf->events[i & EVENT_MASK], &first);
+        }
+    }
+
+    _put_cstr(&out, "\n]}\n");
+    return XF_OK;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static xf_trace_buf_t *_get_buf(void)
+{
+    xf_trace_buf_t *buf = s_tls_buf;
+    if (likely(NULL != buf)) {
+        return buf;
+    }
+#if XF_TRACE_AUTO_ALLOC_IS_ENABLE
+    if (!s_tls_alloc_failed) {
+        buf = _buf_reuse();
+        if (NULL != buf) {
+            return buf;
+        }
+        buf = (xf_trace_buf_t *)xf_malloc(sizeof(xf_trace_buf_t));
+        if (NULL == buf) {
+            s_tls_alloc_failed = true;
+            return NULL;
+        }
+        _buf_add(buf, NULL, true);
+    }
+#endif
+    return buf;
+}
+
+/**
+ * @brief 认领一个已解除绑定的自动分配缓冲区, 丢弃其中的事件.
+ */
+static xf_trace_buf_t *_buf_reuse(void)
+{
+    xf_trace_buf_t *buf = xf_atomic_load(&s_buf_list, XF_ATOMIC_ACQUIRE);
+    for (; buf; buf = buf->next) {
+        uint8_t expected = 0;
+        if (!buf->auto_alloc || (0 != xf_atomic_load(&buf->in_use, XF_ATOMIC_RELAXED))) {
+            continue;
+        }
+        if (xf_atomic_cas(&buf->in_use, &expected, 1, XF_ATOMIC_ACQUIRE, XF_ATOMIC_RELAXED)) {
+            buf->thread_name = NULL;
+            buf->tid = xf_atomic_fetch_add(&s_next_tid, 1, XF_ATOMIC_RELAXED);
+            xf_atomic_store(&buf->head, 0, XF_ATOMIC_RELAXED);
+            s_tls_buf = buf;
+            return buf;
+        }
+    }
+    return NULL;
+}
+
+static void _buf_add(xf_trace_buf_t *buf, const char *thread_name, bool auto_alloc)
+{
+    buf->thread_name = thread_name;
+    buf->head = 0;
+    buf->auto_alloc = auto_alloc;
+    buf->in_use = 1;
+    buf->tid = xf_atomic_fetch_add(&s_next_tid, 1, XF_ATOMIC_RELAXED);
+
+    xf_trace_buf_t *head = xf_atomic_load(&s_buf_list, XF_ATOMIC_RELAXED);
+    do {
+        buf->next = head;
+    } while (!xf_atomic_cas_weak(&s_buf_list, &head, buf, XF_ATOMIC_RELEASE, XF_ATOMIC_RELAXED));
+
+    s_tls_buf = buf;
+}
+
+static void _put(_out_t *out, const char *data, size_t len)
+{
+    if (len) {
+        out->write(out->user_data, data, len);
+    }
+}
+
+static void _put_cstr(_out_t *out, const char *str)
+{
+    size_t len = 0;
+    while (str[len]) {
+        len++;
+    }
+    _put(out, str, len);
+}
+
+/**
+ * @brief 输出带引号的 JSON 字符串, 转义引号、反斜杠和控制字符.
+ */
+static void _put_json_str(_out_t *out, const char *str)
+{
+    const char *run = str;
+    char esc[8];
+
+    _put(out, "\"", 1);
+    if (NULL == str) {
+        str = run = "(null)";
+    }
+    for (; *str; str++) {
+        unsigned char c = (unsigned char)*str;
+        if ((c >= 0x20) && (c != '"') && (c != '\\')) {
+            continue;
+        }
+        _put(out, run, (size_t)(str - run));
+        int n = (c < 0x20) ? xf_snprintf(esc, sizeof(esc), "\\u%04x", c)
+                           : xf_snprintf(esc, sizeof(esc), "\\%c", c);
+        _put(out, esc, (size_t)n);
+        run = str + 1;
+    }
+    _put(out, run, (size_t)(str - run));
+    _put(out, "\"", 1);
+}
+
+static void _put_event(_out_t *out, const xf_trace_buf_t *buf,
+                       const xf_trace_event_t *ev, bool *p_first)
+{
+    char line[LINE_BUF_SIZE];
+    int n;
+
+    if (ev->type >= sizeof(s_ph)) {
+        return;
+    }
+    /* ts 单位为 us, 保留 ns 精度 */
+    n = xf_snprintf(line, sizeof(line),
+                    "%s\n{\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%llu.%03u,\"name\":",
+                    *p_first ? "" : ",", s_ph[ev->type], (unsigned)buf->tid,
+                    (unsigned long long)(ev->ts / 1000U), (unsigned)(ev->ts % 1000U));
+    _put(out, line, (size_t)n);
+    _put_json_str(out, ev->name);
+    *p_first = false;
+
+    switch (ev->type) {
+    case XF_TRACE_TYPE_INSTANT:
+        _put_cstr(out, ",\"s\":\"t\"");
+        break;
+    case XF_TRACE_TYPE_COUNTER:
+        n = xf_snprintf(line, sizeof(line), ",\"args\":{\"value\":%lld}",
+                        (long long)ev->args[0]);
+        _put(out, line, (size_t)n);
+        _put_cstr(out, "}");
+        return;
+    default:
+        break;
+    }
+    if (ev->nargs) {
+        n = xf_snprintf(line, sizeof(line), ",\"args\":{\"arg0\":%lld,\"arg1\":%lld}",
+                        (long long)ev->args[0], (long long)ev->args[1]);
+        _put(out, line, (size_t)n);
+    }
+    _put_cstr(out, "}");
+}
+
+#endif /* XF_TRACE_IS_ENABLE */
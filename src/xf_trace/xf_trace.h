@@ -0,0 +1,237 @@
+/**
+ * @file xf_trace.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 轻量级事件追踪, 可导出为 Chrome trace-event JSON.
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 每个线程将 begin/end/instant/counter 事件写入自己的定长环形缓冲区,
+ * 写满后覆盖最旧的事件, 写入时不加锁. 导出的 JSON 可直接用
+ * chrome://tracing 或 https://ui.perfetto.dev 打开.
+ *
+ * - 事件名只保存指针, 必须指向生命周期足够长的字符串（通常为字符串常量）;
+ * - 时间戳来自 xf_time, 需要先对接 xf_time;
+ * - xf_trace_export_json() 与 xf_trace_clear() 要求写入方静止: 先 xf_trace_set_enable(false),
+ *   并确认没有线程仍在记录或绑定缓冲区（例如已 join 工作线程, 或各线程都到达同步点）;
+ * - 线程退出前调用 xf_trace_thread_detach(), 自动分配的缓冲区会被之后的新线程复用,
+ *   或在 xf_trace_clear() 时释放;
+ * - 需要编译器支持线程局部存储（XF_THREAD_LOCAL）.
+ *
+ * 用法:
+ * @code{.c}
+ * void foo(void)
+ * {
+ *     XF_TRACE_SCOPE("foo");
+ *     XF_TRACE_COUNTER("queue_len", len);
+ * }
+ * xf_trace_export_json(write_cb, fp);
+ * @endcode
+ */
+
+#ifndef __XF_TRACE_H__
+#define __XF_TRACE_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_trace_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @cond XFAPI_USER
+ * @ingroup group_xf_utils
+ * @defgroup group_xf_utils_trace xf_trace
+ * @brief 事件追踪, 导出 Chrome trace-event JSON。
+ * @endcond
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#if XF_TRACE_IS_ENABLE
+
+/**
+ * @brief 事件类型.
+ */
+#define XF_TRACE_TYPE_BEGIN             (0)     /*!< 区间开始, ph "B" */
+#define XF_TRACE_TYPE_END               (1)     /*!< 区间结束, ph "E" */
+#define XF_TRACE_TYPE_INSTANT           (2)     /*!< 瞬时事件, ph "i" */
+#define XF_TRACE_TYPE_COUNTER           (3)     /*!< 计数器, ph "C" */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 单个事件.
+ */
+typedef struct xf_trace_event_s {
+    uint64_t                ts;         /*!< 时间戳, ns */
+    const char             *name;       /*!< 事件名 */
+    uint8_t                 type;       /*!< 事件类型, 见 XF_TRACE_TYPE_* */
+    uint8_t                 nargs;      /*!< args 中有效参数个数 */
+    int64_t                 args[2];    /*!< 负载, counter 的值保存在 args[0] */
+} xf_trace_event_t;
+
+/**
+ * @brief 线程的事件环形缓冲区.
+ */
+typedef struct xf_trace_buf_s {
+    struct xf_trace_buf_s  *next;       /*!< 全局缓冲区链表 */
+    const char             *thread_name;/*!< 线程名, 可为 NULL */
+    uint32_t                tid;        /*!< 导出时使用的线程号 */
+    uint32_t                head;       /*!< 累计写入的事件数 */
+    uint8_t                 auto_alloc; /*!< 由 xf_trace 按需分配 */
+    uint8_t                 in_use;     /*!< 已绑定到某个线程 */
+    xf_trace_event_t        events[XF_TRACE_BUF_EVENTS];
+} xf_trace_buf_t;
+
+/**
+ * @brief 导出时的输出回调.
+ *
+ * @param user_data 用户数据.
+ * @param data 待输出的数据, 不以 '\0' 结尾.
+ * @param len 数据长度.
+ */
+typedef void (*xf_trace_write_cb_t)(void *user_data, const char *data, size_t len);
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 将 buf 绑定到当前线程, 此后该线程的事件写入 buf.
+ *
+ * 每个线程只能绑定一次, buf 的生命周期需覆盖导出.
+ *
+ * @param buf 缓冲区, 由调用者分配.
+ * @param thread_name 线程名, 可为 NULL.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_INITED         当前线程已绑定缓冲区
+ */
+xf_err_t xf_trace_thread_attach(xf_trace_buf_t *buf, const char *thread_name);
+
+/**
+ * @brief 解除当前线程与其缓冲区的绑定, 通常在线程退出前调用.
+ *
+ * 已记录的事件在下次 xf_trace_clear() 之前仍可导出.
+ * 自动分配的缓冲区之后可能被新线程复用（丢弃其中的事件）, 或在 xf_trace_clear() 时释放;
+ * 由 xf_trace_thread_attach() 绑定的缓冲区在 xf_trace_clear() 之后不再被引用, 调用者可以释放.
+ */
+void xf_trace_thread_detach(void);
+
+/**
+ * @brief 设置当前线程的线程名, 未绑定缓冲区时按需分配.
+ *
+ * @param thread_name 线程名.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               当前线程没有缓冲区
+ */
+xf_err_t xf_trace_thread_set_name(const char *thread_name);
+
+/**
+ * @brief 运行时开启或暂停记录. 默认开启.
+ *
+ * @param enable 是否记录.
+ */
+void xf_trace_set_enable(bool enable);
+
+/**
+ * @brief 记录一个事件. 通常通过 XF_TRACE_* 宏调用.
+ *
+ * @param type 事件类型.
+ * @param name 事件名.
+ * @param nargs 参数个数, 0~2.
+ * @param arg0 参数 0.
+ * @param arg1 参数 1.
+ */
+void xf_trace_record(uint8_t type, const char *name, uint8_t nargs, int64_t arg0, int64_t arg1);
+
+/**
+ * @brief 清空所有线程的缓冲区, 并移除、释放已解除绑定的缓冲区.
+ *
+ * @attention 调用期间不能有线程记录事件或绑定缓冲区.
+ */
+void xf_trace_clear(void);
+
+/**
+ * @brief 以 Chrome trace-event JSON 格式导出所有线程的事件.
+ *
+ * @attention 调用期间不能有线程记录事件, 否则正在被覆盖的事件可能不完整.
+ *
+ * @param write 输出回调, 可能被调用多次.
+ * @param user_data 传给 write 的用户数据.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_trace_export_json(xf_trace_write_cb_t write, void *user_data);
+
+/**
+ * @brief 作用域结束时记录 end 事件, 供 XF_TRACE_SCOPE 使用.
+ */
+static inline void xf_trace_scope_end(const char **p_name)
+{
+    xf_trace_record(XF_TRACE_TYPE_END, *p_name, 0, 0, 0);
+}
+
+/* ==================== [Macros] ============================================ */
+
+#define XF_TRACE_BEGIN(name) \
+    xf_trace_record(XF_TRACE_TYPE_BEGIN, (name), 0, 0, 0)
+#define XF_TRACE_BEGIN_ARGS(name, arg0, arg1) \
+    xf_trace_record(XF_TRACE_TYPE_BEGIN, (name), 2, (int64_t)(arg0), (int64_t)(arg1))
+#define XF_TRACE_END(name) \
+    xf_trace_record(XF_TRACE_TYPE_END, (name), 0, 0, 0)
+#define XF_TRACE_INSTANT(name) \
+    xf_trace_record(XF_TRACE_TYPE_INSTANT, (name), 0, 0, 0)
+#define XF_TRACE_INSTANT_ARGS(name, arg0, arg1) \
+    xf_trace_record(XF_TRACE_TYPE_INSTANT, (name), 2, (int64_t)(arg0), (int64_t)(arg1))
+#define XF_TRACE_COUNTER(name, value) \
+    xf_trace_record(XF_TRACE_TYPE_COUNTER, (name), 1, (int64_t)(value), 0)
+
+#if defined(__GNUC__)
+/**
+ * @brief 从此处到所在作用域结束记录为一个区间.
+ *
+ * @param name 区间名, 字符串常量.
+ */
+#   define XF_TRACE_SCOPE(name) \
+    const char *XCONCAT(_xf_trace_scope_, __LINE__) \
+        __attribute__((cleanup(xf_trace_scope_end))) = (name); \
+    XF_TRACE_BEGIN(XCONCAT(_xf_trace_scope_, __LINE__))
+#else
+#   define XF_TRACE_SCOPE(name)         XF_TRACE_INSTANT(name)
+#endif
+
+#else /* !XF_TRACE_IS_ENABLE */
+
+#define XF_TRACE_BEGIN(name)                    ((void)0)
+#define XF_TRACE_BEGIN_ARGS(name, arg0, arg1)   ((void)0)
+#define XF_TRACE_END(name)                      ((void)0)
+#define XF_TRACE_INSTANT(name)                  ((void)0)
+#define XF_TRACE_INSTANT_ARGS(name, arg0, arg1) ((void)0)
+#define XF_TRACE_COUNTER(name, value)           ((void)0)
+#define XF_TRACE_SCOPE(name)                    ((void)0)
+
+#endif /* XF_TRACE_IS_ENABLE */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_trace
+ * @}
+ */
+
+#endif /* __XF_TRACE_H__ */
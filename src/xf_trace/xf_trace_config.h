@@ -0,0 +1,66 @@
+/**
+ * @file xf_trace_config.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief xf_trace 配置。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+#ifndef __XF_TRACE_CONFIG_H__
+#define __XF_TRACE_CONFIG_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "../xf_utils_internal_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/**
+ * @brief 是否使能事件追踪。默认关闭, 关闭时所有 XF_TRACE_* 宏展开为空.
+ */
+#if defined(XF_TRACE_ENABLE) && (XF_TRACE_ENABLE)
+#   define XF_TRACE_IS_ENABLE           (1)
+#else
+#   define XF_TRACE_IS_ENABLE           (0)
+#endif
+
+/**
+ * @brief 每个线程环形缓冲区的事件数, 必须为 2 的幂.
+ */
+#if !defined(XF_TRACE_BUF_EVENTS)
+#   define XF_TRACE_BUF_EVENTS          (1024)
+#endif
+
+#if (XF_TRACE_BUF_EVENTS < 2) || (XF_TRACE_BUF_EVENTS & (XF_TRACE_BUF_EVENTS - 1))
+#   error "xf_trace: XF_TRACE_BUF_EVENTS must be a power of 2"
+#endif
+
+/**
+ * @brief 线程首次记录事件且未绑定缓冲区时, 是否通过 xf_malloc 自动分配.
+ *
+ * 关闭时未绑定缓冲区的线程的事件被丢弃.
+ */
+#if !defined(XF_TRACE_AUTO_ALLOC_ENABLE) || (XF_TRACE_AUTO_ALLOC_ENABLE)
+#   define XF_TRACE_AUTO_ALLOC_IS_ENABLE (1)
+#else
+#   define XF_TRACE_AUTO_ALLOC_IS_ENABLE (0)
+#endif
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Global Prototypes] ================================= */
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif // __XF_TRACE_CONFIG_H__
@@ -43,8 +43,23 @@
 #include "xf_common/xf_common.h"
 
 #include "xf_lock/xf_lock.h"
+#include "xf_time/xf_time.h"
+#include "xf_histogram/xf_histogram.h"
+#include "xf_trace/xf_trace.h"
 #include "xf_utils_log/xf_utils_log.h"
+#include "xf_utils_log/xf_utils_log_kv.h"
 #include "xf_check/xf_check.h"
+#include "xf_timer_wheel/xf_timer_wheel.h"
+#include "xf_strbuf/xf_strbuf.h"
+#include "xf_heap/xf_heap.h"
+#include "xf_hash/xf_hash.h"
+#include "xf_hashmap/xf_hashmap.h"
+#include "xf_crc/xf_crc.h"
+#include "xf_epoch/xf_epoch.h"
+#include "xf_skiplist/xf_skiplist.h"
+#include "xf_clist/xf_clist.h"
+#include "xf_thread/xf_thread.h"
+#include "xf_threadpool/xf_threadpool.h"
 
 #include "xf_std/xf_stdbool.h"
 #include "xf_std/xf_stddef.h"
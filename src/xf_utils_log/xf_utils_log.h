@@ -16,6 +16,8 @@
 
 #include "xf_utils_log_config.h"
 #include "../xf_common/xf_common.h"
+#include "xf_utils_log_router.h"
+#include "xf_utils_log_crash.h"
 
 /**
  * @cond XFAPI_USER
@@ -60,8 +62,29 @@ extern "C" {
 
 #endif /* XF_LOG_DUMP_IS_ENABLE */
 
+#if XF_LOG_STATS_IS_ENABLE
+#define XF_LOG_STATS_BY_BYTES   (0) /*!< 按累计字节数排序 */
+#define XF_LOG_STATS_BY_HITS    (1) /*!< 按调用次数排序 */
+#endif
+
 /* ==================== [Typedefs] ========================================== */
 
+#if XF_LOG_STATS_IS_ENABLE
+/**
+ * @brief 日志调用点描述符。每个 XF_LOGx 展开处拥有一个, 由编译器放入
+ * XF_LOG_STATS_SECTION 段。
+ */
+typedef struct xf_log_site_s {
+    const char     *file;       /*!< 文件名 */
+    const char     *func;       /*!< 函数名 */
+    const char     *tag;        /*!< 日志标签, 首次输出时记录 */
+    uint32_t        line;       /*!< 行号 */
+    uint8_t         level;      /*!< 日志等级 */
+    uint64_t        hits;       /*!< 输出次数 */
+    uint64_t        bytes;      /*!< 累计输出字节数 */
+} xf_log_site_t;
+#endif
+
 /* ==================== [Global Prototypes] ================================= */
 
 #if XF_LOG_DUMP_IS_ENABLE
@@ -78,8 +101,64 @@ extern "C" {
 xf_err_t xf_dump_mem(void *addr, size_t size, uint8_t flags_mask);
 #endif
 
+#if XF_LOG_STATS_IS_ENABLE
+/**
+ * @brief 获取按 by 排序的前 n 个日志调用点。
+ *
+ * @param sites 输出数组, 至少 n 个元素。
+ * @param n 数组大小。
+ * @param by 排序依据, XF_LOG_STATS_BY_BYTES 或 XF_LOG_STATS_BY_HITS。
+ * @return size_t 实际输出的个数。未输出过的调用点不参与排序。
+ */
+size_t xf_log_stats_top(const xf_log_site_t **sites, size_t n, uint8_t by);
+
+/**
+ * @brief 获取调用点总数（包括未输出过的）。
+ */
+size_t xf_log_stats_count(void);
+
+/**
+ * @brief 清零所有调用点的计数。
+ */
+void xf_log_stats_reset(void);
+
+/**
+ * @brief 通过 xf_log_printf 输出按 by 排序的前 n 个日志调用点。
+ *
+ * @param n 输出个数, 最大为 XF_LOG_STATS_DUMP_MAX。
+ * @param by 排序依据。
+ */
+void xf_log_stats_dump(size_t n, uint8_t by);
+
+static inline void xf_log_stats_hit(xf_log_site_t *site, const char *tag, int bytes)
+{
+    if (unlikely(NULL == xf_atomic_load(&site->tag, XF_ATOMIC_RELAXED))) {
+        xf_atomic_store(&site->tag, tag, XF_ATOMIC_RELAXED);
+    }
+    xf_atomic_fetch_add(&site->hits, 1, XF_ATOMIC_RELAXED);
+    xf_atomic_fetch_add(&site->bytes, (uint64_t)(bytes > 0 ? bytes : 0), XF_ATOMIC_RELAXED);
+}
+#endif
+
 /* ==================== [Macros] ============================================ */
 
+#if XF_LOG_STATS_IS_ENABLE
+/**
+ * @brief 为本次展开定义一个调用点描述符, 执行 expr 并统计其返回的字节数。
+ */
+#   define XF_LOG_SITE(level, tag, expr) __extension__ ({ \
+        static xf_log_site_t _xf_log_site \
+            __attribute__((used, aligned(8), section(XSTR(XF_LOG_STATS_SECTION)))) = { \
+            __FILE__, __FUNCTION__, NULL, __LINE__, level, 0, 0 \
+        }; \
+        int _xf_log_n = (int)(expr); \
+        xf_log_stats_hit(&_xf_log_site, (tag), _xf_log_n); \
+        _xf_log_n; \
+    })
+#else
+#   define XF_LOG_SITE(level, tag, expr) (expr)
+#endif
+
 #if XF_LOG_LEVEL >= XF_LOG_USER
 /**
  * @brief 用户等级日志。始终显示文件名、行号等信息。
@@ -89,7 +168,7 @@ xf_err_t xf_dump_mem(void *addr, size_t size, uint8_t flags_mask);
  * @param ... 可变参数。
  * @return size_t 本次日志字节数。
  */
-#   define XF_LOGU(tag, format, ...)  xf_log_level(XF_LOG_USER,     tag, format, ##__VA_ARGS__)
+#   define XF_LOGU(tag, format, ...)  XF_LOG_SITE(XF_LOG_USER, tag, xf_log_level(XF_LOG_USER,     tag, format, ##__VA_ARGS__))
 #else
 #   define XF_LOGU(tag, format, ...)  (void)(tag)
 #endif
@@ -103,7 +182,7 @@ xf_err_t xf_dump_mem(void *addr, size_t size, uint8_t flags_mask);
  * @param ... 可变参数。
  * @return size_t 本次日志字节数。
  */
-#   define XF_LOGE(tag, format, ...)  xf_log_level(XF_LOG_ERROR,    tag, format, ##__VA_ARGS__)
+#   define XF_LOGE(tag, format, ...)  XF_LOG_SITE(XF_LOG_ERROR, tag, xf_log_level(XF_LOG_ERROR,    tag, format, ##__VA_ARGS__))
 #else
 #   define XF_LOGE(tag, format, ...)  (void)(tag)
 #endif
@@ -117,7 +196,7 @@ xf_err_t xf_dump_mem(void *addr, size_t size, uint8_t flags_mask);
  * @param ... 可变参数。
  * @return size_t 本次日志字节数。
  */
-#   define XF_LOGW(tag, format, ...)  xf_log_level(XF_LOG_WARN,     tag, format, ##__VA_ARGS__)
+#   define XF_LOGW(tag, format, ...)  XF_LOG_SITE(XF_LOG_WARN, tag, xf_log_level(XF_LOG_WARN,     tag, format, ##__VA_ARGS__))
 #else
 #   define XF_LOGW(tag, format, ...)  (void)(tag)
 #endif
@@ -131,7 +210,7 @@ xf_err_t xf_dump_mem(void *addr, size_t size, uint8_t flags_mask);
  * @param ... 可变参数。
  * @return size_t 本次日志字节数。
  */
-#   define XF_LOGI(tag, format, ...)  xf_log_level(XF_LOG_INFO,     tag, format, ##__VA_ARGS__)
+#   define XF_LOGI(tag, format, ...)  XF_LOG_SITE(XF_LOG_INFO, tag, xf_log_level(XF_LOG_INFO,     tag, format, ##__VA_ARGS__))
 #else
 #   define XF_LOGI(tag, format, ...)  (void)(tag)
 #endif
@@ -145,7 +224,7 @@ xf_err_t xf_dump_mem(void *addr, size_t size, uint8_t flags_mask);
  * @param ... 可变参数。
  * @return size_t 本次日志字节数。
  */
-#   define XF_LOGD(tag, format, ...)  xf_log_level(XF_LOG_DEBUG,    tag, format, ##__VA_ARGS__)
+#   define XF_LOGD(tag, format, ...)  XF_LOG_SITE(XF_LOG_DEBUG, tag, xf_log_level(XF_LOG_DEBUG,    tag, format, ##__VA_ARGS__))
 #else
 #   define XF_LOGD(tag, format, ...)  (void)(tag)
 #endif
@@ -159,7 +238,7 @@ xf_err_t xf_dump_mem(void *addr, size_t size, uint8_t flags_mask);
  * @param ... 可变参数。
  * @return size_t 本次日志字节数。
  */
-#   define XF_LOGV(tag, format, ...)  xf_log_level(XF_LOG_VERBOSE,  tag, format, ##__VA_ARGS__)
+#   define XF_LOGV(tag, format, ...)  XF_LOG_SITE(XF_LOG_VERBOSE, tag, xf_log_level(XF_LOG_VERBOSE,  tag, format, ##__VA_ARGS__))
 #else
 #   define XF_LOGV(tag, format, ...)  (void)(tag)
 #endif
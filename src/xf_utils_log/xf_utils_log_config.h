@@ -46,9 +46,60 @@ extern "C" {
 #   error "log level must between 0 to 6"
 #endif
 
+// 是否使能日志路由：日志只格式化一次，再分发给多个已注册的输出（sink），默认关闭。
+// 使能后默认的 xf_log_level/xf_log_printf/xf_log_kv_write 均输出到路由。
+#if defined(XF_LOG_ROUTER_ENABLE) && (XF_LOG_ROUTER_ENABLE)
+#   define XF_LOG_ROUTER_IS_ENABLE (1)
+#else
+#   define XF_LOG_ROUTER_IS_ENABLE (0)
+#endif
+
+// 日志路由单条日志的最大字节数（含前缀），超出部分被截断。
+#if !defined(XF_LOG_ROUTER_BUF_SIZE)
+#   define XF_LOG_ROUTER_BUF_SIZE 256
+#endif
+
+// 是否使能崩溃日志环：所有日志额外写入一块固定大小的内存环形缓冲区，
+// 复位后或在崩溃时（如 Linux 信号处理函数中）导出，默认关闭。
+#if defined(XF_LOG_CRASH_ENABLE) && (XF_LOG_CRASH_ENABLE)
+#   define XF_LOG_CRASH_IS_ENABLE (1)
+#else
+#   define XF_LOG_CRASH_IS_ENABLE (0)
+#endif
+
+// 崩溃日志环的容量（字节），必须是 2 的幂。
+#if !defined(XF_LOG_CRASH_SIZE)
+#   define XF_LOG_CRASH_SIZE 4096
+#endif
+
+#if (XF_LOG_CRASH_SIZE & (XF_LOG_CRASH_SIZE - 1)) != 0
+#   error "XF_LOG_CRASH_SIZE must be a power of 2"
+#endif
+
+// 崩溃日志环所在的段。需要在链接脚本中将该段设为 NOLOAD（不清零），复位后才能保留内容。
+// 需要使能 XF_ATTRIBUTE_ENABLE，否则日志环放在普通的 .bss 中，复位后不保留。
+#if !defined(XF_LOG_CRASH_SECTION)
+#   define XF_LOG_CRASH_SECTION ".noinit"
+#endif
+
+// 未使能日志路由时，崩溃日志环先在栈上格式化单条日志，该值为缓冲区大小，写入日志环的记录超长时被截断（保留末尾换行）。
+#if !defined(XF_LOG_CRASH_LINE_SIZE)
+#   define XF_LOG_CRASH_LINE_SIZE 256
+#endif
+
+// log 对接 va_list 版本的打印函数，崩溃日志环遇到超长日志时用它完整输出。
+// 自行对接 xf_log_printf 时需一并对接，否则超长日志只输出截断后的内容。
+#if !defined(xf_log_vprintf) && !defined(xf_log_printf) && !XF_LOG_ROUTER_IS_ENABLE
+#   define xf_log_vprintf(format, ap) vprintf(format, ap)
+#endif
+
 // log 对接打印函数， 简化版对接。
 #if !defined(xf_log_printf)
-#   define xf_log_printf(format, ...) printf(format, ##__VA_ARGS__)
+#   if XF_LOG_ROUTER_IS_ENABLE
+#       define xf_log_printf(format, ...) xf_log_router_printf(XF_LOG_INFO, format, ##__VA_ARGS__)
+#   else
+#       define xf_log_printf(format, ...) printf(format, ##__VA_ARGS__)
+#   endif
 #endif
 
 // log 对接打印二进制的后端，默认使用xf_log_printf打印
@@ -56,9 +107,81 @@ extern "C" {
 #   define xf_log_dump_printf(format, ...) xf_log_printf(format, ##__VA_ARGS__)
 #endif
 
-// log对接, 如果不独立对接xf_log_level，则会调用xf_log_printf实现
-#if !defined(xf_log_level) && defined(xf_log_printf)
-#define xf_log_level(level, tag, format, ...) xf_log_printf("%c-%s[:%d(%s)]: "format"\n", #level[7], tag, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+// 是否统计每个日志调用点的次数和字节数，默认关闭。
+// 依赖 GNU 扩展和链接器自动生成的 __start_/__stop_ 段符号，
+// 且要求 xf_log_level 返回本次输出的字节数（默认的 printf 满足）。
+#if defined(XF_LOG_STATS_ENABLE) && (XF_LOG_STATS_ENABLE)
+#   define XF_LOG_STATS_IS_ENABLE (1)
+#else
+#   define XF_LOG_STATS_IS_ENABLE (0)
+#endif
+
+#if XF_LOG_STATS_IS_ENABLE && !defined(__GNUC__)
+#   error "XF_LOG_STATS_ENABLE requires GNU C extensions"
+#endif
+
+// 存放调用点描述符的段名，必须是合法的 C 标识符。
+// 自定义链接脚本时需要 KEEP 该段并提供 __start_/__stop_ 符号。
+#if !defined(XF_LOG_STATS_SECTION)
+#   define XF_LOG_STATS_SECTION xf_log_sites
+#endif
+
+// xf_log_stats_dump() 一次最多输出的调用点个数。
+#if !defined(XF_LOG_STATS_DUMP_MAX)
+#   define XF_LOG_STATS_DUMP_MAX 16
+#endif
+
+// 结构化日志（XF_LOGx_KV）单条记录的最大字节数，记录在栈上的该大小缓冲区中序列化。
+#if !defined(XF_LOG_KV_BUF_SIZE)
+#   define XF_LOG_KV_BUF_SIZE 256
+#endif
+
+#if (XF_LOG_KV_BUF_SIZE < 64)
+#   error "XF_LOG_KV_BUF_SIZE must be at least 64"
+#endif
+
+// 结构化日志的输出后端，输入为一整条 JSON 行（含 '\n'），默认使用xf_log_printf输出
+#if !defined(xf_log_kv_write)
+#   if XF_LOG_ROUTER_IS_ENABLE
+#       define xf_log_kv_write(level, buf, len) xf_log_router_write(level, buf, len)
+#   else
+#       define xf_log_kv_write(level, buf, len) xf_log_printf("%.*s", (int)(len), (buf))
+#   endif
+#endif
+
+// 是否在默认的 xf_log_level 中输出时间戳，默认关闭。
+#if defined(XF_LOG_TIMESTAMP_ENABLE) && (XF_LOG_TIMESTAMP_ENABLE)
+#   define XF_LOG_TIMESTAMP_IS_ENABLE (1)
+#else
+#   define XF_LOG_TIMESTAMP_IS_ENABLE (0)
+#endif
+
+#if XF_LOG_TIMESTAMP_IS_ENABLE
+#   include "../xf_time/xf_time.h"
+// 时间戳来源，默认为 xf_time 的单调毫秒数（不产生系统调用，取决于 xf_time 的对接）。
+#   if !defined(XF_LOG_TIMESTAMP_GET)
+#       define XF_LOG_TIMESTAMP_GET() xf_time_get_ms()
+#   endif
+#endif
+
+// 默认 xf_log_level 的日志前缀，lvl_ch 为等级字符。
+// 使能路由时由 xf_log_router_printf_prefix() 按相同格式直接拼接，不经过 printf。
+#if XF_LOG_TIMESTAMP_IS_ENABLE
+#   define XF_LOG_PREFIX_FMT "%c (%lu)-%s[:%d(%s)]: "
+#   define XF_LOG_PREFIX_ARGS(lvl_ch, tag) lvl_ch, (unsigned long)XF_LOG_TIMESTAMP_GET(), tag, __LINE__, __FUNCTION__
+#else
+#   define XF_LOG_PREFIX_FMT "%c-%s[:%d(%s)]: "
+#   define XF_LOG_PREFIX_ARGS(lvl_ch, tag) lvl_ch, tag, __LINE__, __FUNCTION__
+#endif
+
+// log对接, 如果不独立对接xf_log_level，则会调用xf_log_printf实现（使能路由时直接输出到路由，
+// 未使能路由但使能崩溃日志环时先写入日志环再输出）
+#if !defined(xf_log_level) && XF_LOG_ROUTER_IS_ENABLE
+#define xf_log_level(level, tag, format, ...) xf_log_router_printf_prefix(level, tag, __LINE__, __FUNCTION__, format"\n", ##__VA_ARGS__)
+#elif !defined(xf_log_level) && XF_LOG_CRASH_IS_ENABLE
+#define xf_log_level(level, tag, format, ...) xf_log_crash_printf(XF_LOG_PREFIX_FMT format"\n", XF_LOG_PREFIX_ARGS(#level[7], tag), ##__VA_ARGS__)
+#elif !defined(xf_log_level) && defined(xf_log_printf)
+#define xf_log_level(level, tag, format, ...) xf_log_printf(XF_LOG_PREFIX_FMT format"\n", XF_LOG_PREFIX_ARGS(#level[7], tag), ##__VA_ARGS__)
 #endif
 
 /* log优先使用xf_log_level作为自己的对接方式，如果没有则使用xf_log_printf*/
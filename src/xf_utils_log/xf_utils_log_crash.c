@@ -0,0 +1,289 @@
+/**
+ * @file xf_utils_log_crash.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 崩溃日志环。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils_log_config.h"
+
+#if XF_LOG_CRASH_IS_ENABLE
+
+#include <stdarg.h>
+#include "xf_utils_log.h"
+#include "../xf_std/xf_stdio.h"
+#include "../xf_std/xf_string.h"
+
+/* ==================== [Defines] =========================================== */
+
+#define RING_SIZE                       ((uint32_t)XF_LOG_CRASH_SIZE)
+#define RING_MASK                       (RING_SIZE - 1)
+#define RING_MAGIC                      ((uint32_t)0x584c4352UL) /* "XLCR" */
+
+/* 文本输出时每次交给 xf_log_dump_printf 的最大字节数, 不超过路由的单条缓冲区 */
+#define PRINT_CHUNK                     (128)
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 日志环. 整体放在不清零的段中, 头部用于复位后校验.
+ */
+typedef struct {
+    uint32_t    magic;                  /*!< RING_MAGIC 时有效 */
+    uint32_t    size;                   /*!< 容量, 与编译时不一致时视为无效 */
+    uint32_t    check;                  /*!< ~(magic ^ size) */
+    uint32_t    head;                   /*!< 累计写入字节数, 低位即写入位置 */
+    uint32_t    wrapped;                /*!< 是否已写满过一圈 */
+    char        data[XF_LOG_CRASH_SIZE];
+} crash_ring_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static bool _is_valid(void);
+static uint32_t _used(uint32_t head);
+#if XF_LOG_ROUTER_IS_ENABLE
+static void _sink_write(xf_log_sink_t *sink, const char *data, size_t len);
+#endif
+static void _print_cb(const char *data, size_t len, void *user_data);
+#if XF_LOG_DUMP_IS_ENABLE
+static void _dump_mem_cb(const char *data, size_t len, void *user_data);
+#endif
+
+/* ==================== [Static Variables] ================================== */
+
+#if XF_ATTRIBUTE_IS_ENABLE
+static crash_ring_t s_ring __section(XF_LOG_CRASH_SECTION);
+#else
+/* 无法指定段, 日志环放在普通的 .bss 中, 复位后不保留 */
+static crash_ring_t s_ring;
+#endif
+
+/* 导出到日志输出时暂停写入, 避免读到正在被覆盖的内容 */
+static volatile bool s_paused = false;
+
+#if XF_LOG_ROUTER_IS_ENABLE
+static xf_log_sink_t s_sink;
+#endif
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+bool xf_log_crash_init(void)
+{
+    bool restored = _is_valid();
+    if (!restored) {
+        s_ring.head = 0;
+        s_ring.wrapped = 0;
+        s_ring.size = RING_SIZE;
+        s_ring.check = (uint32_t)~(RING_MAGIC ^ RING_SIZE);
+        xf_atomic_store(&s_ring.magic, RING_MAGIC, XF_ATOMIC_RELEASE);
+    }
+#if XF_LOG_ROUTER_IS_ENABLE
+    if (NULL == s_sink.write) {
+        xf_log_sink_init(&s_sink, _sink_write, NULL, XF_LOG_VERBOSE);
+        xf_log_router_add(&s_sink);
+    }
+#endif
+    return restored && (0 != _used(s_ring.head));
+}
+
+void xf_log_crash_write(const char *data, size_t len)
+{
+    if ((RING_MAGIC != xf_atomic_load(&s_ring.magic, XF_ATOMIC_ACQUIRE)) || s_paused) {
+        return;
+    }
+    /* 超过容量时只保留最后 RING_SIZE 字节 */
+    if (len > RING_SIZE) {
+        data += len - RING_SIZE;
+        len = RING_SIZE;
+    }
+    /* 先占位再拷贝, 并发写入时各自写入不同的区域 */
+#if XF_ATOMIC_IS_SUPPORTED
+    uint32_t head = xf_atomic_fetch_add(&s_ring.head, (uint32_t)len, XF_ATOMIC_RELAXED);
+#else
+    uint32_t head = s_ring.head;
+    s_ring.head = head + (uint32_t)len;
+#endif
+    uint32_t pos = head & RING_MASK;
+    size_t first = RING_SIZE - pos;
+    if (first > len) {
+        first = len;
+    } else {
+        s_ring.wrapped = 1;
+    }
+    xf_memcpy(s_ring.data + pos, data, first);
+    xf_memcpy(s_ring.data, data + first, len - first);
+}
+
+int xf_log_crash_printf(const char *format, ...)
+{
+    char buf[XF_LOG_CRASH_LINE_SIZE];
+    va_list args;
+
+    va_start(args, format);
+#if defined(xf_log_vprintf)
+    va_list args_out;
+    va_copy(args_out, args);
+#endif
+    int n = xf_vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (n < 0) {
+#if defined(xf_log_vprintf)
+        va_end(args_out);
+#endif
+        return n;
+    }
+    size_t len = ((size_t)n < sizeof(buf)) ? (size_t)n : (sizeof(buf) - 1);
+    bool truncated = (len < (size_t)n);
+#if defined(xf_log_vprintf)
+    if (truncated) {
+        /* 输出不受单条缓冲区限制, 重新格式化完整的一行 */
+        xf_log_vprintf(format, args_out);
+    } else {
+        xf_log_printf("%.*s", (int)len, buf);
+    }
+    va_end(args_out);
+#else
+    xf_log_printf("%.*s", (int)len, buf);
+#endif
+    if (truncated) {
+        /* 截断时保留格式串末尾的换行, 日志环中的记录仍按行分隔 */
+        size_t fmt_len = xf_strlen(format);
+        if ((fmt_len > 0) && ('\n' == format[fmt_len - 1]) && (len > 0)) {
+            buf[len - 1] = '\n';
+        }
+    }
+    xf_log_crash_write(buf, len);
+    return n;
+}
+
+size_t xf_log_crash_read(char *out, size_t size)
+{
+    if ((NULL == out) || !_is_valid()) {
+        return 0;
+    }
+    uint32_t head = xf_atomic_load(&s_ring.head, XF_ATOMIC_RELAXED);
+    size_t n = _used(head);
+    if (n > size) {
+        n = size;
+    }
+    uint32_t start = (head - (uint32_t)n) & RING_MASK;
+    size_t first = RING_SIZE - start;
+    if (first > n) {
+        first = n;
+    }
+    xf_memcpy(out, s_ring.data + start, first);
+    xf_memcpy(out + first, s_ring.data, n - first);
+    return n;
+}
+
+size_t xf_log_crash_dump(xf_log_crash_dump_cb_t cb, void *user_data)
+{
+    if ((NULL == cb) || !_is_valid()) {
+        return 0;
+    }
+    uint32_t head = xf_atomic_load(&s_ring.head, XF_ATOMIC_RELAXED);
+    uint32_t n = _used(head);
+    uint32_t start = (head - n) & RING_MASK;
+
+    /* 回绕后最早的一行通常不完整, 跳过 */
+    if (s_ring.wrapped) {
+        uint32_t skip = 0;
+        while ((skip < n) && ('\n' != s_ring.data[(start + skip) & RING_MASK])) {
+            skip++;
+        }
+        if (skip < n) {
+            skip++;
+            start = (start + skip) & RING_MASK;
+            n -= skip;
+        }
+    }
+    if (0 == n) {
+        return 0;
+    }
+    uint32_t first = RING_SIZE - start;
+    if (first > n) {
+        first = n;
+    }
+    cb(s_ring.data + start, first, user_data);
+    if (n > first) {
+        cb(s_ring.data, n - first, user_data);
+    }
+    return n;
+}
+
+void xf_log_crash_print(void)
+{
+    bool paused = s_paused;
+    s_paused = true;
+    xf_log_crash_dump(_print_cb, NULL);
+    s_paused = paused;
+}
+
+#if XF_LOG_DUMP_IS_ENABLE
+xf_err_t xf_log_crash_dump_mem(uint8_t flags_mask)
+{
+    bool paused = s_paused;
+    s_paused = true;
+    size_t n = xf_log_crash_dump(_dump_mem_cb, &flags_mask);
+    s_paused = paused;
+    return (0 == n) ? XF_ERR_NOT_FOUND : XF_OK;
+}
+#endif
+
+void xf_log_crash_clear(void)
+{
+    if (_is_valid()) {
+        xf_atomic_store(&s_ring.head, 0, XF_ATOMIC_RELAXED);
+        s_ring.wrapped = 0;
+    }
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static bool _is_valid(void)
+{
+    return (RING_MAGIC == s_ring.magic)
+           && (RING_SIZE == s_ring.size)
+           && ((uint32_t)~(RING_MAGIC ^ RING_SIZE) == s_ring.check);
+}
+
+static uint32_t _used(uint32_t head)
+{
+    return s_ring.wrapped ? RING_SIZE : (head & RING_MASK);
+}
+
+#if XF_LOG_ROUTER_IS_ENABLE
+static void _sink_write(xf_log_sink_t *sink, const char *data, size_t len)
+{
+    UNUSED(sink);
+    xf_log_crash_write(data, len);
+}
+#endif
+
+static void _print_cb(const char *data, size_t len, void *user_data)
+{
+    UNUSED(user_data);
+    while (len > 0) {
+        size_t n = (len < PRINT_CHUNK) ? len : PRINT_CHUNK;
+        xf_log_dump_printf("%.*s", (int)n, data);
+        data += n;
+        len -= n;
+    }
+}
+
+#if XF_LOG_DUMP_IS_ENABLE
+static void _dump_mem_cb(const char *data, size_t len, void *user_data)
+{
+    xf_dump_mem((void *)data, len, *(uint8_t *)user_data);
+}
+#endif
+
+#endif /* XF_LOG_CRASH_IS_ENABLE */
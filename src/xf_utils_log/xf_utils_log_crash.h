@@ -0,0 +1,154 @@
+/**
+ * @file xf_utils_log_crash.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 崩溃日志环。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 一块 XF_LOG_CRASH_SIZE 字节的环形缓冲区, 连同其头部放在 XF_LOG_CRASH_SECTION 段中,
+ * 保存最近输出的日志文本. 段不被启动代码清零时, 复位后通过头部的魔数判断内容是否有效,
+ * 可以导出复位前最后的日志.
+ *
+ * - 使能路由时作为一个 sink 加入路由, 每条日志只多一次 memcpy;
+ * - 未使能路由时默认的 xf_log_level 先在栈上格式化, 写入日志环后再由 xf_log_printf 输出;
+ * - xf_log_crash_dump() 不加锁、不分配内存, 可以在信号处理函数或异常处理中调用.
+ *
+ * 用法:
+ * @code{.c}
+ * if (xf_log_crash_init()) {
+ *     xf_log_crash_print();     // 输出复位前的日志
+ *     xf_log_crash_clear();
+ * }
+ * @endcode
+ */
+
+#ifndef __XF_UTILS_LOG_CRASH_H__
+#define __XF_UTILS_LOG_CRASH_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils_log_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+
+#if XF_LOG_CRASH_IS_ENABLE
+
+/**
+ * @ingroup group_xf_utils_log
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 导出回调.
+ *
+ * @param data 日志文本, 不以 '\0' 结尾.
+ * @param len 长度.
+ * @param user_data 用户数据.
+ */
+typedef void (*xf_log_crash_dump_cb_t)(const char *data, size_t len, void *user_data);
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化崩溃日志环. 应在输出第一条日志前调用.
+ *
+ * 日志环头部有效（复位前已初始化且段未被清零）时保留其内容, 否则清空.
+ * 使能路由时同时将日志环 sink 加入路由.
+ *
+ * @return bool
+ *      - true          保留了复位前的日志
+ *      - false         日志环为空
+ */
+bool xf_log_crash_init(void);
+
+/**
+ * @brief 写入一段日志文本. 未初始化时忽略.
+ *
+ * @param data 文本.
+ * @param len 长度. 超过容量时只保留最后 XF_LOG_CRASH_SIZE 字节.
+ */
+void xf_log_crash_write(const char *data, size_t len);
+
+/**
+ * @brief 格式化一条日志, 通过 xf_log_printf 输出后写入日志环.
+ *        未使能路由时默认的 xf_log_level 使用该函数.
+ *
+ * 在栈上格式化, 写入日志环的记录最长 XF_LOG_CRASH_LINE_SIZE - 1 字节, 超出部分被截断;
+ * 截断时若格式串以换行结尾, 最后一个字节替换为换行.
+ * 超长日志通过 xf_log_vprintf 完整输出; 未对接 xf_log_vprintf 时只输出截断后的内容.
+ *
+ * @return int 格式化后的完整长度, 出错时为负数.
+ */
+int xf_log_crash_printf(const char *format, ...);
+
+/**
+ * @brief 按写入顺序读出日志环中的内容.
+ *
+ * @param out 输出缓冲区.
+ * @param size 输出缓冲区大小. 小于有效字节数时只读出最近的 size 字节.
+ * @return size_t 读出的字节数.
+ */
+size_t xf_log_crash_read(char *out, size_t size);
+
+/**
+ * @brief 按写入顺序导出日志环中的内容, 发生过回绕时从第一个完整行开始.
+ *
+ * 只访问日志环本身, 可以在信号处理函数中调用（cb 也应是异步信号安全的）.
+ *
+ * @param cb 导出回调, 最多调用两次.
+ * @param user_data 用户数据.
+ * @return size_t 导出的字节数.
+ */
+size_t xf_log_crash_dump(xf_log_crash_dump_cb_t cb, void *user_data);
+
+/**
+ * @brief 通过 xf_log_dump_printf 以文本形式输出日志环中的内容.
+ *        输出期间暂停写入日志环.
+ */
+void xf_log_crash_print(void);
+
+#if XF_LOG_DUMP_IS_ENABLE
+/**
+ * @brief 通过 xf_dump_mem() 以十六进制输出日志环中的内容.
+ *        输出期间暂停写入日志环.
+ *
+ * @param flags_mask 格式掩码，见 XF_DUMP_FLAG_*。
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_NOT_FOUND      日志环为空
+ */
+xf_err_t xf_log_crash_dump_mem(uint8_t flags_mask);
+#endif
+
+/**
+ * @brief 清空日志环.
+ */
+void xf_log_crash_clear(void);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_log
+ * @}
+ */
+
+#endif /* XF_LOG_CRASH_IS_ENABLE */
+
+#endif /* __XF_UTILS_LOG_CRASH_H__ */
@@ -16,6 +16,8 @@
 #if XF_LOG_DUMP_IS_ENABLE
 
 #include "xf_utils_log.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_std/xf_string.h"
 
 /* ==================== [Defines] =========================================== */
 
@@ -27,13 +29,22 @@
 #define XF_DUMP_HEX_ASCII_ESCAPE_BYTES_PER_LINE     (104)
 /* 表头字节数，可能会多几个字节 */
 #define XF_DUMP_TABLE_HEADER_BYTES                  (332)
+/* 行缓冲区大小，可容纳最长的一行（含 20 位行号） */
+#define XF_DUMP_LINE_BUF_SIZE                       (XF_DUMP_HEX_ASCII_ESCAPE_BYTES_PER_LINE + 24)
 
 /* ==================== [Typedefs] ========================================== */
 
 /* ==================== [Static Prototypes] ================================= */
 
+static char *_put_hex2(char *p, uint8_t b, const char *digits);
+static char *_put_str(char *p, const char *s, size_t n);
+static void _output_line(const char *line, const char *end);
+
 /* ==================== [Static Variables] ================================== */
 
+static const char s_hex_upper[] = "0123456789ABCDEF";
+static const char s_hex_lower[] = "0123456789abcdef";
+
 /* ==================== [Macros] ============================================ */
 
 /* ==================== [Global Functions] ================================== */
@@ -63,99 +74,138 @@ xf_err_t xf_dump_mem(void *addr, size_t size, uint8_t flags_mask)
     // 打印内存块的起始地址
     xf_log_dump_printf("MEMORY START ADDRESS: %p, OUTPUT %d BYTES.\n", addr, (int)size);
 
+    // 每行先写入行缓冲区，再一次输出，避免逐字节调用 printf
+    char line[XF_DUMP_LINE_BUF_SIZE];
+    char *p = line;
+
     // 打印表头
     if (BIT_GET(flags_mask, XF_DUMP_HEAD_BIT)) {
-        for (uint8_t i = 0; i < bytes_actually_out_per_line; i++) {
-            xf_log_dump_printf("-");
-        }
-        xf_log_dump_printf("\n");
-        xf_log_dump_printf(" OFS  "); // 偏移 offset
+        xf_memset(line, '-', bytes_actually_out_per_line);
+        p = line + bytes_actually_out_per_line;
+        *p++ = '\n';
+        _output_line(line, p);
+        p = _put_str(line, " OFS  ", 6); // 偏移 offset
         for (uint8_t i = 0; i < bytes_mem_out_per_line; i++) {
-            xf_log_dump_printf("%2X ", i);
+            *p++ = ' ';
+            *p++ = s_hex_upper[i & 0xf];
+            *p++ = ' ';
         }
         if (BIT_GET(flags_mask, XF_DUMP_ASCII_BIT)) {
-            xf_log_dump_printf("| ASCII");
+            p = _put_str(p, "| ASCII", 7);
         }
-        xf_log_dump_printf("\n");
-        for (uint8_t i = 0; i < bytes_actually_out_per_line; i++) {
-            xf_log_dump_printf("-");
-        }
-        xf_log_dump_printf("\n");
+        *p++ = '\n';
+        _output_line(line, p);
+        p = line + bytes_actually_out_per_line;
+        *p++ = '\n';
+        xf_memset(line, '-', bytes_actually_out_per_line);
+        _output_line(line, p);
     }
 
-    uint8_t byte = 0; // 当前地址的字节的值
-    // 遍历内存块中
-    for (size_t i = 0; i < size; i++) {
-        byte = *((uint8_t *)addr + i);
+    const uint8_t *mem = (const uint8_t *)addr;
+    for (size_t row = 0; row < size; row += bytes_mem_out_per_line) {
+        size_t n = size - row;
+        if (n > bytes_mem_out_per_line) {
+            n = bytes_mem_out_per_line;
+        }
 
-        if (i % bytes_mem_out_per_line == 0) {
-            // 每行的开头打印行号
-            xf_log_dump_printf("%04lu: ", (unsigned long)(i / bytes_mem_out_per_line));
+        // 每行的开头打印行号（至少 4 位）
+        char num[XF_U64TOA_BUF_SIZE];
+        size_t num_len = xf_u64toa((uint64_t)(row / bytes_mem_out_per_line), num);
+        p = line;
+        for (size_t k = num_len; k < 4; k++) {
+            *p++ = '0';
+        }
+        p = _put_str(p, num, num_len);
+        *p++ = ':';
+        *p++ = ' ';
+
+        // 当前地址的字节的值的十六进制
+        for (size_t j = 0; j < n; j++) {
+            p = _put_hex2(p, mem[row + j], s_hex_upper);
+            *p++ = ' ';
+        }
+        // 如果不是每行显示的字节数，就补齐空格
+        if (n < bytes_mem_out_per_line) {
+            size_t pad = (bytes_mem_out_per_line - n) * 3;
+            xf_memset(p, ' ', pad);
+            p += pad;
         }
 
-        xf_log_dump_printf("%02X ", byte); // 打印当前地址的字节的值的十六进制
-
-        // 如果达到每行显示的字节数，
-        // 或者已经是最后一个字节，就打印 ASCII 字符串
-        if (((i + 1) % bytes_mem_out_per_line == 0) || (i == size - 1)) {
-            // 如果不是每行显示的字节数，就补齐空格
-            if ((i + 1) % bytes_mem_out_per_line != 0) {
-                for (size_t j = 0;
-                        j < (bytes_mem_out_per_line - (i + 1) % bytes_mem_out_per_line) * 3;
-                        j++) {
-                    xf_log_dump_printf(" ");
-                }
-            }
-            // 遍历输出 ASCII
-            if (BIT_GET(flags_mask, XF_DUMP_ASCII_BIT)) {
-                xf_log_dump_printf("| ");
-                for (size_t j = i - i % bytes_mem_out_per_line; j <= i; j++) {
-                    uint8_t b = *((uint8_t *)addr + j);
-                    if (b >= ' ' && b <= '~') { // 可见字符
-                        if (BIT_GET(flags_mask, XF_DUMP_ESCAPE_BIT)) {
-                            xf_log_dump_printf(" ");
-                        }
-                        xf_log_dump_printf("%c", b);
-                        if (BIT_GET(flags_mask, XF_DUMP_ESCAPE_BIT)) {
-                            xf_log_dump_printf(" ");
-                        }
-                    } else if (BIT_GET(flags_mask, XF_DUMP_ESCAPE_BIT)) {
-                        // 显示转义字符
-                        switch (b) {
-                        case '\0': xf_log_dump_printf("\\0 "); break; // 空字符
-                        case '\a': xf_log_dump_printf("\\a "); break; // 响铃符
-                        case '\b': xf_log_dump_printf("\\b "); break; // 退格符
-                        case '\t': xf_log_dump_printf("\\t "); break; // 水平制表符
-                        case '\n': xf_log_dump_printf("\\n "); break; // 换行符
-                        case '\v': xf_log_dump_printf("\\v "); break; // 垂直制表符
-                        case '\f': xf_log_dump_printf("\\f "); break; // 换页符
-                        case '\r': xf_log_dump_printf("\\r "); break; // 回车符
-                        // 其他不可打印字符，用十六进制表示
-                        default: xf_log_dump_printf("%02x ", b); break;
-                        }
+        // 遍历输出 ASCII
+        if (BIT_GET(flags_mask, XF_DUMP_ASCII_BIT)) {
+            bool escape = BIT_GET(flags_mask, XF_DUMP_ESCAPE_BIT);
+            *p++ = '|';
+            *p++ = ' ';
+            for (size_t j = 0; j < n; j++) {
+                uint8_t b = mem[row + j];
+                if (b >= ' ' && b <= '~') { // 可见字符
+                    if (escape) {
+                        *p++ = ' ';
+                    }
+                    *p++ = (char)b;
+                    if (escape) {
+                        *p++ = ' ';
+                    }
+                } else if (escape) {
+                    // 显示转义字符
+                    char e = 0;
+                    switch (b) {
+                    case '\0': e = '0'; break; // 空字符
+                    case '\a': e = 'a'; break; // 响铃符
+                    case '\b': e = 'b'; break; // 退格符
+                    case '\t': e = 't'; break; // 水平制表符
+                    case '\n': e = 'n'; break; // 换行符
+                    case '\v': e = 'v'; break; // 垂直制表符
+                    case '\f': e = 'f'; break; // 换页符
+                    case '\r': e = 'r'; break; // 回车符
+                    default: break;
+                    }
+                    if (e) {
+                        *p++ = '\\';
+                        *p++ = e;
                     } else {
-                        // 转义字符外的不可见字符
-                        xf_log_dump_printf(".");
-                        if (BIT_GET(flags_mask, XF_DUMP_ESCAPE_BIT)) {
-                            xf_log_dump_printf("  ");
-                        }
-                    } /* else: 非转义字符 */
-                } /* for: 输出 ASCII */
-            } /* if: 需要输出 ASCII */
-            xf_log_dump_printf("\n");
-        } /* if: 需要输出 ASCII 或空格 */
+                        // 其他不可打印字符，用十六进制表示
+                        p = _put_hex2(p, b, s_hex_lower);
+                    }
+                    *p++ = ' ';
+                } else {
+                    // 转义字符外的不可见字符
+                    *p++ = '.';
+                }
+            } /* for: 输出 ASCII */
+        } /* if: 需要输出 ASCII */
+        *p++ = '\n';
+        _output_line(line, p);
     } /* for: 0 ~ size */
     /* 表尾 */
     if (BIT_GET(flags_mask, XF_DUMP_TAIL_BIT)) {
-        for (uint8_t i = 0; i < bytes_actually_out_per_line; i++) {
-            xf_log_dump_printf("-");
-        }
-        xf_log_dump_printf("\n");
+        xf_memset(line, '-', bytes_actually_out_per_line);
+        p = line + bytes_actually_out_per_line;
+        *p++ = '\n';
+        _output_line(line, p);
     }
     return XF_OK;
 }
 
-#endif // XF_LOG_DUMP_IS_ENABLE
-
 /* ==================== [Static Functions] ================================== */
 
+static char *_put_hex2(char *p, uint8_t b, const char *digits)
+{
+    p[0] = digits[b >> 4];
+    p[1] = digits[b & 0xf];
+    return p + 2;
+}
+
+static char *_put_str(char *p, const char *s, size_t n)
+{
+    xf_memcpy(p, s, n);
+    return p + n;
+}
+
+static void _output_line(const char *line, const char *end)
+{
+    xf_log_dump_printf("%.*s", (int)(end - line), line);
+}
+
+#endif // XF_LOG_DUMP_IS_ENABLE
+
@@ -0,0 +1,214 @@
+/**
+ * @file xf_utils_log_kv.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 结构化（键值对）日志。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils_log_kv.h"
+#include "../xf_std/xf_stdio.h"
+#include "../xf_std/xf_stdlib.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 为记录结尾 ,"trunc":true}\n 预留的字节数 */
+#define TAIL_RESERVE                    (16)
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct {
+    char   *buf;
+    size_t  cap;        /*!< 可用于字段的容量（已扣除 TAIL_RESERVE） */
+    size_t  len;
+    bool    trunc;
+} _writer_t;
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _put(_writer_t *w, const char *data, size_t len);
+static void _put_cstr(_writer_t *w, const char *str);
+static void _put_json_str(_writer_t *w, const char *str);
+static void _put_key(_writer_t *w, const char *key);
+static void _put_value(_writer_t *w, const xf_kv_t *kv);
+
+/* ==================== [Static Variables] ================================== */
+
+static const char s_level_str[][2] = { "N", "U", "E", "W", "I", "D", "V" };
+
+/* ==================== [Macros] ============================================ */
+
+/* ==================== [Global Functions] ================================== */
+
+size_t xf_log_kv_format(char *buf, size_t size, uint8_t level, const char *tag,
+                        const char *msg, const xf_kv_t *kvs, size_t n)
+{
+    if ((NULL == buf) || (size < 64) || ((NULL == kvs) && (n > 0))) {
+        return 0;
+    }
+    _writer_t w = { buf, size - TAIL_RESERVE, 0, false };
+
+    _put_cstr(&w, "{");
+#if XF_LOG_TIMESTAMP_IS_ENABLE
+    char num[XF_U64TOA_BUF_SIZE];
+    size_t num_len = xf_u64toa((uint64_t)XF_LOG_TIMESTAMP_GET(), num);
+    _put_cstr(&w, "\"ts\":");
+    _put(&w, num, num_len);
+    _put_cstr(&w, ",");
+#endif
+    _put_cstr(&w, "\"lvl\":\"");
+    _put_cstr(&w, (level < ARRAY_SIZE(s_level_str)) ? s_level_str[level] : "?");
+    _put_cstr(&w, "\"");
+
+    /* 放不下的字段整体丢弃, 保证输出仍是合法 JSON */
+    size_t mark = w.len;
+    _put_cstr(&w, ",\"tag\":");
+    _put_json_str(&w, tag);
+    _put_cstr(&w, ",\"msg\":");
+    _put_json_str(&w, msg);
+    if (w.trunc) {
+        w.len = mark;
+    }
+
+    for (size_t i = 0; (i < n) && !w.trunc; i++) {
+        if ((XF_KV_TYPE_NONE == kvs[i].type) || (NULL == kvs[i].key)) {
+            continue;
+        }
+        mark = w.len;
+        _put_cstr(&w, ",");
+        _put_key(&w, kvs[i].key);
+        _put_value(&w, &kvs[i]);
+        if (w.trunc) {
+            w.len = mark;
+        }
+    }
+
+    /* 结尾使用预留空间 */
+    w.cap += TAIL_RESERVE;
+    if (w.trunc) {
+        w.trunc = false;
+        _put_cstr(&w, ",\"trunc\":true");
+    }
+    _put_cstr(&w, "}\n");
+    return w.len;
+}
+
+int xf_log_kv(uint8_t level, const char *tag, const char *msg, const xf_kv_t *kvs, size_t n)
+{
+    char buf[XF_LOG_KV_BUF_SIZE];
+    size_t len = xf_log_kv_format(buf, sizeof(buf), level, tag, msg, kvs, n);
+    if (0 == len) {
+        return 0;
+    }
+    xf_log_kv_write(level, buf, len);
+    return (int)len;
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _put(_writer_t *w, const char *data, size_t len)
+{
+    if (w->trunc) {
+        return;
+    }
+    if (len > w->cap - w->len) {
+        w->trunc = true;
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        w->buf[w->len + i] = data[i];
+    }
+    w->len += len;
+}
+
+static void _put_cstr(_writer_t *w, const char *str)
+{
+    size_t len = 0;
+    while (str[len]) {
+        len++;
+    }
+    _put(w, str, len);
+}
+
+/**
+ * @brief 输出带引号的 JSON 字符串, 转义引号、反斜杠和控制字符.
+ */
+static void _put_json_str(_writer_t *w, const char *str)
+{
+    static const char hex[] = "0123456789abcdef";
+    const char *run;
+
+    if (NULL == str) {
+        _put_cstr(w, "null");
+        return;
+    }
+    _put(w, "\"", 1);
+    for (run = str; *str; str++) {
+        unsigned char c = (unsigned char)*str;
+        if ((c >= 0x20) && (c != '"') && (c != '\\')) {
+            continue;
+        }
+        _put(w, run, (size_t)(str - run));
+        run = str + 1;
+        switch (c) {
+        case '"':   _put(w, "\\\"", 2); break;
+        case '\\':  _put(w, "\\\\", 2); break;
+        case '\n':  _put(w, "\\n", 2);  break;
+        case '\r':  _put(w, "\\r", 2);  break;
+        case '\t':  _put(w, "\\t", 2);  break;
+        default: {
+            char esc[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf] };
+            _put(w, esc, sizeof(esc));
+        } break;
+        }
+    }
+    _put(w, run, (size_t)(str - run));
+    _put(w, "\"", 1);
+}
+
+static void _put_key(_writer_t *w, const char *key)
+{
+    _put(w, "\"", 1);
+    _put_cstr(w, key);
+    _put(w, "\":", 2);
+}
+
+static void _put_value(_writer_t *w, const xf_kv_t *kv)
+{
+    char num[32];
+    int len = 0;
+
+    switch (kv->type) {
+    case XF_KV_TYPE_INT:
+        len = (int)xf_i64toa(kv->v.i, num);
+        break;
+    case XF_KV_TYPE_UINT:
+        len = (int)xf_u64toa(kv->v.u, num);
+        break;
+    case XF_KV_TYPE_FLOAT:
+        /* JSON 不能表示 NaN 和无穷大 */
+        if ((kv->v.f != kv->v.f) || (kv->v.f - kv->v.f != 0)) {
+            _put_cstr(w, "null");
+            return;
+        }
+        len = xf_snprintf(num, sizeof(num), "%.9g", kv->v.f);
+        break;
+    case XF_KV_TYPE_BOOL:
+        _put_cstr(w, kv->v.b ? "true" : "false");
+        return;
+    case XF_KV_TYPE_STR:
+        _put_json_str(w, kv->v.s);
+        return;
+    default:
+        _put_cstr(w, "null");
+        return;
+    }
+    if (len > 0) {
+        _put(w, num, (size_t)len);
+    }
+}
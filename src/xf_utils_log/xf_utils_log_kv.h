@@ -0,0 +1,165 @@
+/**
+ * @file xf_utils_log_kv.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 结构化（键值对）日志。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 每条日志序列化为一行 JSON（JSON Lines）, 如:
+ * @code{.c}
+ * XF_LOGI_KV(TAG, "connected", XF_KV_INT("id", id), XF_KV_STR("peer", peer));
+ * // {"ts":1234,"lvl":"I","tag":"main","msg":"connected","id":42,"peer":"10.0.0.1"}
+ * @endcode
+ *
+ * - 键值对以复合字面量的形式放在栈上, 字符串只保存指针;
+ * - 记录直接序列化到栈上 XF_LOG_KV_BUF_SIZE 字节的缓冲区, 不分配堆内存,
+ *   再整行交给 xf_log_kv_write(level, buf, len) 输出;
+ * - 等级过滤与 XF_LOGx 相同, 被过滤的等级展开为空;
+ * - 超出缓冲区的字段被丢弃, 并在记录末尾加上 "trunc":true.
+ */
+
+#ifndef __XF_UTILS_LOG_KV_H__
+#define __XF_UTILS_LOG_KV_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils_log.h"
+#include "../xf_std/xf_stdbool.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+/**
+ * @ingroup group_xf_utils_log
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+#define XF_KV_TYPE_NONE         (0) /*!< 占位, 不输出 */
+#define XF_KV_TYPE_INT          (1) /*!< 有符号整数 */
+#define XF_KV_TYPE_UINT         (2) /*!< 无符号整数 */
+#define XF_KV_TYPE_FLOAT        (3) /*!< 浮点数 */
+#define XF_KV_TYPE_BOOL         (4) /*!< 布尔值 */
+#define XF_KV_TYPE_STR          (5) /*!< 字符串, 输出时转义 */
+
+/* ==================== [Typedefs] ========================================== */
+
+/**
+ * @brief 键值对.
+ */
+typedef struct xf_kv_s {
+    const char     *key;        /*!< 键, 不转义, 应为普通标识符 */
+    uint8_t         type;       /*!< 值类型, 见 XF_KV_TYPE_* */
+    union {
+        int64_t     i;
+        uint64_t    u;
+        double      f;
+        bool        b;
+        const char *s;
+    } v;                        /*!< 值 */
+} xf_kv_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 将一条结构化日志序列化为一行 JSON（以 '\n' 结尾, 不以 '\0' 结尾）.
+ *
+ * @param buf 输出缓冲区.
+ * @param size 缓冲区大小, 不小于 64.
+ * @param level 日志等级, 见 XF_LOG_*.
+ * @param tag 日志标签.
+ * @param msg 消息.
+ * @param kvs 键值对数组.
+ * @param n 键值对个数.
+ * @return size_t 写入的字节数. 参数错误时为 0.
+ */
+size_t xf_log_kv_format(char *buf, size_t size, uint8_t level, const char *tag,
+                        const char *msg, const xf_kv_t *kvs, size_t n);
+
+/**
+ * @brief 序列化一条结构化日志并通过 xf_log_kv_write 输出. 通常通过 XF_LOGx_KV 宏调用.
+ *
+ * @return int 输出的字节数.
+ */
+int xf_log_kv(uint8_t level, const char *tag, const char *msg, const xf_kv_t *kvs, size_t n);
+
+/* ==================== [Macros] ============================================ */
+
+/**
+ * @brief 构造键值对.
+ */
+#define XF_KV_INT(key_, val)    ((xf_kv_t){ .key = (key_), .type = XF_KV_TYPE_INT,   .v.i = (int64_t)(val) })
+#define XF_KV_UINT(key_, val)   ((xf_kv_t){ .key = (key_), .type = XF_KV_TYPE_UINT,  .v.u = (uint64_t)(val) })
+#define XF_KV_FLOAT(key_, val)  ((xf_kv_t){ .key = (key_), .type = XF_KV_TYPE_FLOAT, .v.f = (double)(val) })
+#define XF_KV_BOOL(key_, val)   ((xf_kv_t){ .key = (key_), .type = XF_KV_TYPE_BOOL,  .v.b = !!(val) })
+#define XF_KV_STR(key_, val)    ((xf_kv_t){ .key = (key_), .type = XF_KV_TYPE_STR,   .v.s = (val) })
+
+/**
+ * 数组首元素为占位符, 使不带键值对的调用也能编译.
+ */
+#define _XF_KV_ARRAY(...)       ((const xf_kv_t[]){ { NULL, XF_KV_TYPE_NONE, { 0 } }, ##__VA_ARGS__ })
+#define _XF_LOG_KV(level, tag, msg, ...) \
+    XF_LOG_SITE(level, tag, xf_log_kv(level, tag, msg, _XF_KV_ARRAY(__VA_ARGS__) + 1, \
+        sizeof(_XF_KV_ARRAY(__VA_ARGS__)) / sizeof(xf_kv_t) - 1))
+
+#if XF_LOG_LEVEL >= XF_LOG_USER
+#   define XF_LOGU_KV(tag, msg, ...)   _XF_LOG_KV(XF_LOG_USER,    tag, msg, ##__VA_ARGS__)
+#else
+#   define XF_LOGU_KV(tag, msg, ...)   (void)(tag)
+#endif
+
+#if XF_LOG_LEVEL >= XF_LOG_ERROR
+#   define XF_LOGE_KV(tag, msg, ...)   _XF_LOG_KV(XF_LOG_ERROR,   tag, msg, ##__VA_ARGS__)
+#else
+#   define XF_LOGE_KV(tag, msg, ...)   (void)(tag)
+#endif
+
+#if XF_LOG_LEVEL >= XF_LOG_WARN
+#   define XF_LOGW_KV(tag, msg, ...)   _XF_LOG_KV(XF_LOG_WARN,    tag, msg, ##__VA_ARGS__)
+#else
+#   define XF_LOGW_KV(tag, msg, ...)   (void)(tag)
+#endif
+
+#if XF_LOG_LEVEL >= XF_LOG_INFO
+/**
+ * @brief 信息等级结构化日志。
+ *
+ * @param tag 日志标签。
+ * @param msg 消息。
+ * @param ... XF_KV_* 构造的键值对。
+ */
+#   define XF_LOGI_KV(tag, msg, ...)   _XF_LOG_KV(XF_LOG_INFO,    tag, msg, ##__VA_ARGS__)
+#else
+#   define XF_LOGI_KV(tag, msg, ...)   (void)(tag)
+#endif
+
+#if XF_LOG_LEVEL >= XF_LOG_DEBUG
+#   define XF_LOGD_KV(tag, msg, ...)   _XF_LOG_KV(XF_LOG_DEBUG,   tag, msg, ##__VA_ARGS__)
+#else
+#   define XF_LOGD_KV(tag, msg, ...)   (void)(tag)
+#endif
+
+#if XF_LOG_LEVEL >= XF_LOG_VERBOSE
+#   define XF_LOGV_KV(tag, msg, ...)   _XF_LOG_KV(XF_LOG_VERBOSE, tag, msg, ##__VA_ARGS__)
+#else
+#   define XF_LOGV_KV(tag, msg, ...)   (void)(tag)
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_log
+ * @}
+ */
+
+#endif // __XF_UTILS_LOG_KV_H__
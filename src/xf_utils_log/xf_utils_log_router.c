@@ -0,0 +1,379 @@
+/**
+ * @file xf_utils_log_router.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 日志路由: 一次格式化, 分发到多个输出（sink）。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils_log_config.h"
+
+#if XF_LOG_ROUTER_IS_ENABLE
+
+#include "xf_utils_log.h"
+#include "../xf_lock/xf_lock.h"
+#include "../xf_std/xf_stdio.h"
+#include "../xf_std/xf_stdlib.h"
+#include "../xf_std/xf_string.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static void _sink_put(xf_log_sink_t *sink, uint8_t level, const char *data, size_t len);
+static void _sink_flush_batch(xf_log_sink_t *sink);
+static void _update_max_level(void);
+static void _ring_write(xf_log_sink_t *sink, const char *data, size_t len);
+static size_t _format_prefix(char *buf, size_t size, uint8_t level, const char *tag,
+                             int line, const char *func);
+static char *_append(char *p, char *end, const char *s, size_t n);
+static int _vprintf_after(uint8_t level, char *buf, size_t size, size_t used,
+                          const char *format, va_list args);
+
+/* ==================== [Static Variables] ================================== */
+
+static XF_LIST_HEAD(s_sinks);
+static xf_lock_t s_lock = NULL;
+
+/* 所有 sink 中最高的等级阈值, 用于在格式化前快速过滤 */
+static uint8_t s_max_level = XF_LOG_NONE;
+
+/* ==================== [Macros] ============================================ */
+
+#define _LOCK()     do { if (s_lock) { xf_lock_lock(s_lock); } } while (0)
+#define _UNLOCK()   do { if (s_lock) { xf_lock_unlock(s_lock); } } while (0)
+
+/* ==================== [Global Functions] ================================== */
+
+xf_err_t xf_log_router_init(void)
+{
+    if (NULL != s_lock) {
+        return XF_OK;
+    }
+    if (XF_OK != xf_lock_init(&s_lock)) {
+        s_lock = NULL;
+        return XF_FAIL;
+    }
+    return XF_OK;
+}
+
+xf_err_t xf_log_sink_init(xf_log_sink_t *sink, xf_log_sink_write_cb_t write,
+                          void *user_data, uint8_t level)
+{
+    if ((NULL == sink) || (NULL == write)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    sink->node.next     = NULL;
+    sink->node.prev     = NULL;
+    sink->level         = level;
+    sink->flush_level   = XF_LOG_NONE;
+    sink->write         = write;
+    sink->flush         = NULL;
+    sink->user_data     = user_data;
+    sink->batch_buf     = NULL;
+    sink->batch_size    = 0;
+    sink->batch_len     = 0;
+    return XF_OK;
+}
+
+xf_err_t xf_log_sink_set_batch(xf_log_sink_t *sink, char *buf, size_t size, uint8_t flush_level)
+{
+    if ((NULL == sink) || ((NULL != buf) && (0 == size))) {
+        return XF_ERR_INVALID_ARG;
+    }
+    _LOCK();
+    _sink_flush_batch(sink);
+    sink->batch_buf     = buf;
+    sink->batch_size    = buf ? size : 0;
+    sink->batch_len     = 0;
+    sink->flush_level   = flush_level;
+    _UNLOCK();
+    return XF_OK;
+}
+
+xf_err_t xf_log_sink_set_level(xf_log_sink_t *sink, uint8_t level)
+{
+    if (NULL == sink) {
+        return XF_ERR_INVALID_ARG;
+    }
+    _LOCK();
+    sink->level = level;
+    _update_max_level();
+    _UNLOCK();
+    return XF_OK;
+}
+
+xf_err_t xf_log_router_add(xf_log_sink_t *sink)
+{
+    if (NULL == sink) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (NULL != sink->node.next) {
+        return XF_ERR_INITED;
+    }
+    _LOCK();
+    xf_list_add_tail(&sink->node, &s_sinks);
+    _update_max_level();
+    _UNLOCK();
+    return XF_OK;
+}
+
+xf_err_t xf_log_router_remove(xf_log_sink_t *sink)
+{
+    if (NULL == sink) {
+        return XF_ERR_INVALID_ARG;
+    }
+    if (NULL == sink->node.next) {
+        return XF_ERR_NOT_FOUND;
+    }
+    _LOCK();
+    _sink_flush_batch(sink);
+    xf_list_del(&sink->node);
+    sink->node.next = NULL;
+    sink->node.prev = NULL;
+    _update_max_level();
+    _UNLOCK();
+    return XF_OK;
+}
+
+int xf_log_router_printf(uint8_t level, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int n = xf_log_router_vprintf(level, format, args);
+    va_end(args);
+    return n;
+}
+
+int xf_log_router_vprintf(uint8_t level, const char *format, va_list args)
+{
+    if (level > xf_atomic_load(&s_max_level, XF_ATOMIC_RELAXED)) {
+        return 0;
+    }
+    char buf[XF_LOG_ROUTER_BUF_SIZE];
+    return _vprintf_after(level, buf, sizeof(buf), 0, format, args);
+}
+
+int xf_log_router_printf_prefix(uint8_t level, const char *tag, int line, const char *func,
+                                const char *format, ...)
+{
+    if (level > xf_atomic_load(&s_max_level, XF_ATOMIC_RELAXED)) {
+        return 0;
+    }
+    char buf[XF_LOG_ROUTER_BUF_SIZE];
+    size_t used = _format_prefix(buf, sizeof(buf), level, tag, line, func);
+    va_list args;
+    va_start(args, format);
+    int n = _vprintf_after(level, buf, sizeof(buf), used, format, args);
+    va_end(args);
+    return n;
+}
+
+void xf_log_router_write(uint8_t level, const char *data, size_t len)
+{
+    xf_log_sink_t *sink;
+
+    if ((NULL == data) || (0 == len)
+            || (level > xf_atomic_load(&s_max_level, XF_ATOMIC_RELAXED))) {
+        return;
+    }
+    _LOCK();
+    xf_list_for_each_entry(sink, &s_sinks, xf_log_sink_t, node) {
+        if (level <= sink->level) {
+            _sink_put(sink, level, data, len);
+        }
+    }
+    _UNLOCK();
+}
+
+void xf_log_router_flush(void)
+{
+    xf_log_sink_t *sink;
+
+    _LOCK();
+    xf_list_for_each_entry(sink, &s_sinks, xf_log_sink_t, node) {
+        _sink_flush_batch(sink);
+        if (sink->flush) {
+            sink->flush(sink);
+        }
+    }
+    _UNLOCK();
+}
+
+xf_err_t xf_log_sink_ring_init(xf_log_sink_ring_t *ring, char *buf, size_t size, uint8_t level)
+{
+    if ((NULL == ring) || (NULL == buf) || (0 == size)) {
+        return XF_ERR_INVALID_ARG;
+    }
+    xf_log_sink_init(&ring->sink, _ring_write, ring, level);
+    ring->buf   = buf;
+    ring->size  = size;
+    ring->head  = 0;
+    ring->used  = 0;
+    return XF_OK;
+}
+
+size_t xf_log_sink_ring_read(xf_log_sink_ring_t *ring, char *out, size_t size)
+{
+    if ((NULL == ring) || (NULL == out)) {
+        return 0;
+    }
+    _LOCK();
+    size_t n = (ring->used < size) ? ring->used : size;
+    size_t start = (ring->head + ring->size - n) % ring->size;
+    size_t first = ring->size - start;
+    if (first > n) {
+        first = n;
+    }
+    xf_memcpy(out, ring->buf + start, first);
+    xf_memcpy(out + first, ring->buf, n - first);
+    _UNLOCK();
+    return n;
+}
+
+void xf_log_sink_ring_clear(xf_log_sink_ring_t *ring)
+{
+    if (NULL == ring) {
+        return;
+    }
+    _LOCK();
+    ring->head = 0;
+    ring->used = 0;
+    _UNLOCK();
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static void _sink_put(xf_log_sink_t *sink, uint8_t level, const char *data, size_t len)
+{
+    if (NULL == sink->batch_buf) {
+        sink->write(sink, data, len);
+        return;
+    }
+    if (len > sink->batch_size - sink->batch_len) {
+        _sink_flush_batch(sink);
+        if (len > sink->batch_size) {
+            sink->write(sink, data, len);
+            return;
+        }
+    }
+    xf_memcpy(sink->batch_buf + sink->batch_len, data, len);
+    sink->batch_len += len;
+    if (level <= sink->flush_level) {
+        _sink_flush_batch(sink);
+    }
+}
+
+static void _sink_flush_batch(xf_log_sink_t *sink)
+{
+    if (sink->batch_len) {
+        sink->write(sink, sink->batch_buf, sink->batch_len);
+        sink->batch_len = 0;
+    }
+}
+
+static void _update_max_level(void)
+{
+    xf_log_sink_t *sink;
+    uint8_t max = XF_LOG_NONE;
+
+    xf_list_for_each_entry(sink, &s_sinks, xf_log_sink_t, node) {
+        if (sink->level > max) {
+            max = sink->level;
+        }
+    }
+    xf_atomic_store(&s_max_level, max, XF_ATOMIC_RELAXED);
+}
+
+static void _ring_write(xf_log_sink_t *sink, const char *data, size_t len)
+{
+    xf_log_sink_ring_t *ring = (xf_log_sink_ring_t *)sink->user_data;
+
+    /* 超过容量时只保留最后 size 字节 */
+    if (len > ring->size) {
+        data += len - ring->size;
+        len = ring->size;
+    }
+    size_t first = ring->size - ring->head;
+    if (first > len) {
+        first = len;
+    }
+    xf_memcpy(ring->buf + ring->head, data, first);
+    xf_memcpy(ring->buf, data + first, len - first);
+    ring->head = (ring->head + len) % ring->size;
+    ring->used = (ring->used + len > ring->size) ? ring->size : (ring->used + len);
+}
+
+/**
+ * @brief 按 XF_LOG_PREFIX_FMT 的格式写入前缀, 最多 size - 2 字节, 为换行和 '\0' 留出空间.
+ */
+static size_t _format_prefix(char *buf, size_t size, uint8_t level, const char *tag,
+                             int line, const char *func)
+{
+    static const char s_level_ch[] = "NUEWIDV";
+    char num[XF_U64TOA_BUF_SIZE];
+    char *p = buf;
+    char *end = buf + size - 2;
+    size_t n;
+
+    *p++ = (level < sizeof(s_level_ch) - 1) ? s_level_ch[level] : '?';
+#if XF_LOG_TIMESTAMP_IS_ENABLE
+    n = xf_u64toa((uint64_t)(unsigned long)XF_LOG_TIMESTAMP_GET(), num);
+    p = _append(p, end, " (", 2);
+    p = _append(p, end, num, n);
+    p = _append(p, end, ")", 1);
+#endif
+    tag = tag ? tag : "(null)";
+    func = func ? func : "(null)";
+    p = _append(p, end, "-", 1);
+    p = _append(p, end, tag, xf_strlen(tag));
+    p = _append(p, end, "[:", 2);
+    n = xf_itoa(line, num);
+    p = _append(p, end, num, n);
+    p = _append(p, end, "(", 1);
+    p = _append(p, end, func, xf_strlen(func));
+    p = _append(p, end, ")]: ", 4);
+    return (size_t)(p - buf);
+}
+
+/**
+ * @brief 追加 n 字节, 超出 end 的部分丢弃.
+ */
+static char *_append(char *p, char *end, const char *s, size_t n)
+{
+    size_t room = (size_t)(end - p);
+    if (n > room) {
+        n = room;
+    }
+    xf_memcpy(p, s, n);
+    return p + n;
+}
+
+static int _vprintf_after(uint8_t level, char *buf, size_t size, size_t used,
+                          const char *format, va_list args)
+{
+    int n = xf_vsnprintf(buf + used, size - used, format, args);
+    if (n < 0) {
+        return 0;
+    }
+    size_t len = used + (size_t)n;
+    if (0 == len) {
+        return 0;
+    }
+    if (len >= size) {
+        /* 截断, 保留换行 */
+        len = size - 1;
+        buf[len - 1] = '\n';
+    }
+    xf_log_router_write(level, buf, len);
+    return (int)len;
+}
+
+#endif /* XF_LOG_ROUTER_IS_ENABLE */
@@ -0,0 +1,253 @@
+/**
+ * @file xf_utils_log_router.h
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 日志路由: 一次格式化, 分发到多个输出（sink）。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ * @details
+ *
+ * 使能 XF_LOG_ROUTER_ENABLE 后, XF_LOGx 将日志格式化到栈上
+ * XF_LOG_ROUTER_BUF_SIZE 字节的缓冲区, 再交给所有等级满足的 sink:
+ *
+ * - 每个 sink 有独立的等级阈值, 只接收等级不高于阈值的日志;
+ *   所有 sink 都不接收的日志不会被格式化;
+ * - sink 可以设置批量缓冲区, 日志先追加到缓冲区, 缓冲区满、
+ *   收到不高于 flush_level 的日志或调用 xf_log_router_flush() 时才整块写出;
+ * - 通过 xf_log_router_init() 创建 xf_lock 后分发过程是线程安全的,
+ *   sink 的回调在锁内串行执行.
+ *
+ * 路由不会自动注册任何 sink: 一个 sink 都没有时日志全部被丢弃, 不再经过 xf_log_printf().
+ *
+ * 用法:
+ * @code{.c}
+ * static xf_log_sink_t s_uart_sink;
+ * xf_log_router_init();
+ * xf_log_sink_init(&s_uart_sink, uart_write, NULL, XF_LOG_VERBOSE);
+ * xf_log_router_add(&s_uart_sink);
+ * @endcode
+ */
+
+#ifndef __XF_UTILS_LOG_ROUTER_H__
+#define __XF_UTILS_LOG_ROUTER_H__
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils_log_config.h"
+#include "../xf_common/xf_common.h"
+#include "../xf_std/xf_stddef.h"
+#include "../xf_std/xf_stdint.h"
+
+#if XF_LOG_ROUTER_IS_ENABLE
+
+#include <stdarg.h>
+
+/**
+ * @ingroup group_xf_utils_log
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== [Defines] =========================================== */
+
+/* ==================== [Typedefs] ========================================== */
+
+typedef struct xf_log_sink_s xf_log_sink_t;
+
+/**
+ * @brief sink 写出回调. 数据不以 '\0' 结尾, 可能包含多条日志（批量时）.
+ *
+ * @param sink sink.
+ * @param data 数据.
+ * @param len 数据长度.
+ */
+typedef void (*xf_log_sink_write_cb_t)(xf_log_sink_t *sink, const char *data, size_t len);
+
+/**
+ * @brief sink 刷新回调, 在 xf_log_router_flush() 写出批量缓冲区后调用, 可为 NULL.
+ */
+typedef void (*xf_log_sink_flush_cb_t)(xf_log_sink_t *sink);
+
+/**
+ * @brief 日志输出. 通常嵌入到具体 sink 的结构体中.
+ *
+ * @attention 使用前必须调用 xf_log_sink_init() 初始化.
+ */
+struct xf_log_sink_s {
+    xf_list_t               node;           /*!< 路由链表节点 */
+    uint8_t                 level;          /*!< 只接收等级不高于该值的日志 */
+    uint8_t                 flush_level;    /*!< 不高于该等级的日志立即写出批量缓冲区 */
+    xf_log_sink_write_cb_t  write;          /*!< 写出回调 */
+    xf_log_sink_flush_cb_t  flush;          /*!< 刷新回调 */
+    void                   *user_data;      /*!< 用户数据 */
+    char                   *batch_buf;      /*!< 批量缓冲区, NULL 时不批量 */
+    size_t                  batch_size;     /*!< 批量缓冲区大小 */
+    size_t                  batch_len;      /*!< 批量缓冲区已用字节数 */
+};
+
+/**
+ * @brief 内存环形 sink, 保留最近写入的 size 字节日志.
+ */
+typedef struct xf_log_sink_ring_s {
+    xf_log_sink_t           sink;
+    char                   *buf;            /*!< 环形缓冲区 */
+    size_t                  size;           /*!< 环形缓冲区大小 */
+    size_t                  head;           /*!< 下一个写入位置 */
+    size_t                  used;           /*!< 有效字节数, 不超过 size */
+} xf_log_sink_ring_t;
+
+/* ==================== [Global Prototypes] ================================= */
+
+/**
+ * @brief 初始化日志路由, 创建分发使用的锁.
+ *
+ * 不调用或 xf_lock 未对接时, 路由不加锁, 只能在单线程中使用.
+ *
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_FAIL               锁创建失败
+ */
+xf_err_t xf_log_router_init(void);
+
+/**
+ * @brief 初始化 sink.
+ *
+ * @param sink sink.
+ * @param write 写出回调.
+ * @param user_data 用户数据.
+ * @param level 只接收等级不高于 level 的日志, 见 XF_LOG_*.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_log_sink_init(xf_log_sink_t *sink, xf_log_sink_write_cb_t write,
+                          void *user_data, uint8_t level);
+
+/**
+ * @brief 设置 sink 的批量缓冲区. 应在加入路由前调用.
+ *
+ * @param sink sink.
+ * @param buf 缓冲区, NULL 表示不批量.
+ * @param size 缓冲区大小.
+ * @param flush_level 不高于该等级的日志立即写出, 如 XF_LOG_ERROR.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_log_sink_set_batch(xf_log_sink_t *sink, char *buf, size_t size, uint8_t flush_level);
+
+/**
+ * @brief 修改 sink 的等级阈值.
+ */
+xf_err_t xf_log_sink_set_level(xf_log_sink_t *sink, uint8_t level);
+
+/**
+ * @brief 将 sink 加入路由.
+ *
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_INITED         已加入
+ */
+xf_err_t xf_log_router_add(xf_log_sink_t *sink);
+
+/**
+ * @brief 将 sink 移出路由, 移出前写出其批量缓冲区.
+ *
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ *      - XF_ERR_NOT_FOUND      未加入
+ */
+xf_err_t xf_log_router_remove(xf_log_sink_t *sink);
+
+/**
+ * @brief 格式化一条日志并分发. 通常通过 XF_LOGx 调用.
+ *
+ * @param level 日志等级.
+ * @param format 格式化字符串.
+ * @return int 格式化后的字节数, 没有 sink 接收时为 0.
+ */
+int xf_log_router_printf(uint8_t level, const char *format, ...);
+
+/**
+ * @brief 同 xf_log_router_printf(), 参数为 va_list.
+ */
+int xf_log_router_vprintf(uint8_t level, const char *format, va_list args);
+
+/**
+ * @brief 输出一条带默认前缀（格式同 XF_LOG_PREFIX_FMT）的日志. 默认的 xf_log_level 使用该函数.
+ *
+ * 前缀直接用 xf_utoa() 等拼接, 只有 format 部分经过 xf_vsnprintf 格式化.
+ *
+ * @param level 日志等级.
+ * @param tag 标签.
+ * @param line 行号.
+ * @param func 函数名.
+ * @param format 格式化字符串.
+ * @return int 格式化后的字节数, 没有 sink 接收时为 0.
+ */
+int xf_log_router_printf_prefix(uint8_t level, const char *tag, int line, const char *func,
+                                const char *format, ...);
+
+/**
+ * @brief 分发已格式化的数据.
+ *
+ * @param level 日志等级.
+ * @param data 数据.
+ * @param len 数据长度.
+ */
+void xf_log_router_write(uint8_t level, const char *data, size_t len);
+
+/**
+ * @brief 写出所有 sink 的批量缓冲区并调用其 flush 回调.
+ */
+void xf_log_router_flush(void);
+
+/**
+ * @brief 初始化内存环形 sink, 需要再调用 xf_log_router_add() 加入路由.
+ *
+ * @param ring 环形 sink.
+ * @param buf 环形缓冲区.
+ * @param size 环形缓冲区大小.
+ * @param level 等级阈值.
+ * @return xf_err_t
+ *      - XF_OK                 成功
+ *      - XF_ERR_INVALID_ARG    参数错误
+ */
+xf_err_t xf_log_sink_ring_init(xf_log_sink_ring_t *ring, char *buf, size_t size, uint8_t level);
+
+/**
+ * @brief 按写入顺序读出环形 sink 中最近的日志.
+ *
+ * @param ring 环形 sink.
+ * @param out 输出缓冲区.
+ * @param size 输出缓冲区大小. 小于有效字节数时只读出最近的 size 字节.
+ * @return size_t 读出的字节数.
+ */
+size_t xf_log_sink_ring_read(xf_log_sink_ring_t *ring, char *out, size_t size);
+
+/**
+ * @brief 清空环形 sink.
+ */
+void xf_log_sink_ring_clear(xf_log_sink_ring_t *ring);
+
+/* ==================== [Macros] ============================================ */
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+/**
+ * End of group_xf_utils_log
+ * @}
+ */
+
+#endif /* XF_LOG_ROUTER_IS_ENABLE */
+
+#endif // __XF_UTILS_LOG_ROUTER_H__
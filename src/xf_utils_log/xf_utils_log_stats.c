@@ -0,0 +1,118 @@
+/**
+ * @file xf_utils_log_stats.c
+ * @author catcatBlue (catcatblue@qq.com)
+ * @brief 日志调用点统计。
+ * @version 1.0
+ * @date 2026-10-19
+ *
+ * Copyright (c) 2026, CorAL. All rights reserved.
+ *
+ */
+
+/* ==================== [Includes] ========================================== */
+
+#include "xf_utils_log_config.h"
+
+#if XF_LOG_STATS_IS_ENABLE
+
+#include "xf_utils_log.h"
+
+/* ==================== [Defines] =========================================== */
+
+/* 链接器为段名是合法标识符的段自动生成的起止符号 */
+#define SITES_START                     XCONCAT(__start_, XF_LOG_STATS_SECTION)
+#define SITES_STOP                      XCONCAT(__stop_, XF_LOG_STATS_SECTION)
+
+/* ==================== [Typedefs] ========================================== */
+
+/* ==================== [Static Prototypes] ================================= */
+
+static uint64_t _key(const xf_log_site_t *site, uint8_t by);
+
+/* ==================== [Static Variables] ================================== */
+
+/**
+ * 弱引用: 一个调用点都没有时段不存在, 起止符号均为 NULL.
+ */
+extern xf_log_site_t SITES_START[] __attribute__((weak));
+extern xf_log_site_t SITES_STOP[] __attribute__((weak));
+
+static const char s_level_char[] = { 'N', 'U', 'E', 'W', 'I', 'D', 'V' };
+
+/* ==================== [Macros] ============================================ */
+
+#define _LOAD(p)                        xf_atomic_load((p), XF_ATOMIC_RELAXED)
+
+/* ==================== [Global Functions] ================================== */
+
+size_t xf_log_stats_count(void)
+{
+    return (size_t)(SITES_STOP - SITES_START);
+}
+
+void xf_log_stats_reset(void)
+{
+    for (xf_log_site_t *site = SITES_START; site < SITES_STOP; site++) {
+        xf_atomic_store(&site->hits, 0, XF_ATOMIC_RELAXED);
+        xf_atomic_store(&site->bytes, 0, XF_ATOMIC_RELAXED);
+    }
+}
+
+size_t xf_log_stats_top(const xf_log_site_t **sites, size_t n, uint8_t by)
+{
+    if ((NULL == sites) || (0 == n)) {
+        return 0;
+    }
+    size_t cnt = 0;
+    /* sites 按 key 降序保持有序, 插入排序, O(调用点数 * n) */
+    for (const xf_log_site_t *site = SITES_START; site < SITES_STOP; site++) {
+        uint64_t key = _key(site, by);
+        if (0 == _LOAD(&site->hits)) {
+            continue;
+        }
+        if ((cnt == n) && (key <= _key(sites[n - 1], by))) {
+            continue;
+        }
+        size_t i = (cnt < n) ? cnt++ : (n - 1);
+        while ((i > 0) && (_key(sites[i - 1], by) < key)) {
+            sites[i] = sites[i - 1];
+            i--;
+        }
+        sites[i] = site;
+    }
+    return cnt;
+}
+
+void xf_log_stats_dump(size_t n, uint8_t by)
+{
+    const xf_log_site_t *sites[XF_LOG_STATS_DUMP_MAX];
+
+    if (n > XF_LOG_STATS_DUMP_MAX) {
+        n = XF_LOG_STATS_DUMP_MAX;
+    }
+    n = xf_log_stats_top(sites, n, by);
+
+    /* 直接使用 xf_log_printf, 避免统计输出本身被计入 */
+    xf_log_printf("log stats: top %u of %u sites by %s\n", (unsigned)n,
+                  (unsigned)xf_log_stats_count(),
+                  (XF_LOG_STATS_BY_HITS == by) ? "hits" : "bytes");
+    for (size_t i = 0; i < n; i++) {
+        const xf_log_site_t *site = sites[i];
+        const char *tag = _LOAD(&site->tag);
+        xf_log_printf("  #%-2u %10llu B %8llu hits  %c %s %s:%u (%s)\n",
+                      (unsigned)(i + 1),
+                      (unsigned long long)_LOAD(&site->bytes),
+                      (unsigned long long)_LOAD(&site->hits),
+                      (site->level < sizeof(s_level_char)) ? s_level_char[site->level] : '?',
+                      tag ? tag : "-", site->file, (unsigned)site->line, site->func);
+    }
+}
+
+/* ==================== [Static Functions] ================================== */
+
+static uint64_t _key(const xf_log_site_t *site, uint8_t by)
+{
+    return (XF_LOG_STATS_BY_HITS == by) ? _LOAD(&site->hits) : _LOAD(&site->bytes);
+}
+
+#endif /* XF_LOG_STATS_IS_ENABLE */
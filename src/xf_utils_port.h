@@ -16,6 +16,8 @@
 
 #include "xf_common/xf_common.h"
 #include "xf_lock/xf_lock_port.h"
+#include "xf_time/xf_time_port.h"
+#include "xf_thread/xf_thread_port.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -1,9 +1,36 @@
-add_rules("mode.debug")
+add_rules("mode.debug", "mode.release", "mode.releasedbg", "mode.minsizerel")
+set_defaultmode("debug")
 
 add_requires("pthread")
 
-function add_xf_utils(base_path) 
-    add_cflags("-std=gnu99 -O0")
+option("lto")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Enable link time optimization in release modes")
+option_end()
+
+-- 优化等级由编译模式决定:
+--   debug       -O0 -g
+--   releasedbg  -O2 -g
+--   release     -O3
+--   minsizerel  -Os
+-- 非 debug 模式下按函数/数据分段并在链接时回收未引用的段.
+function add_xf_utils_flags()
+    add_cflags("-std=gnu99")
+    if is_mode("releasedbg") then
+        set_optimize("faster")
+    end
+    if not is_mode("debug") then
+        add_cflags("-ffunction-sections", "-fdata-sections")
+        add_ldflags("-Wl,--gc-sections")
+        if has_config("lto") then
+            set_policy("build.optimization.lto", true)
+        end
+    end
+end
+
+function add_xf_utils(base_path)
+    add_xf_utils_flags()
     add_files(string.format("%s/src/**.c", base_path))
     add_files(string.format("%s/port/*.c", base_path))
     add_includedirs(string.format("%s/src", base_path))
@@ -12,9 +39,29 @@ function add_xf_utils(base_path)
 end
 
 
+target("xf_utils_static")
+    set_kind("static")
+    set_basename("xf_utils")
+    set_default(false)
+    add_xf_utils_flags()
+    add_files("src/**.c")
+    add_files("port/*.c")
+    add_includedirs("src", "port", {public = true})
+    add_packages("pthread", {public = true})
+
 target("xf_utils")
     set_kind("binary")
     add_cflags("-Wall")
     add_files("examples/*.c")
     add_includedirs("examples")
     add_xf_utils(".")
+
+
+-- 性能测试请使用优化模式, 如: xmake f -m release; xmake build bench; xmake run bench
+target("bench")
+    set_kind("binary")
+    set_default(false)
+    add_cflags("-Wall")
+    add_files("bench/*.c")
+    add_includedirs("bench")
+    add_xf_utils(".")